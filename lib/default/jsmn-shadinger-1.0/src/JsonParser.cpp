@@ -25,6 +25,25 @@
 \*********************************************************************************************/
 
 const char * k_current_json_buffer = "";
+JsonParser * k_current_json_parser = nullptr;
+
+// case-insensitive hash of a key, `key` can be in PROGMEM
+static uint32_t json_key_hash(const char * key) {
+  uint32_t hash = 2166136261;   // FNV-1a
+  uint8_t c;
+  while ((c = pgm_read_byte(key++)) != 0) {
+    if (c >= 'A' && c <= 'Z') { c += 'a' - 'A'; }
+    hash = (hash ^ c) * 16777619;
+  }
+  return hash;
+}
+
+// number of slots of the hash table for an object of `size` keys, power of 2
+static uint32_t json_index_slots(uint32_t size) {
+  uint32_t slots = 16;
+  while (slots < size * 2) { slots <<= 1; }
+  return slots;
+}
 
 // returns nibble value or -1 if not an hex digit
 static int32_t asc2byte(char chr) {
@@ -295,13 +314,17 @@ JsonParser::JsonParser(char * json_in) :
   _size(0),
   _token_len(0),
   _tokens(nullptr),
-  _json(nullptr)
+  _json(nullptr),
+  _index(nullptr),
+  _index_min(JSON_PARSER_INDEX_MIN),
+  _index_done(false)
 {
   parse(json_in);
 }
 
 JsonParser::~JsonParser() {
   this->free();
+  if (k_current_json_parser == this) { k_current_json_parser = nullptr; }
 }
 
 const JsonParserObject JsonParser::getRootObject(void) const {
@@ -394,6 +417,7 @@ const char * JsonParserObject::getStr(const char * needle) const {
 
 void JsonParser::parse(char * json_in) {
   k_current_json_buffer = "";
+  k_current_json_parser = this;
   if (nullptr == json_in) { return; }
   _json = json_in;
   k_current_json_buffer = _json;
@@ -483,6 +507,11 @@ JsonParserToken JsonParserObject::operator[](const char * needle) const {
   // if needle == "?" then we return the first valid key
   bool wildcard = (strcmp_P("?", needle) == 0);
 
+  if (!wildcard && (nullptr != k_current_json_parser)) {
+    const jsmntok_t * value = k_current_json_parser->findKey(t, needle);
+    if (nullptr != value) { return JsonParserToken(value); }
+  }
+
   for (const auto key : *this) {
     if (wildcard) { return key.getValue(); }
     if (0 == strcasecmp_P(key.getStr(), needle)) { return key.getValue(); }
@@ -542,11 +571,112 @@ const char * JsonParserObject::findConstCharNull(const char * needle) const {
 //   return JsonParserToken(&token_bad);
 // }
 
+/*********************************************************************************************\
+ * Hash index of object keys
+ *
+ * Single buffer of uint16_t:
+ *   [0]           number of indexed objects
+ *   [1 + 2*i]     token index of object i, in increasing order
+ *   [2 + 2*i]     offset in buffer of the hash table of object i
+ *   tables        `json_index_slots(size)` entries each, key token index + 1 or 0 if empty
+\*********************************************************************************************/
+
+void JsonParser::setIndexMin(uint8_t index_min) {
+  if (nullptr != _index) {
+    delete[] _index;
+    _index = nullptr;
+  }
+  _index_min = index_min;
+  _index_done = false;
+}
+
+void JsonParser::buildIndex(void) {
+  _index_done = true;
+  if ((0 == _index_min) || (_token_len <= 0)) { return; }
+
+  uint32_t objects = 0;
+  uint32_t slots = 0;
+  for (int32_t i = 0; i < _token_len; i++) {
+    if ((_tokens[i].type == JSMN_OBJECT) && (_tokens[i].size >= _index_min)) {
+      objects++;
+      slots += json_index_slots(_tokens[i].size);
+    }
+  }
+  if (0 == objects) { return; }
+  uint32_t index_size = 1 + objects * 2 + slots;
+  if (index_size > 0xFFFF) { return; }    // offsets would not fit, keep linear search
+
+  _index = new uint16_t[index_size];
+  memset(_index, 0, index_size * sizeof(uint16_t));
+  _index[0] = objects;
+  uint16_t * dir = &_index[1];
+  uint32_t offset = 1 + objects * 2;
+  for (int32_t i = 0; i < _token_len; i++) {
+    if ((_tokens[i].type == JSMN_OBJECT) && (_tokens[i].size >= _index_min)) {
+      uint32_t mask = json_index_slots(_tokens[i].size) - 1;
+      uint16_t * table = &_index[offset];
+      *dir++ = i;
+      *dir++ = offset;
+      offset += mask + 1;
+
+      for (const auto key : JsonParserObject(&_tokens[i])) {
+        const char * key_str = &_json[key.t->start];
+        uint32_t slot = json_key_hash(key_str) & mask;
+        while (table[slot]) {
+          // keep the first of duplicate keys, like the linear search
+          if (0 == strcasecmp(&_json[_tokens[table[slot] - 1].start], key_str)) { break; }
+          slot = (slot + 1) & mask;
+        }
+        if (0 == table[slot]) {
+          table[slot] = (key.t - _tokens) + 1;
+        }
+      }
+    }
+  }
+}
+
+const jsmntok_t * JsonParser::findKey(const jsmntok_t * obj, const char * needle) {
+  if ((nullptr == _tokens) || (obj < _tokens) || (obj >= _tokens + _token_len)) { return nullptr; }
+  if ((0 == _index_min) || (obj->size < _index_min)) { return nullptr; }
+  if (!_index_done) { buildIndex(); }
+  if (nullptr == _index) { return nullptr; }
+
+  // binary search of the object in the directory
+  uint32_t obj_idx = obj - _tokens;
+  int32_t lo = 0;
+  int32_t hi = _index[0] - 1;
+  while (lo <= hi) {
+    int32_t mid = (lo + hi) / 2;
+    uint32_t mid_idx = _index[1 + mid * 2];
+    if (mid_idx == obj_idx) {
+      uint16_t * table = &_index[_index[2 + mid * 2]];
+      uint32_t mask = json_index_slots(obj->size) - 1;
+      uint32_t slot = json_key_hash(needle) & mask;
+      while (table[slot]) {
+        const jsmntok_t * key = &_tokens[table[slot] - 1];
+        if (0 == strcasecmp_P(&_json[key->start], needle)) { return key + 1; }
+        slot = (slot + 1) & mask;
+      }
+      return &token_bad;
+    } else if (mid_idx < obj_idx) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return nullptr;
+}
+
 void JsonParser::free(void) {
   if (nullptr != _tokens) {
     delete[] _tokens;     // TODO
     _tokens = nullptr;
   }
+  if (nullptr != _index) {
+    delete[] _index;
+    _index = nullptr;
+  }
+  _index_done = false;
 }
 
 void JsonParser::allocate(void) {
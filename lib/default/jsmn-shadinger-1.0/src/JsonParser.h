@@ -53,6 +53,17 @@ const extern jsmntok_t token_bad;
 // Warning: this makes code non-reentrant.
 extern const char * k_current_json_buffer;
 
+// Objects with at least this number of keys get a hash index on the first lookup by key.
+// The index is built once for all large objects of the parser, and only if needed.
+#ifndef JSON_PARSER_INDEX_MIN
+#define JSON_PARSER_INDEX_MIN   8
+#endif
+
+// the current parser, used to find the key index of objects
+// same caveat as `k_current_json_buffer`, use `parser->setCurrent()` when intermixing parsers
+class JsonParser;
+extern JsonParser * k_current_json_parser;
+
 /*********************************************************************************************\
  * Read-only JSON token object, fits in 32 bits
 \*********************************************************************************************/
@@ -234,7 +245,15 @@ public:
   ~JsonParser();
 
   // set the current buffer for attribute access (i.e. set the global)
-  void setCurrent(void) { k_current_json_buffer = _json; }
+  void setCurrent(void) { k_current_json_buffer = _json; k_current_json_parser = this; }
+
+  // change the minimum number of keys of an object to get a hash index, 0 disables the index
+  void setIndexMin(uint8_t index_min);
+
+  // find key in object `obj` using the hash index, the index is built on first call
+  // returns the value token, Invalid Token if not found,
+  // or nullptr if `obj` is not indexed (not from this parser or too small)
+  const jsmntok_t * findKey(const jsmntok_t * obj, const char * needle);
 
   // test if the parsing was successful
   inline explicit operator bool() const { return _token_len > 0; }
@@ -252,6 +271,9 @@ protected:
   jsmntok_t * _tokens;        // pointer to token buffer
   jsmn_parser _parser;        // jmsn_parser structure
   char      * _json;          // json buffer
+  uint16_t  * _index;         // hash index of large objects, allocated on first lookup
+  uint8_t     _index_min;     // minimum number of keys to index an object
+  bool        _index_done;    // index was already built (or not needed)
 
   // disallocate token buffer
   void free(void);
@@ -261,6 +283,8 @@ protected:
 
   // access tokens by index
   const JsonParserToken operator[](int32_t i) const;
+  // build the hash index for all objects of at least `_index_min` keys
+  void buildIndex(void);
   // parse
   void parse(char * json_in);
   // post-process parsing: insert NULL chars to split strings, compute a more precise token type
@@ -0,0 +1,326 @@
+/*
+  JsonStreamParser.cpp - incremental JSON tokenizer with constant memory
+
+  Copyright (C) 2021  Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "JsonStreamParser.h"
+#include "JsonParser.h"
+
+static inline bool json_stream_space(char c) {
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+static inline bool json_stream_primitive(char c) {
+  return ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+         (c == '-') || (c == '+') || (c == '.');
+}
+
+JsonStreamParser::JsonStreamParser(JsonStreamCallback cb, void * ctx) :
+  _cb(cb),
+  _ctx(ctx)
+{
+  reset();
+}
+
+void JsonStreamParser::reset(void) {
+  _depth = 0;
+  _len = 0;
+  _escape = 0;
+  _unicode = 0;
+  _value[0] = 0;
+  _type = JSMN_INVALID;
+  _truncated = false;
+  _state = ST_VALUE;
+}
+
+const char * JsonStreamParser::key(uint8_t level) const {
+  if ((level < _depth) && (_stack[level].index < 0)) {
+    return _stack[level].key;
+  }
+  return "";
+}
+
+int32_t JsonStreamParser::index(uint8_t level) const {
+  if (level < _depth) {
+    return _stack[level].index;
+  }
+  return -1;
+}
+
+int32_t JsonStreamParser::getInt(void) const {
+  if (_type == JSMN_BOOL_TRUE) { return 1; }
+  return strtol(_value, nullptr, 0);
+}
+
+float JsonStreamParser::getFloat(void) const {
+  if (_type == JSMN_BOOL_TRUE) { return 1; }
+  return JsonParserToken::json_strtof(_value);
+}
+
+bool JsonStreamParser::getBool(void) const {
+  if (_type == JSMN_BOOL_TRUE) { return true; }
+  if (_type == JSMN_BOOL_FALSE) { return false; }
+  return strtol(_value, nullptr, 0) != 0;
+}
+
+bool JsonStreamParser::feed(const char * chunk, size_t len) {
+  if (nullptr == chunk) { return !isError(); }
+  for (size_t i = 0; i < len; i++) {
+    if ((_state == ST_ERROR) || (_state == ST_STOP)) { return false; }
+    if (_state == ST_DONE) { break; }     // ignore anything after the root value
+    parseChar(chunk[i]);
+  }
+  return (_state != ST_ERROR) && (_state != ST_STOP);
+}
+
+bool JsonStreamParser::finish(void) {
+  if ((_state == ST_PRIMITIVE) && (0 == _depth)) {
+    parseChar(' ');     // flush a single primitive as root value
+  }
+  return _state == ST_DONE;
+}
+
+// append a char to the current key or value, truncate if too long
+void JsonStreamParser::appendChar(char c) {
+  char * buf = _value;
+  size_t size = sizeof(_value);
+  if (ST_KEY == _state) {
+    buf = _stack[_depth - 1].key;
+    size = sizeof(_stack[0].key);
+  }
+  if (_len < size - 1) {
+    buf[_len++] = c;
+  } else {
+    _truncated = true;
+  }
+}
+
+// handle the char following a '\', returns false if invalid
+bool JsonStreamParser::appendEscaped(char c) {
+  if (1 == _escape) {
+    _escape = 0;
+    switch (c) {
+      case '"':
+      case '/':
+      case '\\':  appendChar(c);     break;
+      case 'b':   appendChar('\b');  break;
+      case 'f':   appendChar('\f');  break;
+      case 'r':   appendChar('\r');  break;
+      case 'n':   appendChar('\n');  break;
+      case 't':   appendChar('\t');  break;
+      case 'u':   _escape = 2; _unicode = 0; break;
+      default:    return false;
+    }
+    return true;
+  }
+  // \uXXXX
+  uint32_t nibble;
+  if ((c >= '0') && (c <= '9'))      { nibble = c - '0'; }
+  else if ((c >= 'a') && (c <= 'f')) { nibble = c - 'a' + 10; }
+  else if ((c >= 'A') && (c <= 'F')) { nibble = c - 'A' + 10; }
+  else { return false; }
+  _unicode = (_unicode << 4) | nibble;
+  if (++_escape > 5) {
+    _escape = 0;
+    // encode as UTF-8
+    if (_unicode < 0x80) {
+      appendChar(_unicode);
+    } else if (_unicode < 0x800) {
+      appendChar(0xC0 | (_unicode >> 6));
+      appendChar(0x80 | (_unicode & 0x3F));
+    } else {
+      appendChar(0xE0 | (_unicode >> 12));
+      appendChar(0x80 | ((_unicode >> 6) & 0x3F));
+      appendChar(0x80 | (_unicode & 0x3F));
+    }
+  }
+  return true;
+}
+
+bool JsonStreamParser::openContainer(bool array) {
+  _cb(_ctx, *this, array ? JSON_STREAM_ARRAY_START : JSON_STREAM_OBJECT_START);
+  if (ST_STOP == _state) { return false; }
+  if (_depth >= JSON_STREAM_DEPTH) {
+    _state = ST_ERROR;
+    return false;
+  }
+  Level & level = _stack[_depth++];
+  level.key[0] = 0;
+  level.index = array ? 0 : -1;
+  _state = array ? ST_ARRAY_FIRST : ST_OBJECT_FIRST;
+  return true;
+}
+
+bool JsonStreamParser::closeContainer(bool array) {
+  if ((0 == _depth) || ((_stack[_depth - 1].index >= 0) != array)) {
+    _state = ST_ERROR;        // mismatched '}' or ']'
+    return false;
+  }
+  _depth--;
+  _cb(_ctx, *this, array ? JSON_STREAM_ARRAY_END : JSON_STREAM_OBJECT_END);
+  if (ST_STOP == _state) { return false; }
+  endValue();
+  return true;
+}
+
+void JsonStreamParser::emitValue(void) {
+  _value[_len] = 0;
+  _cb(_ctx, *this, JSON_STREAM_VALUE);
+  if (ST_STOP == _state) { return; }
+  endValue();
+}
+
+void JsonStreamParser::endValue(void) {
+  _len = 0;
+  _truncated = false;
+  _state = (0 == _depth) ? ST_DONE : ST_AFTER_VALUE;
+}
+
+bool JsonStreamParser::parseChar(char c) {
+  switch (_state) {
+    case ST_ARRAY_FIRST:
+      if (json_stream_space(c)) { return true; }
+      if (']' == c) { return closeContainer(true); }
+      _state = ST_VALUE;
+      return parseChar(c);
+
+    case ST_VALUE:
+      if (json_stream_space(c)) { return true; }
+      if ('{' == c) { return openContainer(false); }
+      if ('[' == c) { return openContainer(true); }
+      _len = 0;
+      if ('"' == c) {
+        _state = ST_STRING;
+        return true;
+      }
+      if (json_stream_primitive(c)) {
+        _state = ST_PRIMITIVE;
+        appendChar(c);
+        return true;
+      }
+      break;
+
+    case ST_OBJECT_FIRST:
+      if (json_stream_space(c)) { return true; }
+      if ('}' == c) { return closeContainer(false); }
+      // no break, must be a key
+    case ST_KEY_START:
+      if (json_stream_space(c)) { return true; }
+      if ('"' == c) {
+        _len = 0;
+        _state = ST_KEY;
+        return true;
+      }
+      break;
+
+    case ST_KEY:
+    case ST_STRING:
+      if (_escape) {
+        if (appendEscaped(c)) { return true; }
+        break;
+      }
+      if ('\\' == c) {
+        _escape = 1;
+        return true;
+      }
+      if ('"' != c) {
+        appendChar(c);
+        return true;
+      }
+      if (ST_KEY == _state) {
+        _stack[_depth - 1].key[_len] = 0;
+        _len = 0;
+        _state = ST_COLON;
+      } else {
+        _type = JSMN_STRING;
+        emitValue();
+      }
+      return true;
+
+    case ST_COLON:
+      if (json_stream_space(c)) { return true; }
+      if (':' == c) {
+        _state = ST_VALUE;
+        return true;
+      }
+      break;
+
+    case ST_PRIMITIVE:
+      if (json_stream_primitive(c)) {
+        appendChar(c);
+        return true;
+      }
+      {
+        // same classification as JsonParser::postProcess()
+        char c0 = _value[0];
+        _value[_len] = 0;
+        switch (c0) {
+          case 'n':
+          case 'N':
+            _type = JSMN_NULL;
+            break;
+          case 't':
+          case 'T':
+            _type = JSMN_BOOL_TRUE;
+            break;
+          case 'f':
+          case 'F':
+            _type = JSMN_BOOL_FALSE;
+            break;
+          case '-':
+          case '0'...'9':
+            if (nullptr != strchr(_value, '.')) {
+              _type = JSMN_FLOAT;
+            } else if (c0 == '-') {
+              _type = JSMN_INT;
+            } else {
+              _type = JSMN_UINT;
+            }
+            break;
+          default:
+            _type = JSMN_PRIMITIVE;
+            break;
+        }
+      }
+      emitValue();
+      if ((ST_STOP == _state) || (ST_DONE == _state)) { return true; }
+      return parseChar(c);      // the delimiter belongs to the container
+
+    case ST_AFTER_VALUE:
+      if (json_stream_space(c)) { return true; }
+      if (',' == c) {
+        Level & level = _stack[_depth - 1];
+        if (level.index >= 0) {
+          level.index++;
+          _state = ST_VALUE;
+        } else {
+          _state = ST_KEY_START;
+        }
+        return true;
+      }
+      if ('}' == c) { return closeContainer(false); }
+      if (']' == c) { return closeContainer(true); }
+      break;
+
+    case ST_DONE:
+    case ST_ERROR:
+    case ST_STOP:
+      return false;
+  }
+  _state = ST_ERROR;
+  return false;
+}
@@ -0,0 +1,147 @@
+/*
+  JsonStreamParser.h - incremental JSON tokenizer with constant memory
+
+  Copyright (C) 2021  Stephan Hadinger
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __JSON_STREAM_PARSER__
+#define __JSON_STREAM_PARSER__
+
+#include "jsmn.h"
+#include <string.h>
+#include <stdlib.h>
+#include <Arduino.h>
+
+/*********************************************************************************************\
+ * Streaming JSON parser
+ *
+ * Unlike `JsonParser`, the input does not need to be in a single mutable buffer:
+ * it is fed in chunks of any size with `feed()`, and events are sent to a callback
+ * as soon as a value is complete. Memory is constant, whatever the size of the document.
+ *
+ * During the callback, the path of the current value is available with `depth()`,
+ * `key(level)` and `index(level)`. Level 0 is the root container.
+ * Keys longer than JSON_STREAM_KEY_LEN-1 and values longer than JSON_STREAM_VALUE_LEN-1
+ * are truncated, see `isTruncated()`. Containers nested deeper than JSON_STREAM_DEPTH
+ * are reported as a syntax error.
+ *
+ * Example: {"ZbReceived":{"0x1234":{"Power":[1,0]}}}
+ *   JSON_STREAM_VALUE  depth=4 key(0)="ZbReceived" key(1)="0x1234" key(2)="Power" index(3)=0 getStr()="1"
+ *   JSON_STREAM_VALUE  depth=4 key(0)="ZbReceived" key(1)="0x1234" key(2)="Power" index(3)=1 getStr()="0"
+\*********************************************************************************************/
+
+#ifndef JSON_STREAM_DEPTH
+#define JSON_STREAM_DEPTH       8
+#endif
+#ifndef JSON_STREAM_KEY_LEN
+#define JSON_STREAM_KEY_LEN     32
+#endif
+#ifndef JSON_STREAM_VALUE_LEN
+#define JSON_STREAM_VALUE_LEN   64
+#endif
+
+enum JsonStreamEvent {
+  JSON_STREAM_OBJECT_START,     // path points to the new object
+  JSON_STREAM_OBJECT_END,
+  JSON_STREAM_ARRAY_START,      // path points to the new array
+  JSON_STREAM_ARRAY_END,
+  JSON_STREAM_VALUE,            // single value, see `getType()` and `getStr()`
+};
+
+class JsonStreamParser;
+typedef void (*JsonStreamCallback)(void * ctx, JsonStreamParser & parser, JsonStreamEvent event);
+
+class JsonStreamParser {
+public:
+  JsonStreamParser(JsonStreamCallback cb, void * ctx);
+
+  // restart with a new document
+  void reset(void);
+
+  // feed a chunk of the document, returns false if a syntax error was found or parsing was stopped
+  bool feed(const char * chunk, size_t len);
+  bool feed(const char * str) { return feed(str, strlen(str)); }
+
+  // end of input, returns true if a complete document was parsed
+  bool finish(void);
+
+  // stop parsing from the callback, next calls to `feed()` are ignored
+  void stop(void) { _state = ST_STOP; }
+
+  inline bool isError(void) const   { return _state == ST_ERROR; }
+  inline bool isDone(void) const    { return _state == ST_DONE; }
+
+  // path of the current event
+  inline uint8_t depth(void) const { return _depth; }
+  // key of the member of object at `level`, or "" if array
+  const char * key(uint8_t level) const;
+  // index of the element of array at `level`, or -1 if object
+  int32_t index(uint8_t level) const;
+
+  // current value, only valid for JSON_STREAM_VALUE
+  // type is one of JSMN_STRING, JSMN_NULL, JSMN_BOOL_FALSE, JSMN_BOOL_TRUE, JSMN_FLOAT, JSMN_INT, JSMN_UINT, JSMN_PRIMITIVE
+  inline jsmntype_t getType(void) const { return _type; }
+  inline bool isNum(void) const     { return (_type >= JSMN_FLOAT) && (_type <= JSMN_UINT); }
+  inline bool isStr(void) const     { return _type == JSMN_STRING; }
+  inline bool isTruncated(void) const { return _truncated; }
+  inline const char * getStr(void) const { return _value; }
+  int32_t getInt(void) const;
+  float getFloat(void) const;
+  bool getBool(void) const;
+
+protected:
+  enum State : uint8_t {
+    ST_VALUE,           // expecting a value
+    ST_ARRAY_FIRST,     // after '[', expecting a value or ']'
+    ST_OBJECT_FIRST,    // after '{', expecting a key or '}'
+    ST_KEY_START,       // after ',' in object, expecting a key
+    ST_KEY,             // inside key string
+    ST_COLON,           // after key, expecting ':'
+    ST_STRING,          // inside value string
+    ST_PRIMITIVE,       // inside number, true, false or null
+    ST_AFTER_VALUE,     // expecting ',' or end of container
+    ST_DONE,            // root container closed
+    ST_ERROR,
+    ST_STOP,
+  };
+
+  struct Level {
+    char      key[JSON_STREAM_KEY_LEN];
+    int16_t   index;      // -1 for object
+  };
+
+  JsonStreamCallback _cb;
+  void      * _ctx;
+  Level       _stack[JSON_STREAM_DEPTH];
+  char        _value[JSON_STREAM_VALUE_LEN];
+  uint16_t    _len;       // current length of key or value
+  uint16_t    _unicode;   // code point of \u escape
+  uint8_t     _depth;
+  uint8_t     _escape;    // 0 = none, 1 = after '\', 2..5 = hex digits of \u
+  State       _state;
+  jsmntype_t  _type;
+  bool        _truncated;
+
+  bool parseChar(char c);
+  void appendChar(char c);
+  bool appendEscaped(char c);
+  bool openContainer(bool array);
+  bool closeContainer(bool array);
+  void emitValue(void);
+  void endValue(void);
+};
+
+#endif // __JSON_STREAM_PARSER__
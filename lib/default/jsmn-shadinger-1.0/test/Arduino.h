@@ -0,0 +1,35 @@
+/*
+  Arduino.h - minimal host shim to compile the parser on a PC for tests and benchmarks
+*/
+
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+
+#include <string>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#define PROGMEM
+#define PSTR(x)                 (x)
+#define pgm_read_byte(x)        (*(const uint8_t*)(x))
+#define strcmp_P(x, y)          strcmp(x, y)
+#define strcasecmp_P(x, y)      strcasecmp(x, y)
+#define snprintf_P              snprintf
+
+class __FlashStringHelper;
+
+class String : public std::string {
+public:
+  String(const char * s = "") : std::string(s ? s : "") {}
+  String(const __FlashStringHelper * s) : std::string((const char*)s) {}
+  void toLowerCase(void) { for (auto & c : *this) { c = tolower(c); } }
+  bool startsWith(const String & s) const { return rfind(s, 0) == 0; }
+  String & operator += (const char * s) { append(s); return *this; }
+  String & operator += (char c) { push_back(c); return *this; }
+};
+
+#endif // __HOST_ARDUINO_H__
@@ -0,0 +1,82 @@
+/*
+  bench-json.cpp - host benchmark of key lookup, linear search vs hash index
+
+  g++ -O2 -I. -o bench-json bench-json.cpp ../src/JsonParser.cpp ../src/jsmn.cpp && ./bench-json
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../src/JsonParser.h"
+
+#define BENCH_KEYS      60
+#define BENCH_LOOPS     2000
+
+static char json_template[2048];
+static char json_buf[2048];
+static char key_names[BENCH_KEYS][12];
+
+// object with many keys, every other value being a nested object to make skipping expensive
+static void build_payload(void) {
+  char * p = json_template;
+  p += sprintf(p, "{");
+  for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+    snprintf(key_names[i], sizeof(key_names[i]), "Key%02u", i);
+    if (i & 1) {
+      p += sprintf(p, "%s\"%s\":{\"a\":[%u,2],\"b\":1}", i ? "," : "", key_names[i], i);
+    } else {
+      p += sprintf(p, "%s\"%s\":%u", i ? "," : "", key_names[i], i);
+    }
+  }
+  sprintf(p, "}");
+}
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// parse and look up every key (lower case) once, returns the checksum of values
+static uint32_t run(uint8_t index_min, double * elapsed) {
+  uint32_t sum = 0;
+  double start = now_us();
+  for (uint32_t loop = 0; loop < BENCH_LOOPS; loop++) {
+    strcpy(json_buf, json_template);
+    JsonParser parser(json_buf);
+    parser.setIndexMin(index_min);
+    JsonParserObject root = parser.getRootObject();
+    for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+      char needle[12];
+      strcpy(needle, key_names[i]);
+      needle[0] = 'k';      // lookup is case-insensitive
+      JsonParserToken val = root[needle];
+      if (val.isObject()) {
+        sum += JsonParserObject(val)["A"].getArray()[0].getUInt();
+      } else {
+        sum += val.getUInt();
+      }
+    }
+    sum += root.getUInt("missing", 1);
+  }
+  *elapsed = now_us() - start;
+  return sum;
+}
+
+int main(int argc, char* argv[]) {
+  build_payload();
+  printf("Payload %u bytes, %u keys, %u loops\n", (uint32_t)strlen(json_template), BENCH_KEYS, BENCH_LOOPS);
+
+  double t_linear, t_index;
+  uint32_t sum_linear = run(0, &t_linear);
+  uint32_t sum_index = run(JSON_PARSER_INDEX_MIN, &t_index);
+
+  printf("linear search: %8.0f us, checksum %u\n", t_linear, sum_linear);
+  printf("hash index:    %8.0f us, checksum %u\n", t_index, sum_index);
+  if (sum_linear != sum_index) {
+    printf("ERROR: results differ\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+/*
+  test-stream.cpp - host test of JsonStreamParser, feeding documents one char at a time
+
+  g++ -I. -o test-stream test-stream.cpp ../src/JsonStreamParser.cpp ../src/JsonParser.cpp ../src/jsmn.cpp && ./test-stream
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/JsonStreamParser.h"
+
+static char events[1024];
+
+// log events as "path=value;" with path like "a.b[1]"
+static void test_cb(void * ctx, JsonStreamParser & parser, JsonStreamEvent event) {
+  char * p = events + strlen(events);
+  switch (event) {
+    case JSON_STREAM_OBJECT_START:  strcat(p, "{"); return;
+    case JSON_STREAM_OBJECT_END:    strcat(p, "}"); return;
+    case JSON_STREAM_ARRAY_START:   strcat(p, "["); return;
+    case JSON_STREAM_ARRAY_END:     strcat(p, "]"); return;
+    case JSON_STREAM_VALUE:         break;
+  }
+  for (uint32_t i = 0; i < parser.depth(); i++) {
+    if (parser.index(i) >= 0) {
+      p += sprintf(p, "[%d]", parser.index(i));
+    } else {
+      p += sprintf(p, "%s%s", i ? "." : "", parser.key(i));
+    }
+  }
+  sprintf(p, "=%s%s:%d;", parser.getStr(), parser.isTruncated() ? "~" : "", parser.getType());
+}
+
+static int errors = 0;
+
+static void check(const char * json, bool ok, const char * expected) {
+  events[0] = 0;
+  JsonStreamParser parser(test_cb, nullptr);
+  for (const char * p = json; *p; p++) {
+    parser.feed(p, 1);
+  }
+  bool res = parser.finish();
+  if ((res != ok) || (ok && strcmp(events, expected))) {
+    printf("FAIL %s\n  got %d '%s'\n  exp %d '%s'\n", json, res, events, ok, expected);
+    errors++;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  check("{\"Device\":\"0x9C33\",\"Illuminance\":42,\"Temp\":-1.5,\"On\":true,\"N\":null}", true,
+        "{Device=0x9C33:3;Illuminance=42:11;Temp=-1.5:9;On=true:8;N=null:6;}");
+  check(" { \"ZbReceived\" : { \"Prez\" : { \"A\" : [ 1 , -2 , \"x\" ] } } } ", true,
+        "{{{[ZbReceived.Prez.A[0]=1:11;ZbReceived.Prez.A[1]=-2:10;ZbReceived.Prez.A[2]=x:3;]}}}");
+  check("[[1,2],[],{}]", true, "[[[0][0]=1:11;[0][1]=2:11;][]{}]");
+  check("{\"s\":\"a\\\"b\\u00e9\\n\"}", true, "{s=a\"b\xc3\xa9\n:3;}");
+  check("42", true, "=42:11;");
+  check("{\"k\":\"0123456789012345678901234567890123456789012345678901234567890123456789\"}", true,
+        "{k=012345678901234567890123456789012345678901234567890123456789012~:3;}");
+  check("{\"a\":1,}", false, "");
+  check("{\"a\" 1}", false, "");
+  check("[1,2}", false, "");
+  check("{\"a\":[1,2]", false, "");
+  check("[[[[[[[[[1]]]]]]]]]", false, "");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
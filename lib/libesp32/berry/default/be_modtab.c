@@ -30,6 +30,9 @@ be_extern_native_module(cb);
 /* Tasmota specific */
 be_extern_native_module(python_compat);
 be_extern_native_module(re);
+#if !defined(TASMOTA) || defined(USE_MATTER_DEVICE)
+be_extern_native_module(matter_tlv);
+#endif
 be_extern_native_module(mqtt);
 be_extern_native_module(persist);
 be_extern_native_module(autoconf);
@@ -116,6 +119,9 @@ BERRY_LOCAL const bntvmodule_t* const be_module_table[] = {
     &be_native_module(undefined),
 
     &be_native_module(re),
+#if !defined(TASMOTA) || defined(USE_MATTER_DEVICE)
+    &be_native_module(matter_tlv),
+#endif
 #ifdef TASMOTA
     /* Berry extensions */
     &be_native_module(cb),
@@ -199,6 +199,36 @@
  **/
 #define BE_USE_DEBUG_GC                  0
 
+/* Macro: BE_USE_INCREMENTAL_GC
+ * Select the garbage collector.
+ * 0: stop-the-world mark and sweep, the whole heap is collected at once.
+ * 1: incremental collector, marking, destruction and sweeping are split
+ *    in bounded steps interleaved with allocations. Write barriers keep
+ *    track of objects modified while marking is in progress.
+ * Default: 0
+ **/
+#ifndef BE_USE_INCREMENTAL_GC
+#define BE_USE_INCREMENTAL_GC           0
+#endif
+
+/* Macro: BE_GC_STEP_BUDGET
+ * Amount of work done by each step of the incremental collector,
+ * roughly the number of objects scanned or swept per allocation.
+ * Default: 64
+ **/
+#ifndef BE_GC_STEP_BUDGET
+#define BE_GC_STEP_BUDGET               64
+#endif
+
+/* Macro: BE_GC_STEP_MICROS
+ * If not 0 and a microsecond timer is available, an incremental
+ * step also stops once it ran for this many microseconds.
+ * Default: 0
+ **/
+#ifndef BE_GC_STEP_MICROS
+#define BE_GC_STEP_MICROS               0
+#endif
+
 /* Macro: BE_USE_DEBUG_STACK
  * Enable Stack Resize debug mode. At each function call
  * the stack is reallocated at a different memory location
@@ -219,6 +249,29 @@
 #define BE_USE_MEM_ALIGNED               0
 #endif
 
+/* Macro: BE_MEMBER_CACHE_SIZE
+ * Number of entries in the VM member lookup cache, used by
+ * GETMBR, GETMET and SETMBR to skip walking the class chain.
+ * Must be a power of 2 not above 256, 0 disables the cache.
+ * Default: 32
+ **/
+#define BE_MEMBER_CACHE_SIZE             32
+
+/* Macro: BE_USE_COMPUTED_GOTO
+ * Dispatch VM instructions through a table of label addresses
+ * (GCC/Clang "labels as values") instead of a switch statement.
+ * Each instruction then jumps directly to the next handler.
+ * Only available with GCC compatible compilers.
+ * Default: 1 with GCC compatible compilers, 0 otherwise
+ **/
+#ifndef BE_USE_COMPUTED_GOTO
+#if defined(__GNUC__)
+#define BE_USE_COMPUTED_GOTO             1
+#else
+#define BE_USE_COMPUTED_GOTO             0
+#endif
+#endif
+
 /* Macro: BE_USE_XXX_MODULE
  * These macros control whether the related module is compiled.
  * When they are true, they will enable related modules. At this
@@ -70,6 +70,7 @@ static bclass* class_auto_make(bvm *vm, bstring *name, const bnfuncinfo *lib)
         var_setnil(res); /* must be initialized to ensure correct GC */
         c = be_newclass(vm, name, NULL);
         var_setclass(res, c);
+        be_gc_barrier(vm, vm->ntvclass); /* the class was created after the slot */
         class_init(vm, c, lib); /* bind members */
         return c;
     }
@@ -467,6 +468,7 @@ BERRY_API bbool be_setsuper(bvm *vm, int index)
         if (!gc_isconst(c)) {
             bclass *super = var_toobj(top);
             be_class_setsuper(c, super);
+            be_gc_barrier(vm, c);
             return btrue;
         }
     }
@@ -765,6 +767,7 @@ BERRY_API bbool be_setindex(bvm *vm, int index)
     }
     if (dst) {
         var_setval(dst, v);
+        be_gc_barrier(vm, var_toobj(o));
         return btrue;
     }
     return bfalse;
@@ -795,6 +798,7 @@ BERRY_API bbool be_setupval(bvm *vm, int index, int pos)
         be_assert(pos >= 0 && pos < nf->nupvals);
         uv = be_ntvclos_upval(nf, pos)->value;
         var_setval(uv, v);
+        be_gc_barrier_val(vm, uv);
         return btrue;
     }
     return bfalse;
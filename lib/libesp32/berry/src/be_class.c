@@ -20,6 +20,24 @@
         (c)->members = be_map_new(vm);  \
     }
 
+#if BE_MEMBER_CACHE_SIZE
+/* direct-mapped cache slot for a lookup of `name` starting from an instance of class `c` */
+/* pointers are mixed with a multiplicative hash since allocations are aligned */
+#define member_cache_slot(vm, c, name)  \
+    (&(vm)->mbrcache[(((uint32_t)((size_t)(c) ^ ((size_t)(name) >> 4)) * 2654435761u) >> 24) & (BE_MEMBER_CACHE_SIZE - 1)])
+#endif
+
+/* Invalidate all cached member lookups, must be called whenever a class members map */
+/* changes or when classes or strings may have been freed */
+void be_class_cache_flush(bvm *vm)
+{
+#if BE_MEMBER_CACHE_SIZE
+    memset(vm->mbrcache, 0, sizeof(vm->mbrcache));
+#else
+    (void)vm;
+#endif
+}
+
 bclass* be_newclass(bvm *vm, bstring *name, bclass *super)
 {
     bgcobject *gco = be_gcnew(vm, BE_CLASS, bclass);
@@ -60,6 +78,7 @@ int be_class_attribute(bvm *vm, bclass *c, bstring *attr)
 void be_class_member_bind(bvm *vm, bclass *c, bstring *name, bbool var)
 {
     bvalue *attr;
+    be_class_cache_flush(vm);
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -79,6 +98,7 @@ void be_class_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p, bbool is
 {
     bclosure *cl;
     bvalue *attr;
+    be_class_cache_flush(vm);
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -95,6 +115,7 @@ void be_class_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p, bbool is
 void be_class_native_method_bind(bvm *vm, bclass *c, bstring *name, bntvfunc f)
 {
     bvalue *attr;
+    be_class_cache_flush(vm);
     set_fixed(name);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
@@ -106,6 +127,7 @@ void be_class_native_method_bind(bvm *vm, bclass *c, bstring *name, bntvfunc f)
 void be_class_closure_method_bind(bvm *vm, bclass *c, bstring *name, bclosure *cl)
 {
     bvalue *attr;
+    be_class_cache_flush(vm);
     check_members(vm, c);
     attr = be_map_insertstr(vm, c->members, name, NULL);
     attr->v.gc = (bgcobject*) cl;
@@ -132,15 +154,43 @@ int be_class_closure_count(bclass *c)
 static binstance* instance_member(bvm *vm,
     binstance *obj, bstring *name, bvalue *dst)
 {
+#if BE_MEMBER_CACHE_SIZE
+    bmbrcache *entry = NULL;
+    const bclass *c = NULL;
+    int depth = 0;
+    if (obj) {
+        c = obj->_class;
+        entry = member_cache_slot(vm, c, name);
+        if (entry->c == c && entry->name == name) {
+            for (depth = entry->depth; depth > 0; --depth) {
+                obj = obj->super;
+            }
+            *dst = entry->value;
+#if BE_USE_PERF_COUNTERS
+            vm->counter_mbr_hit++;
+#endif
+            return obj;
+        }
+    }
+#endif
     for (; obj; obj = obj->super) {
         bmap *members = obj->_class->members;
         if (members) {
             bvalue *v = be_map_findstr(vm, members, name);
             if (v) {
                 *dst = *v;
+#if BE_MEMBER_CACHE_SIZE
+                entry->c = c; /* remember where the member was found */
+                entry->name = name;
+                entry->value = *v;
+                entry->depth = depth;
+#endif
                 return obj;
             }
         }
+#if BE_MEMBER_CACHE_SIZE
+        depth++;
+#endif
     }
     var_setnil(dst);
     return NULL;
@@ -324,6 +374,7 @@ bbool be_instance_setmember(bvm *vm, binstance *o, bstring *name, bvalue *src)
     binstance * obj = instance_member(vm, o, name, &v);
     if (obj && var_istype(&v, MT_VARIABLE)) {
         obj->members[var_toint(&v)] = *src;
+        be_gc_barrier(vm, obj);
         return btrue;
     } else {
         obj = instance_member(vm, o, str_literal(vm, "setmember"), &v);
@@ -366,6 +417,7 @@ bbool be_class_setmember(bvm *vm, bclass *o, bstring *name, bvalue *src)
     if (!gc_isconst(o)) {
         bclass * obj = class_member(vm, o, name, &v);
         if (obj && !var_istype(&v, MT_VARIABLE)) {
+            be_class_cache_flush(vm);
             be_map_insertstr(vm, obj->members, name, src);
             return btrue;
         }
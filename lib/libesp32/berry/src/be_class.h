@@ -51,6 +51,7 @@ struct binstance {
 
 bclass* be_newclass(bvm *vm, bstring *name, bclass *super);
 void be_class_compress(bvm *vm, bclass *c);
+void be_class_cache_flush(bvm *vm);
 int be_class_attribute(bvm *vm, bclass *c, bstring *attr);
 void be_class_member_bind(bvm *vm, bclass *c, bstring *name, bbool var);
 void be_class_method_bind(bvm *vm, bclass *c, bstring *name, bproto *p, bbool is_static);
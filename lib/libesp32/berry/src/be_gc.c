@@ -33,6 +33,19 @@
     (vm)->gc.gray = gc_object(obj); \
 }
 
+#if BE_USE_INCREMENTAL_GC
+/* Phases of the incremental collector, see `gc_step()` */
+#define GC_PHASE_IDLE       0 /* no collection in progress */
+#define GC_PHASE_MARK       1 /* scanning gray objects, write barriers are active */
+#define GC_PHASE_DESTRUCT   2 /* calling `deinit` of unreachable instances */
+#define GC_PHASE_SWEEP      3 /* freeing unreachable objects */
+
+#define link_grayagain(vm, obj)   {     \
+    (obj)->gray = (vm)->gc.grayagain;   \
+    (vm)->gc.grayagain = gc_object(obj);\
+}
+#endif
+
 static void destruct_object(bvm *vm, bgcobject *obj);
 static void free_object(bvm *vm, bgcobject *obj);
 
@@ -49,6 +62,16 @@ void be_gc_deleteall(bvm *vm)
     bgcobject *node, *next;
     /* halt GC and delete all objects */
     vm->gc.status |= GC_HALT;
+#if BE_USE_INCREMENTAL_GC
+    if (vm->gc.sweep) { /* a cycle was interrupted, give back the objects being swept */
+        bgcobject **tail = &vm->gc.list;
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        *tail = vm->gc.sweep;
+        vm->gc.sweep = NULL;
+    }
+#endif
     /* first: call destructor */
     for (node = vm->gc.list; node; node = node->next) {
         destruct_object(vm, node);
@@ -89,6 +112,11 @@ bgcobject* be_newgcobj(bvm *vm, int type, size_t size)
     obj->marked = GC_WHITE; /* default gc object type is white */
     obj->next = vm->gc.list; /* link to the next field */
     vm->gc.list = obj; /* insert to head */
+#if BE_USE_INCREMENTAL_GC
+    if (obj->next == NULL) {
+        vm->gc.newtail = obj; /* first object allocated since `list` was detached */
+    }
+#endif
     return obj;
 }
 
@@ -102,6 +130,11 @@ bgcobject* be_gc_newstr(bvm *vm, size_t size, int islong)
     be_gc_auto(vm);
     var_settype(obj, BE_STRING); /* mark the object type to BE_STRING */
     obj->marked = GC_WHITE; /* default string type is white */
+#if BE_USE_INCREMENTAL_GC
+    if (vm->gc.phase > GC_PHASE_MARK) {
+        obj->marked = GC_DARK; /* marking is over, don't let the string table sweep free it */
+    }
+#endif
     return obj;
 }
 
@@ -496,6 +529,7 @@ static void destruct_object(bvm *vm, bgcobject *obj)
     }
 }
 
+#if !BE_USE_INCREMENTAL_GC
 static void destruct_white(bvm *vm)
 {
     bgcobject *node = vm->gc.list;
@@ -533,6 +567,8 @@ static void delete_white(bvm *vm)
     }
 }
 
+#endif
+
 static void reset_fixedlist(bvm *vm)
 {
     bgcobject *node;
@@ -543,13 +579,6 @@ static void reset_fixedlist(bvm *vm)
     }
 }
 
-void be_gc_auto(bvm *vm)
-{
-    if (vm->gc.status & GC_PAUSE && (BE_USE_DEBUG_GC || vm->gc.usage > vm->gc.threshold || comp_is_gc_debug(vm))) {
-        be_gc_collect(vm);
-    }
-}
-
 size_t be_gc_memcount(bvm *vm)
 {
     return vm->gc.usage;
@@ -561,6 +590,8 @@ size_t be_gc_memcount(bvm *vm)
 #define GC_TIMER(i)
 #endif
 
+#if !BE_USE_INCREMENTAL_GC
+
 void be_gc_collect(bvm *vm)
 {
     if (vm->gc.status & GC_HALT) {
@@ -589,6 +620,7 @@ void be_gc_collect(bvm *vm)
     destruct_white(vm);
     delete_white(vm);
     be_gcstrtab(vm);
+    be_class_cache_flush(vm); /* cached classes or names may have been freed */
     GC_TIMER(3);
     /* step 4: reset the fixed objects */
     reset_fixedlist(vm);
@@ -607,3 +639,248 @@ void be_gc_collect(bvm *vm)
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage);
 #endif
 }
+
+void be_gc_auto(bvm *vm)
+{
+    if (vm->gc.status & GC_PAUSE && (BE_USE_DEBUG_GC || vm->gc.usage > vm->gc.threshold || comp_is_gc_debug(vm))) {
+        be_gc_collect(vm);
+    }
+}
+
+#else /* BE_USE_INCREMENTAL_GC */
+
+/* Incremental collector
+ * A cycle goes through the following phases, each one is split in steps of bounded work
+ * that are run from `be_gc_auto()`, i.e. interleaved with allocations:
+ * - GC_PHASE_MARK: objects reachable from the VM internals and global variables are scanned.
+ *   The write barrier pushes back to `grayagain` any scanned (dark) object that is modified.
+ *   The stack is not scanned since it changes all the time.
+ * - atomic step: the stack, the trace stack, fixed objects and `grayagain` are scanned and
+ *   marking is completed. The object list is detached to `sweep`, objects allocated from now
+ *   on go to a new list and are not part of this cycle.
+ * - GC_PHASE_DESTRUCT: `deinit` is called for unreachable instances.
+ * - GC_PHASE_SWEEP: unreachable objects are freed and others are reset to white.
+ *   The short strings table is swept at the end of this phase.
+ */
+
+/* `obj` has been modified, if it was already scanned it needs to be scanned again */
+void be_gc_barrier(bvm *vm, void *p)
+{
+    bgcobject *obj = gc_object(p);
+    if (vm->gc.phase == GC_PHASE_MARK && obj && gc_isdark(obj) && !gc_isconst(obj)) {
+        gc_setgray(obj);
+        switch (var_primetype(obj)) {
+        case BE_CLASS: link_grayagain(vm, cast_class(obj)); break;
+        case BE_PROTO: link_grayagain(vm, cast_proto(obj)); break;
+        case BE_INSTANCE: link_grayagain(vm, cast_instance(obj)); break;
+        case BE_MAP: link_grayagain(vm, cast_map(obj)); break;
+        case BE_LIST: link_grayagain(vm, cast_list(obj)); break;
+        case BE_CLOSURE: link_grayagain(vm, cast_closure(obj)); break;
+        case BE_NTVCLOS: link_grayagain(vm, cast_ntvclos(obj)); break;
+        case BE_MODULE: link_grayagain(vm, cast_module(obj)); break;
+        default: gc_setmark(obj, GC_DARK); break; /* no references to other objects */
+        }
+    }
+}
+
+/* `value` has been stored in an object that can't be tracked by `be_gc_barrier()` (upvalues) */
+void be_gc_barrier_val(bvm *vm, bvalue *value)
+{
+    if (vm->gc.phase == GC_PHASE_MARK) {
+        mark_gray_var(vm, value);
+    }
+}
+
+/* an existing short string is handed back to the VM, once marking is over */
+/* it must survive the sweep of the strings table */
+void be_gc_keepstr(bvm *vm, bstring *s)
+{
+    if (vm->gc.phase > GC_PHASE_MARK && gc_iswhite(s)) {
+        gc_setmark(s, GC_DARK);
+    }
+}
+
+static void gc_cycle_start(bvm *vm)
+{
+#if BE_USE_PERF_COUNTERS
+    vm->counter_gc_kept = 0;
+    vm->counter_gc_freed = 0;
+    vm->micros_gc_step = 0;
+    be_gc_memory_pools_info(vm, &vm->gc_slots_used, &vm->gc_slots_allocated);
+#endif
+    if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_START, vm->gc.usage);
+    GC_TIMER(0);
+    mark_gray_reset_counters(vm); /* reset all internal counters */
+    premark_internal(vm); /* object internal the VM */
+    premark_global(vm); /* global objects */
+    vm->gc.phase = GC_PHASE_MARK;
+}
+
+/* scan one gray object, return the amount of work done */
+static int gc_propagate(bvm *vm)
+{
+    bgcobject *obj = vm->gc.gray;
+    int work = 1;
+    if (!gc_isdark(obj) && !gc_isconst(obj)) {
+        gc_setdark(obj);
+        switch (var_primetype(obj)) {
+        case BE_CLASS: mark_class(vm, obj); break;
+        case BE_PROTO: mark_proto(vm, obj); work += cast_proto(obj)->nconst >> 3; break;
+        case BE_INSTANCE: mark_instance(vm, obj); work += be_instance_member_count(cast_instance(obj)) >> 3; break;
+        case BE_MAP: mark_map(vm, obj); work += be_map_size(cast_map(obj)) >> 3; break;
+        case BE_LIST: mark_list(vm, obj); work += be_list_count(cast_list(obj)) >> 3; break;
+        case BE_CLOSURE: mark_closure(vm, obj); break;
+        case BE_NTVCLOS: mark_ntvclos(vm, obj); break;
+        case BE_MODULE: mark_module(vm, obj); break;
+        default:
+            be_assert(0); /* error */
+            break;
+        }
+    }
+    return work;
+}
+
+/* complete marking in one go, then prepare the destruct and sweep phases */
+static void gc_atomic(bvm *vm)
+{
+    GC_TIMER(1);
+    premark_internal(vm); /* roots may have changed since the start of the cycle */
+    premark_global(vm);
+    premark_stack(vm); /* stack objects */
+    premark_tracestack(vm); /* trace stack objects */
+    premark_fixed(vm); /* fixed objects */
+    mark_unscanned(vm);
+    vm->gc.gray = vm->gc.grayagain; /* objects modified after being scanned */
+    vm->gc.grayagain = NULL;
+    mark_unscanned(vm);
+    GC_TIMER(2);
+    vm->gc.sweep = vm->gc.list; /* detach the objects of this cycle */
+    vm->gc.list = NULL;
+    vm->gc.sweeppos = &vm->gc.sweep;
+    vm->gc.phase = GC_PHASE_DESTRUCT;
+}
+
+static void gc_cycle_end(bvm *vm)
+{
+    if (vm->gc.list) { /* objects allocated during the cycle stay in front, newest first */
+        vm->gc.newtail->next = vm->gc.sweep;
+    } else {
+        vm->gc.list = vm->gc.sweep;
+    }
+    vm->gc.sweep = NULL;
+    vm->gc.sweeppos = NULL;
+    vm->gc.phase = GC_PHASE_IDLE;
+    be_gcstrtab(vm);
+    be_class_cache_flush(vm); /* cached classes or names may have been freed */
+    GC_TIMER(3);
+    reset_fixedlist(vm);
+    GC_TIMER(4);
+    vm->gc.threshold = next_threshold(vm->gc);
+    be_gc_memory_pools(vm); /* free unsued memory pools */
+    GC_TIMER(5);
+#if BE_USE_PERF_COUNTERS
+    size_t slots_used_after_gc, slots_allocated_after_gc;
+    be_gc_memory_pools_info(vm, &slots_used_after_gc, &slots_allocated_after_gc);
+    if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->counter_gc_kept, vm->counter_gc_freed,
+                                            vm->gc_slots_used, vm->gc_slots_allocated,
+                                            slots_used_after_gc, slots_allocated_after_gc);
+#else
+    if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage);
+#endif
+}
+
+/* Run the collector for `budget` units of work, or until the end of the cycle if `budget` is negative */
+static void gc_step(bvm *vm, int budget)
+{
+    int work = 0;
+    bbool freed = bfalse;
+    uint32_t start = vm->microsfnct ? vm->microsfnct() : 0;
+    vm->gc.status |= GC_HALT; /* no recursive collection, destructors may allocate */
+    while (vm->gc.phase != GC_PHASE_IDLE && (budget < 0 || work < budget)) {
+        if (vm->gc.phase == GC_PHASE_MARK) {
+            if (vm->gc.gray) {
+                work += gc_propagate(vm);
+            } else {
+                gc_atomic(vm);
+            }
+        } else {
+            bgcobject *node = *vm->gc.sweeppos;
+            if (node == NULL) { /* end of the list */
+                if (vm->gc.phase == GC_PHASE_DESTRUCT) {
+                    vm->gc.sweeppos = &vm->gc.sweep;
+                    vm->gc.phase = GC_PHASE_SWEEP;
+                } else {
+                    gc_cycle_end(vm);
+                    freed = btrue;
+                }
+            } else if (vm->gc.phase == GC_PHASE_DESTRUCT) {
+                if (gc_iswhite(node) && node->type == BE_INSTANCE) {
+                    destruct_object(vm, node);
+                    work += 4;
+                }
+                vm->gc.sweeppos = &node->next;
+            } else if (gc_iswhite(node)) {
+                *vm->gc.sweeppos = node->next;
+                free_object(vm, node);
+                freed = btrue;
+#if BE_USE_PERF_COUNTERS
+                vm->counter_gc_freed++;
+#endif
+            } else {
+                gc_setwhite(node);
+                vm->gc.sweeppos = &node->next;
+            }
+            work++;
+        }
+#if BE_GC_STEP_MICROS
+        if (budget >= 0 && vm->microsfnct && (work & 0x1F) == 0 &&
+            vm->microsfnct() - start > BE_GC_STEP_MICROS) {
+            break;
+        }
+#endif
+    }
+    vm->gc.status &= ~GC_HALT;
+    if (freed) {
+        be_class_cache_flush(vm); /* freed classes or strings may be reused by new objects */
+    }
+#if BE_USE_PERF_COUNTERS
+    if (vm->microsfnct) {
+        uint32_t elapsed = vm->microsfnct() - start;
+        if (elapsed > vm->micros_gc_step) {
+            vm->micros_gc_step = elapsed;
+        }
+    }
+#else
+    (void)start;
+#endif
+}
+
+void be_gc_auto(bvm *vm)
+{
+    if ((vm->gc.status & GC_PAUSE) && !(vm->gc.status & GC_HALT)) {
+        if (vm->gc.phase == GC_PHASE_IDLE) {
+            if (BE_USE_DEBUG_GC || vm->gc.usage > vm->gc.threshold || comp_is_gc_debug(vm)) {
+                gc_cycle_start(vm);
+            } else {
+                return;
+            }
+        }
+        /* in debug mode do the smallest possible steps, to stress the write barriers */
+        gc_step(vm, (BE_USE_DEBUG_GC || comp_is_gc_debug(vm)) ? 1 : BE_GC_STEP_BUDGET);
+    }
+}
+
+/* Full collection: complete the current cycle if any, then run a complete new one */
+void be_gc_collect(bvm *vm)
+{
+    if (vm->gc.status & GC_HALT) {
+        return; /* the GC cannot run for some reason */
+    }
+    if (vm->gc.phase != GC_PHASE_IDLE) {
+        gc_step(vm, -1);
+    }
+    gc_cycle_start(vm);
+    gc_step(vm, -1);
+}
+
+#endif /* BE_USE_INCREMENTAL_GC */
@@ -76,4 +76,14 @@ bbool be_gc_fix_set(bvm *vm, bgcobject *obj, bbool fix);
 void be_gc_collect(bvm *vm);
 void be_gc_auto(bvm *vm);
 
+#if BE_USE_INCREMENTAL_GC
+void be_gc_barrier(bvm *vm, void *obj);
+void be_gc_barrier_val(bvm *vm, bvalue *value);
+void be_gc_keepstr(bvm *vm, bstring *s);
+#else
+#define be_gc_barrier(vm, obj)          ((void)0)
+#define be_gc_barrier_val(vm, value)    ((void)0)
+#define be_gc_keepstr(vm, s)            ((void)0)
+#endif
+
 #endif
@@ -77,6 +77,7 @@ bvalue* be_list_push(bvm *vm, blist *list, bvalue *value)
     if (value != NULL) {
         *slot = *value;
     }
+    be_gc_barrier(vm, list);
     return slot;
 }
 
@@ -104,6 +105,7 @@ bvalue* be_list_insert(bvm *vm, blist *list, int index, bvalue *value)
     if (value != NULL) {
         *data = *value;
     }
+    be_gc_barrier(vm, list);
     return data;
 }
 
@@ -159,6 +161,7 @@ void be_list_merge(bvm *vm, blist *list, const blist *other)
         }
         memcpy(list->data + dst_len, other->data, src_len * sizeof(bvalue));
         list->count = length;
+        be_gc_barrier(vm, list);
     }
 }
 
@@ -193,6 +196,7 @@ int be_list_pool_alloc(bvm *vm, blist *list, bvalue *src)
         node = be_list_push(vm, list, NULL);
     }
     *node = *src;
+    be_gc_barrier(vm, list);
     return id;
 }
 
@@ -266,6 +266,7 @@ bvalue* be_map_insert(bvm *vm, bmap *map, bvalue *key, bvalue *value)
     if (value) {
         entry->value = *value;
     }
+    be_gc_barrier(vm, map);
     return value(entry);
 }
 
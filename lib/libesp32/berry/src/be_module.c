@@ -364,6 +364,7 @@ bbool be_module_setmember(bvm *vm, bmodule *module, bstring *attr, bvalue *src)
         }
         if (v) {
             *v = *src;
+            be_gc_barrier(vm, attrs);
             return btrue;
         }
     } else {
@@ -442,6 +443,7 @@ BERRY_API void be_module_path_set(bvm *vm, const char *path)
     bvalue *value = be_list_push(vm, list, NULL);
     var_setnil(value);
     var_setstr(value, be_newstr(vm, path))
+    be_gc_barrier(vm, list);
 }
 
 /* shared library support */
@@ -9,6 +9,7 @@
 #include "be_vm.h"
 #include "be_mem.h"
 #include "be_constobj.h"
+#include "be_gc.h"
 #include <string.h>
 
 #define next(_s)    cast(void*, cast(bstring*, (_s)->next))
@@ -201,6 +202,7 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 
     for (s = *list; s != NULL; s = next(s)) {
         if (len == s->slen && !strncmp(str, sstr(s), len)) {
+            be_gc_keepstr(vm, s);
             return s;
         }
     }
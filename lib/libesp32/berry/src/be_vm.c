@@ -65,12 +65,37 @@
   #define VM_HEARTBEAT()
 #endif
 
-#define vm_exec_loop() \
+#if BE_USE_COMPUTED_GOTO
+  /* each handler jumps to the next one through `dispatch_table` */
+  #define dispatch() { \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        VM_HEARTBEAT(); \
+        goto *dispatch_table[IGET_OP(ins = *vm->ip++)]; \
+    }
+  #define vm_exec_loop()    dispatch();
+  #define opcase(opcode)    L_##opcode
+#else
+  #define vm_exec_loop() \
     loop: \
         DEBUG_HOOK(); \
         COUNTER_HOOK(); \
         VM_HEARTBEAT(); \
         switch (IGET_OP(ins = *vm->ip++))
+  #define opcase(opcode)    case OP_##opcode
+  #define dispatch()        goto loop
+#endif
+
+/* an instruction executed as part of the previous one (fused pair) */
+/* still counts, but fusing is disabled when the line hook is active */
+#if BE_USE_DEBUG_HOOK
+  #define can_fuse()        (!(vm->hookmask & BE_HOOK_LINE))
+#else
+  #define can_fuse()        1
+#endif
+#define FUSED_HOOK() \
+    COUNTER_HOOK(); \
+    VM_HEARTBEAT();
 
 #if BE_USE_SINGLE_FLOAT
   #define mathfunc(func)    func##f
@@ -78,8 +103,6 @@
   #define mathfunc(func)    func
 #endif
 
-#define opcase(opcode)      case OP_##opcode
-#define dispatch()          goto loop
 
 #define equal_rule(op, iseq) \
     bbool res; \
@@ -158,6 +181,29 @@
         return res
 #endif // ESP32
 
+/* compare, then if the next instruction is a conditional jump */
+/* on the result, take it now instead of dispatching it */
+#define relop_block(op, func) \
+    bvalue *a = RKB(), *b = RKC(); \
+    bbool res; \
+    binstruction next; \
+    if (var_isint(a) && var_isint(b)) { \
+        res = ibinop(op, a, b); \
+    } else { \
+        res = func(vm, a, b); \
+        reg = vm->reg; \
+    } \
+    var_setbool(RA(), res); \
+    next = *vm->ip; \
+    if ((IGET_OP(next) == OP_JMPF || IGET_OP(next) == OP_JMPT) && \
+            IGET_RA(next) == IGET_RA(ins) && can_fuse()) { \
+        FUSED_HOOK(); \
+        vm->ip++; \
+        if ((IGET_OP(next) == OP_JMPT) == (res != 0)) { \
+            vm->ip += IGET_sBx(next); \
+        } \
+    }
+
 #define bitwise_block(op) \
     bvalue *dst = RA(), *a = RKB(), *b = RKC(); \
     if (var_isint(a) && var_isint(b)) { \
@@ -507,6 +553,7 @@ BERRY_API bvm* be_vm_new(void)
     vm->counter_call = 0;
     vm->counter_get = 0;
     vm->counter_set = 0;
+    vm->counter_mbr_hit = 0;
     vm->counter_get_global = 0;
     vm->counter_try = 0;
     vm->counter_exc = 0;
@@ -544,6 +591,13 @@ static void vm_exec(bvm *vm)
     bclosure *clos;
     bvalue *ktab, *reg;
     binstruction ins;
+#if BE_USE_COMPUTED_GOTO
+    static const void *const dispatch_table[] = {
+        #define OPCODE(opc) &&L_##opc
+        #include "be_opcodes.h"
+        #undef OPCODE
+    };
+#endif
     vm->cf->status |= BASE_FRAME;
 newframe: /* a new call frame */
     be_assert(var_isclosure(vm->cf->func));
@@ -568,7 +622,23 @@ newframe: /* a new call frame */
         }
         opcase(LDINT): {
             bvalue *v = RA();
+            binstruction next = *vm->ip;
             var_setint(v, IGET_sBx(ins));
+            /* `x + n` and `x - n` load `n` first, do the integer operation right away */
+            if ((IGET_OP(next) == OP_ADD || IGET_OP(next) == OP_SUB) &&
+                    IGET_RKC(next) == IGET_RA(ins) && can_fuse()) {
+                bvalue *a = (isKB(next) ? ktab : reg) + KR2idx(IGET_RKB(next));
+                if (var_isint(a)) {
+                    bvalue *dst = reg + IGET_RA(next);
+                    if (IGET_OP(next) == OP_ADD) {
+                        var_setint(dst, ibinop(+, a, v));
+                    } else {
+                        var_setint(dst, ibinop(-, a, v));
+                    }
+                    FUSED_HOOK();
+                    vm->ip++;
+                }
+            }
             dispatch();
         }
         opcase(LDCONST): {
@@ -631,6 +701,7 @@ newframe: /* a new call frame */
             int idx = IGET_Bx(ins);
             be_assert(*clos->upvals != NULL);
             *clos->upvals[idx]->value = *v;
+            be_gc_barrier_val(vm, v);
             dispatch();
         }
         opcase(MOVE): {
@@ -777,51 +848,27 @@ newframe: /* a new call frame */
             dispatch();
         }
         opcase(LT): {
-            bbool res = be_vm_islt(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(<, be_vm_islt);
             dispatch();
         }
         opcase(LE): {
-            bbool res = be_vm_isle(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(<=, be_vm_isle);
             dispatch();
         }
         opcase(EQ): {
-            bbool res = be_vm_iseq(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(==, be_vm_iseq);
             dispatch();
         }
         opcase(NE): {
-            bbool res = be_vm_isneq(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(!=, be_vm_isneq);
             dispatch();
         }
         opcase(GT): {
-            bbool res = be_vm_isgt(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(>, be_vm_isgt);
             dispatch();
         }
         opcase(GE): {
-            bbool res = be_vm_isge(vm, RKB(), RKC());
-            bvalue *dst;
-            reg = vm->reg;
-            dst = RA();
-            var_setbool(dst, res);
+            relop_block(>=, be_vm_isge);
             dispatch();
         }
         opcase(CONNECT): {
@@ -1096,6 +1143,7 @@ newframe: /* a new call frame */
                 bclass *obj = var_toobj(a);
                 if (!gc_isconst(obj))  {
                    be_class_setsuper(obj, var_toobj(b));
+                   be_gc_barrier(vm, obj);
                 } else {
                     vm_error(vm, "internal_error",
                     "cannot change superclass of a read-only class");
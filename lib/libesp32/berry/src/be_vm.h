@@ -63,6 +63,13 @@ struct bgc {
     size_t threshold; /* he threshold of allocation for the next GC */
     bbyte steprate; /* the rate of increase in the distribution between two GCs (percentage) */
     bbyte status;
+#if BE_USE_INCREMENTAL_GC
+    bbyte phase; /* current phase of the incremental collector */
+    bgcobject *grayagain; /* objects modified after being scanned, rescanned in the atomic phase */
+    bgcobject *sweep; /* objects being destructed or swept, detached from `list` */
+    bgcobject **sweeppos; /* cursor in the `sweep` list */
+    bgcobject *newtail; /* last object of `list` while `sweep` is in use */
+#endif
 };
 
 struct bstringtable {
@@ -90,6 +97,15 @@ struct bupval {
     int refcnt;
 };
 
+#if BE_MEMBER_CACHE_SIZE
+typedef struct {
+    const bclass *c; /* class of the instance where lookup started, NULL if empty */
+    const bstring *name; /* member name */
+    bvalue value; /* value found in the class members map */
+    int depth; /* number of super instances to walk to reach the member */
+} bmbrcache;
+#endif
+
 struct bvm {
     bglobaldesc gbldesc; /* global description */
     bvalue *stack; /* stack space */
@@ -113,12 +129,16 @@ struct bvm {
     int32_t bytesmaxsize; /* max allowed size for bytes() object, default 32kb but can be increased */
     bobshook obshook;
     bmicrosfnct microsfnct; /* fucntion to get time as a microsecond resolution */
+#if BE_MEMBER_CACHE_SIZE
+    bmbrcache mbrcache[BE_MEMBER_CACHE_SIZE]; /* member lookup cache, flushed on GC or class change */
+#endif
 #if BE_USE_PERF_COUNTERS
     uint32_t counter_ins; /* instructions counter */
     uint32_t counter_enter; /* counter for times the VM was entered */
     uint32_t counter_call; /* counter for calls, VM or native */
     uint32_t counter_get; /* counter for GETMBR or GETMET */
     uint32_t counter_set; /* counter for SETMBR */
+    uint32_t counter_mbr_hit; /* counter for member lookups served by the member cache */
     uint32_t counter_get_global; /* counter for GETNBGL */
     uint32_t counter_try; /* counter for `try` statement */
     uint32_t counter_exc; /* counter for raised exceptions */
@@ -134,6 +154,9 @@ struct bvm {
     uint32_t micros_gc3;
     uint32_t micros_gc4;
     uint32_t micros_gc5;
+    uint32_t micros_gc_step; /* longest incremental GC step of the last cycle */
+    size_t gc_slots_used; /* memory pools usage at the start of the incremental GC cycle */
+    size_t gc_slots_allocated;
 
     uint32_t gc_mark_string;
     uint32_t gc_mark_class;
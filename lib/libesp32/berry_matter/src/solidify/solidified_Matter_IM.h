@@ -1751,103 +1751,77 @@ be_local_closure(Matter_IM_send_subscribe_update,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[25]) {     /* constants */
+    ( &(const bvalue[21]) {     /* constants */
     /* K0   */  be_nested_str_weak(session),
     /* K1   */  be_nested_str_weak(matter),
     /* K2   */  be_nested_str_weak(ReadRequestMessage),
     /* K3   */  be_nested_str_weak(fabric_filtered),
     /* K4   */  be_nested_str_weak(attributes_requests),
     /* K5   */  be_nested_str_weak(updates),
-    /* K6   */  be_nested_str_weak(AttributePathIB),
-    /* K7   */  be_nested_str_weak(endpoint),
-    /* K8   */  be_nested_str_weak(cluster),
-    /* K9   */  be_nested_str_weak(attribute),
-    /* K10  */  be_nested_str_weak(push),
-    /* K11  */  be_nested_str_weak(stop_iteration),
-    /* K12  */  be_nested_str_weak(tasmota),
-    /* K13  */  be_nested_str_weak(log),
-    /* K14  */  be_nested_str_weak(MTR_X3A_X20_X3CSub_Data_X20_X20_X28_X256i_X29_X20sub_X3D_X25i),
-    /* K15  */  be_nested_str_weak(local_session_id),
-    /* K16  */  be_nested_str_weak(subscription_id),
-    /* K17  */  be_const_int(3),
-    /* K18  */  be_nested_str_weak(is_keep_alive),
-    /* K19  */  be_nested_str_weak(_inner_process_read_request),
-    /* K20  */  be_nested_str_weak(suppress_response),
-    /* K21  */  be_nested_str_weak(IM_ReportDataSubscribed),
-    /* K22  */  be_nested_str_weak(_message_handler),
-    /* K23  */  be_nested_str_weak(send_queue),
-    /* K24  */  be_nested_str_weak(send_enqueued),
+    /* K6   */  be_nested_str_weak(tasmota),
+    /* K7   */  be_nested_str_weak(log),
+    /* K8   */  be_nested_str_weak(MTR_X3A_X20_X3CSub_Data_X20_X20_X28_X256i_X29_X20sub_X3D_X25i),
+    /* K9   */  be_nested_str_weak(local_session_id),
+    /* K10  */  be_nested_str_weak(subscription_id),
+    /* K11  */  be_const_int(3),
+    /* K12  */  be_nested_str_weak(is_keep_alive),
+    /* K13  */  be_nested_str_weak(_inner_process_read_request),
+    /* K14  */  be_nested_str_weak(subs_shop),
+    /* K15  */  be_nested_str_weak(suppress_response),
+    /* K16  */  be_nested_str_weak(IM_ReportDataSubscribed),
+    /* K17  */  be_nested_str_weak(_message_handler),
+    /* K18  */  be_nested_str_weak(send_queue),
+    /* K19  */  be_nested_str_weak(push),
+    /* K20  */  be_nested_str_weak(send_enqueued),
     }),
     be_str_weak(send_subscribe_update),
     &be_const_str_solidified,
-    ( &(const binstruction[67]) {  /* code */
+    ( &(const binstruction[45]) {  /* code */
       0x88080300,  //  0000  GETMBR	R2	R1	K0
       0xB80E0200,  //  0001  GETNGBL	R3	K1
       0x8C0C0702,  //  0002  GETMET	R3	R3	K2
       0x7C0C0200,  //  0003  CALL	R3	1
       0x50100000,  //  0004  LDBOOL	R4	0	0
       0x900E0604,  //  0005  SETMBR	R3	K3	R4
-      0x60100012,  //  0006  GETGBL	R4	G18
-      0x7C100000,  //  0007  CALL	R4	0
-      0x900E0804,  //  0008  SETMBR	R3	K4	R4
-      0x60100010,  //  0009  GETGBL	R4	G16
-      0x88140305,  //  000A  GETMBR	R5	R1	K5
-      0x7C100200,  //  000B  CALL	R4	1
-      0xA802000F,  //  000C  EXBLK	0	#001D
-      0x5C140800,  //  000D  MOVE	R5	R4
-      0x7C140000,  //  000E  CALL	R5	0
-      0xB81A0200,  //  000F  GETNGBL	R6	K1
-      0x8C180D06,  //  0010  GETMET	R6	R6	K6
-      0x7C180200,  //  0011  CALL	R6	1
-      0x881C0B07,  //  0012  GETMBR	R7	R5	K7
-      0x901A0E07,  //  0013  SETMBR	R6	K7	R7
-      0x881C0B08,  //  0014  GETMBR	R7	R5	K8
-      0x901A1007,  //  0015  SETMBR	R6	K8	R7
-      0x881C0B09,  //  0016  GETMBR	R7	R5	K9
-      0x901A1207,  //  0017  SETMBR	R6	K9	R7
-      0x881C0704,  //  0018  GETMBR	R7	R3	K4
-      0x8C1C0F0A,  //  0019  GETMET	R7	R7	K10
-      0x5C240C00,  //  001A  MOVE	R9	R6
-      0x7C1C0400,  //  001B  CALL	R7	2
-      0x7001FFEF,  //  001C  JMP		#000D
-      0x5810000B,  //  001D  LDCONST	R4	K11
-      0xAC100200,  //  001E  CATCH	R4	1	0
-      0xB0080000,  //  001F  RAISE	2	R0	R0
-      0xB8121800,  //  0020  GETNGBL	R4	K12
-      0x8C10090D,  //  0021  GETMET	R4	R4	K13
-      0x60180018,  //  0022  GETGBL	R6	G24
-      0x581C000E,  //  0023  LDCONST	R7	K14
-      0x8820050F,  //  0024  GETMBR	R8	R2	K15
-      0x88240310,  //  0025  GETMBR	R9	R1	K16
-      0x7C180600,  //  0026  CALL	R6	3
-      0x581C0011,  //  0027  LDCONST	R7	K17
-      0x7C100600,  //  0028  CALL	R4	3
-      0x50100000,  //  0029  LDBOOL	R4	0	0
-      0x90062404,  //  002A  SETMBR	R1	K18	R4
-      0x8C100113,  //  002B  GETMET	R4	R0	K19
-      0x5C180400,  //  002C  MOVE	R6	R2
-      0x5C1C0600,  //  002D  MOVE	R7	R3
-      0x4C200000,  //  002E  LDNIL	R8
-      0x7C100800,  //  002F  CALL	R4	4
-      0x50140000,  //  0030  LDBOOL	R5	0	0
-      0x90122805,  //  0031  SETMBR	R4	K20	R5
-      0x88140310,  //  0032  GETMBR	R5	R1	K16
-      0x90122005,  //  0033  SETMBR	R4	K16	R5
-      0xB8160200,  //  0034  GETNGBL	R5	K1
-      0x8C140B15,  //  0035  GETMET	R5	R5	K21
-      0x881C0516,  //  0036  GETMBR	R7	R2	K22
-      0x5C200400,  //  0037  MOVE	R8	R2
-      0x5C240800,  //  0038  MOVE	R9	R4
-      0x5C280200,  //  0039  MOVE	R10	R1
-      0x7C140A00,  //  003A  CALL	R5	5
-      0x88180117,  //  003B  GETMBR	R6	R0	K23
-      0x8C180D0A,  //  003C  GETMET	R6	R6	K10
-      0x5C200A00,  //  003D  MOVE	R8	R5
-      0x7C180400,  //  003E  CALL	R6	2
-      0x8C180118,  //  003F  GETMET	R6	R0	K24
-      0x88200516,  //  0040  GETMBR	R8	R2	K22
-      0x7C180400,  //  0041  CALL	R6	2
-      0x80000000,  //  0042  RET	0
+      0x88100305,  //  0006  GETMBR	R4	R1	K5
+      0x900E0804,  //  0007  SETMBR	R3	K4	R4
+      0xB8120C00,  //  0008  GETNGBL	R4	K6
+      0x8C100907,  //  0009  GETMET	R4	R4	K7
+      0x60180018,  //  000A  GETGBL	R6	G24
+      0x581C0008,  //  000B  LDCONST	R7	K8
+      0x88200509,  //  000C  GETMBR	R8	R2	K9
+      0x8824030A,  //  000D  GETMBR	R9	R1	K10
+      0x7C180600,  //  000E  CALL	R6	3
+      0x581C000B,  //  000F  LDCONST	R7	K11
+      0x7C100600,  //  0010  CALL	R4	3
+      0x50100000,  //  0011  LDBOOL	R4	0	0
+      0x90061804,  //  0012  SETMBR	R1	K12	R4
+      0x8C10010D,  //  0013  GETMET	R4	R0	K13
+      0x5C180400,  //  0014  MOVE	R6	R2
+      0x5C1C0600,  //  0015  MOVE	R7	R3
+      0x4C200000,  //  0016  LDNIL	R8
+      0x4C240000,  //  0017  LDNIL	R9
+      0x8828010E,  //  0018  GETMBR	R10	R0	K14
+      0x7C100C00,  //  0019  CALL	R4	6
+      0x50140000,  //  001A  LDBOOL	R5	0	0
+      0x90121E05,  //  001B  SETMBR	R4	K15	R5
+      0x8814030A,  //  001C  GETMBR	R5	R1	K10
+      0x90121405,  //  001D  SETMBR	R4	K10	R5
+      0xB8160200,  //  001E  GETNGBL	R5	K1
+      0x8C140B10,  //  001F  GETMET	R5	R5	K16
+      0x881C0511,  //  0020  GETMBR	R7	R2	K17
+      0x5C200400,  //  0021  MOVE	R8	R2
+      0x5C240800,  //  0022  MOVE	R9	R4
+      0x5C280200,  //  0023  MOVE	R10	R1
+      0x7C140A00,  //  0024  CALL	R5	5
+      0x88180112,  //  0025  GETMBR	R6	R0	K18
+      0x8C180D13,  //  0026  GETMET	R6	R6	K19
+      0x5C200A00,  //  0027  MOVE	R8	R5
+      0x7C180400,  //  0028  CALL	R6	2
+      0x8C180114,  //  0029  GETMET	R6	R0	K20
+      0x88200511,  //  002A  GETMBR	R8	R2	K17
+      0x7C180400,  //  002B  CALL	R6	2
+      0x80000000,  //  002C  RET	0
     })
   )
 );
@@ -2194,19 +2168,20 @@ be_local_closure(Matter_IM_send_status,   /* name */
 ********************************************************************/
 be_local_closure(Matter_IM__inner_process_read_request,   /* name */
   be_nested_proto(
-    19,                          /* nstack */
-    5,                          /* argc */
+    21,                          /* nstack */
+    6,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
     NULL,                       /* no upvals */
     1,                          /* has sup protos */
     ( &(const struct bproto*[ 2]) {
       be_nested_proto(
-        20,                          /* nstack */
+        22,                          /* nstack */
         4,                          /* argc */
         0,                          /* varg */
         1,                          /* has upvals */
-        ( &(const bupvaldesc[ 3]) {  /* upvals */
+        ( &(const bupvaldesc[ 4]) {  /* upvals */
+          be_local_const_upval(1, 6),
           be_local_const_upval(1, 1),
           be_local_const_upval(1, 0),
           be_local_const_upval(1, 4),
@@ -2214,7 +2189,7 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
         0,                          /* has sup protos */
         NULL,                       /* no sub protos */
         1,                          /* has constants */
-        ( &(const bvalue[35]) {     /* constants */
+        ( &(const bvalue[39]) {     /* constants */
         /* K0   */  be_nested_str_weak(matter),
         /* K1   */  be_nested_str_weak(TLV),
         /* K2   */  be_nested_str_weak(get_attribute_name),
@@ -2224,36 +2199,40 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
         /* K6   */  be_nested_str_weak(_X29),
         /* K7   */  be_nested_str_weak(),
         /* K8   */  be_nested_str_weak(status),
-        /* K9   */  be_nested_str_weak(read_attribute),
-        /* K10  */  be_nested_str_weak(tlv_solo),
-        /* K11  */  be_nested_str_weak(to_str_val),
-        /* K12  */  be_nested_str_weak(is_list),
-        /* K13  */  be_nested_str_weak(is_array),
-        /* K14  */  be_nested_str_weak(encode_len),
-        /* K15  */  be_nested_str_weak(IM_ReportData),
-        /* K16  */  be_nested_str_weak(MAX_MESSAGE),
-        /* K17  */  be_nested_str_weak(Matter_TLV_array),
-        /* K18  */  be_nested_str_weak(attributedata2raw),
-        /* K19  */  be_nested_str_weak(push),
-        /* K20  */  be_nested_str_weak(val),
-        /* K21  */  be_nested_str_weak(stop_iteration),
-        /* K22  */  be_nested_str_weak(tasmota),
-        /* K23  */  be_nested_str_weak(log),
-        /* K24  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20_X25s),
-        /* K25  */  be_nested_str_weak(local_session_id),
-        /* K26  */  be_const_int(3),
-        /* K27  */  be_nested_str_weak(attributestatus2raw),
-        /* K28  */  be_nested_str_weak(loglevel),
-        /* K29  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20STATUS_X3A_X200x_X2502X_X20_X25s),
-        /* K30  */  be_nested_str_weak(UNSUPPORTED_ATTRIBUTE),
-        /* K31  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20IGNORED),
-        /* K32  */  be_const_int(0),
-        /* K33  */  be_nested_str_weak(attribute_reports),
-        /* K34  */  be_const_int(1),
+        /* K9   */  be_nested_str_weak(is_session_dependent),
+        /* K10  */  be_nested_str_weak(find_report),
+        /* K11  */  be_nested_str_weak(read_attribute),
+        /* K12  */  be_nested_str_weak(tlv_solo),
+        /* K13  */  be_const_int(3),
+        /* K14  */  be_nested_str_weak(tasmota),
+        /* K15  */  be_nested_str_weak(log),
+        /* K16  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20_X25s),
+        /* K17  */  be_nested_str_weak(local_session_id),
+        /* K18  */  be_nested_str_weak(to_str_val),
+        /* K19  */  be_nested_str_weak(is_list),
+        /* K20  */  be_nested_str_weak(is_array),
+        /* K21  */  be_nested_str_weak(encode_len),
+        /* K22  */  be_nested_str_weak(IM_ReportData),
+        /* K23  */  be_nested_str_weak(MAX_MESSAGE),
+        /* K24  */  be_nested_str_weak(Matter_TLV_array),
+        /* K25  */  be_nested_str_weak(attributedata2raw),
+        /* K26  */  be_nested_str_weak(push),
+        /* K27  */  be_nested_str_weak(val),
+        /* K28  */  be_nested_str_weak(stop_iteration),
+        /* K29  */  be_nested_str_weak(add_report),
+        /* K30  */  be_nested_str_weak(attributestatus2raw),
+        /* K31  */  be_nested_str_weak(loglevel),
+        /* K32  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20STATUS_X3A_X200x_X2502X_X20_X25s),
+        /* K33  */  be_nested_str_weak(UNSUPPORTED_ATTRIBUTE),
+        /* K34  */  be_nested_str_weak(MTR_X3A_X20_X3ERead_Attr_X20_X28_X256i_X29_X20_X25s_X25s_X20_X2D_X20IGNORED),
+        /* K35  */  be_const_int(0),
+        /* K36  */  be_nested_str_weak(attribute_reports),
+        /* K37  */  be_nested_str_weak(copy),
+        /* K38  */  be_const_int(1),
         }),
         be_str_weak(read_single_attribute),
         &be_const_str_solidified,
-        ( &(const binstruction[238]) {  /* code */
+        ( &(const binstruction[298]) {  /* code */
           0xB8120000,  //  0000  GETNGBL	R4	K0
           0x88100901,  //  0001  GETMBR	R4	R4	K1
           0xB8160000,  //  0002  GETNGBL	R5	K0
@@ -2270,228 +2249,288 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
           0x4C180000,  //  000D  LDNIL	R6
           0x900A1006,  //  000E  SETMBR	R2	K8	R6
           0x4C180000,  //  000F  LDNIL	R6
-          0x20180206,  //  0010  NE	R6	R1	R6
-          0x781A0006,  //  0011  JMPF	R6	#0019
-          0x8C180309,  //  0012  GETMET	R6	R1	K9
-          0x68200000,  //  0013  GETUPV	R8	U0
-          0x5C240400,  //  0014  MOVE	R9	R2
-          0x68280001,  //  0015  GETUPV	R10	U1
-          0x8828150A,  //  0016  GETMBR	R10	R10	K10
-          0x7C180800,  //  0017  CALL	R6	4
-          0x70020000,  //  0018  JMP		#001A
-          0x4C180000,  //  0019  LDNIL	R6
-          0x501C0200,  //  001A  LDBOOL	R7	1	0
-          0x4C200000,  //  001B  LDNIL	R8
-          0x4C240000,  //  001C  LDNIL	R9
-          0x20240C09,  //  001D  NE	R9	R6	R9
-          0x78260054,  //  001E  JMPF	R9	#0074
-          0x58240007,  //  001F  LDCONST	R9	K7
-          0x68280002,  //  0020  GETUPV	R10	U2
-          0x742A0002,  //  0021  JMPT	R10	#0025
-          0x8C280D0B,  //  0022  GETMET	R10	R6	K11
-          0x7C280200,  //  0023  CALL	R10	1
-          0x5C241400,  //  0024  MOVE	R9	R10
-          0x88280D0C,  //  0025  GETMBR	R10	R6	K12
-          0x742A0001,  //  0026  JMPT	R10	#0029
-          0x88280D0D,  //  0027  GETMBR	R10	R6	K13
-          0x782A0031,  //  0028  JMPF	R10	#005B
-          0x8C280D0E,  //  0029  GETMET	R10	R6	K14
-          0x7C280200,  //  002A  CALL	R10	1
-          0xB82E0000,  //  002B  GETNGBL	R11	K0
-          0x882C170F,  //  002C  GETMBR	R11	R11	K15
-          0x882C1710,  //  002D  GETMBR	R11	R11	K16
-          0x2428140B,  //  002E  GT	R10	R10	R11
-          0x782A002A,  //  002F  JMPF	R10	#005B
-          0x60280012,  //  0030  GETGBL	R10	G18
-          0x7C280000,  //  0031  CALL	R10	0
-          0x5C201400,  //  0032  MOVE	R8	R10
-          0x60280015,  //  0033  GETGBL	R10	G21
-          0x542E002F,  //  0034  LDINT	R11	48
-          0x7C280200,  //  0035  CALL	R10	1
-          0x8C2C0911,  //  0036  GETMET	R11	R4	K17
-          0x7C2C0200,  //  0037  CALL	R11	1
-          0x68300001,  //  0038  GETUPV	R12	U1
-          0x8C301912,  //  0039  GETMET	R12	R12	K18
-          0x5C381400,  //  003A  MOVE	R14	R10
-          0x5C3C0400,  //  003B  MOVE	R15	R2
-          0x5C401600,  //  003C  MOVE	R16	R11
-          0x50440000,  //  003D  LDBOOL	R17	0	0
-          0x7C300A00,  //  003E  CALL	R12	5
-          0x8C301113,  //  003F  GETMET	R12	R8	K19
-          0x5C381400,  //  0040  MOVE	R14	R10
-          0x7C300400,  //  0041  CALL	R12	2
-          0x60300010,  //  0042  GETGBL	R12	G16
-          0x88340D14,  //  0043  GETMBR	R13	R6	K20
-          0x7C300200,  //  0044  CALL	R12	1
-          0xA8020010,  //  0045  EXBLK	0	#0057
-          0x5C341800,  //  0046  MOVE	R13	R12
-          0x7C340000,  //  0047  CALL	R13	0
-          0x60380015,  //  0048  GETGBL	R14	G21
-          0x543E002F,  //  0049  LDINT	R15	48
-          0x7C380200,  //  004A  CALL	R14	1
-          0x5C281C00,  //  004B  MOVE	R10	R14
-          0x68380001,  //  004C  GETUPV	R14	U1
-          0x8C381D12,  //  004D  GETMET	R14	R14	K18
-          0x5C401400,  //  004E  MOVE	R16	R10
-          0x5C440400,  //  004F  MOVE	R17	R2
-          0x5C481A00,  //  0050  MOVE	R18	R13
-          0x504C0200,  //  0051  LDBOOL	R19	1	0
-          0x7C380A00,  //  0052  CALL	R14	5
-          0x8C381113,  //  0053  GETMET	R14	R8	K19
-          0x5C401400,  //  0054  MOVE	R16	R10
-          0x7C380400,  //  0055  CALL	R14	2
-          0x7001FFEE,  //  0056  JMP		#0046
-          0x58300015,  //  0057  LDCONST	R12	K21
-          0xAC300200,  //  0058  CATCH	R12	1	0
-          0xB0080000,  //  0059  RAISE	2	R0	R0
-          0x70020009,  //  005A  JMP		#0065
-          0x60280015,  //  005B  GETGBL	R10	G21
-          0x542E002F,  //  005C  LDINT	R11	48
-          0x7C280200,  //  005D  CALL	R10	1
-          0x5C201400,  //  005E  MOVE	R8	R10
-          0x68280001,  //  005F  GETUPV	R10	U1
-          0x8C281512,  //  0060  GETMET	R10	R10	K18
-          0x5C301000,  //  0061  MOVE	R12	R8
-          0x5C340400,  //  0062  MOVE	R13	R2
-          0x5C380C00,  //  0063  MOVE	R14	R6
-          0x7C280800,  //  0064  CALL	R10	4
-          0x68280002,  //  0065  GETUPV	R10	U2
-          0x742A000B,  //  0066  JMPT	R10	#0073
-          0xB82A2C00,  //  0067  GETNGBL	R10	K22
-          0x8C281517,  //  0068  GETMET	R10	R10	K23
-          0x60300018,  //  0069  GETGBL	R12	G24
-          0x58340018,  //  006A  LDCONST	R13	K24
-          0x68380000,  //  006B  GETUPV	R14	U0
-          0x88381D19,  //  006C  GETMBR	R14	R14	K25
-          0x5C3C0400,  //  006D  MOVE	R15	R2
-          0x5C400A00,  //  006E  MOVE	R16	R5
-          0x5C441200,  //  006F  MOVE	R17	R9
-          0x7C300A00,  //  0070  CALL	R12	5
-          0x5834001A,  //  0071  LDCONST	R13	K26
-          0x7C280600,  //  0072  CALL	R10	3
-          0x7002003B,  //  0073  JMP		#00B0
-          0x88240508,  //  0074  GETMBR	R9	R2	K8
-          0x4C280000,  //  0075  LDNIL	R10
-          0x2024120A,  //  0076  NE	R9	R9	R10
-          0x78260026,  //  0077  JMPF	R9	#009F
-          0x780E0024,  //  0078  JMPF	R3	#009E
-          0x60240015,  //  0079  GETGBL	R9	G21
-          0x542A002F,  //  007A  LDINT	R10	48
-          0x7C240200,  //  007B  CALL	R9	1
-          0x5C201200,  //  007C  MOVE	R8	R9
-          0x68240001,  //  007D  GETUPV	R9	U1
-          0x8C24131B,  //  007E  GETMET	R9	R9	K27
-          0x5C2C1000,  //  007F  MOVE	R11	R8
-          0x5C300400,  //  0080  MOVE	R12	R2
-          0x88340508,  //  0081  GETMBR	R13	R2	K8
-          0x7C240800,  //  0082  CALL	R9	4
-          0xB8262C00,  //  0083  GETNGBL	R9	K22
-          0x8C24131C,  //  0084  GETMET	R9	R9	K28
-          0x582C001A,  //  0085  LDCONST	R11	K26
-          0x7C240400,  //  0086  CALL	R9	2
-          0x78260015,  //  0087  JMPF	R9	#009E
-          0xB8262C00,  //  0088  GETNGBL	R9	K22
-          0x8C241317,  //  0089  GETMET	R9	R9	K23
-          0x602C0018,  //  008A  GETGBL	R11	G24
-          0x5830001D,  //  008B  LDCONST	R12	K29
-          0x68340000,  //  008C  GETUPV	R13	U0
-          0x88341B19,  //  008D  GETMBR	R13	R13	K25
-          0x60380008,  //  008E  GETGBL	R14	G8
+          0x681C0000,  //  0010  GETUPV	R7	U0
+          0x4C200000,  //  0011  LDNIL	R8
+          0x201C0E08,  //  0012  NE	R7	R7	R8
+          0x781E0006,  //  0013  JMPF	R7	#001B
+          0x4C1C0000,  //  0014  LDNIL	R7
+          0x201C0207,  //  0015  NE	R7	R1	R7
+          0x781E0003,  //  0016  JMPF	R7	#001B
+          0x8C1C0309,  //  0017  GETMET	R7	R1	K9
+          0x5C240400,  //  0018  MOVE	R9	R2
+          0x7C1C0400,  //  0019  CALL	R7	2
+          0x781E0000,  //  001A  JMPF	R7	#001C
+          0x501C0001,  //  001B  LDBOOL	R7	0	1
+          0x501C0200,  //  001C  LDBOOL	R7	1	0
+          0x781E0004,  //  001D  JMPF	R7	#0023
+          0x68200000,  //  001E  GETUPV	R8	U0
+          0x8C20110A,  //  001F  GETMET	R8	R8	K10
+          0x5C280400,  //  0020  MOVE	R10	R2
+          0x7C200400,  //  0021  CALL	R8	2
+          0x70020000,  //  0022  JMP		#0024
+          0x4C200000,  //  0023  LDNIL	R8
+          0x4C240000,  //  0024  LDNIL	R9
+          0x1C241009,  //  0025  EQ	R9	R8	R9
+          0x7826000B,  //  0026  JMPF	R9	#0033
+          0x4C240000,  //  0027  LDNIL	R9
+          0x20240209,  //  0028  NE	R9	R1	R9
+          0x78260006,  //  0029  JMPF	R9	#0031
+          0x8C24030B,  //  002A  GETMET	R9	R1	K11
+          0x682C0001,  //  002B  GETUPV	R11	U1
+          0x5C300400,  //  002C  MOVE	R12	R2
+          0x68340002,  //  002D  GETUPV	R13	U2
+          0x88341B0C,  //  002E  GETMBR	R13	R13	K12
+          0x7C240800,  //  002F  CALL	R9	4
+          0x70020000,  //  0030  JMP		#0032
+          0x4C240000,  //  0031  LDNIL	R9
+          0x5C181200,  //  0032  MOVE	R6	R9
+          0x50240200,  //  0033  LDBOOL	R9	1	0
+          0x4C280000,  //  0034  LDNIL	R10
+          0x4C2C0000,  //  0035  LDNIL	R11
+          0x202C100B,  //  0036  NE	R11	R8	R11
+          0x782E0010,  //  0037  JMPF	R11	#0049
+          0x9428110D,  //  0038  GETIDX	R10	R8	K13
+          0x682C0003,  //  0039  GETUPV	R11	U3
+          0x742E000C,  //  003A  JMPT	R11	#0048
+          0xB82E1C00,  //  003B  GETNGBL	R11	K14
+          0x8C2C170F,  //  003C  GETMET	R11	R11	K15
+          0x60340018,  //  003D  GETGBL	R13	G24
+          0x58380010,  //  003E  LDCONST	R14	K16
+          0x683C0001,  //  003F  GETUPV	R15	U1
+          0x883C1F11,  //  0040  GETMBR	R15	R15	K17
+          0x5C400400,  //  0041  MOVE	R16	R2
+          0x5C440A00,  //  0042  MOVE	R17	R5
+          0x544A0003,  //  0043  LDINT	R18	4
+          0x94481012,  //  0044  GETIDX	R18	R8	R18
+          0x7C340A00,  //  0045  CALL	R13	5
+          0x5838000D,  //  0046  LDCONST	R14	K13
+          0x7C2C0600,  //  0047  CALL	R11	3
+          0x7002009A,  //  0048  JMP		#00E4
+          0x4C2C0000,  //  0049  LDNIL	R11
+          0x202C0C0B,  //  004A  NE	R11	R6	R11
+          0x782E005B,  //  004B  JMPF	R11	#00A8
+          0x582C0007,  //  004C  LDCONST	R11	K7
+          0x68300003,  //  004D  GETUPV	R12	U3
+          0x74320002,  //  004E  JMPT	R12	#0052
+          0x8C300D12,  //  004F  GETMET	R12	R6	K18
+          0x7C300200,  //  0050  CALL	R12	1
+          0x5C2C1800,  //  0051  MOVE	R11	R12
+          0x88300D13,  //  0052  GETMBR	R12	R6	K19
+          0x74320001,  //  0053  JMPT	R12	#0056
+          0x88300D14,  //  0054  GETMBR	R12	R6	K20
+          0x78320031,  //  0055  JMPF	R12	#0088
+          0x8C300D15,  //  0056  GETMET	R12	R6	K21
+          0x7C300200,  //  0057  CALL	R12	1
+          0xB8360000,  //  0058  GETNGBL	R13	K0
+          0x88341B16,  //  0059  GETMBR	R13	R13	K22
+          0x88341B17,  //  005A  GETMBR	R13	R13	K23
+          0x2430180D,  //  005B  GT	R12	R12	R13
+          0x7832002A,  //  005C  JMPF	R12	#0088
+          0x60300012,  //  005D  GETGBL	R12	G18
+          0x7C300000,  //  005E  CALL	R12	0
+          0x5C281800,  //  005F  MOVE	R10	R12
+          0x60300015,  //  0060  GETGBL	R12	G21
+          0x5436002F,  //  0061  LDINT	R13	48
+          0x7C300200,  //  0062  CALL	R12	1
+          0x8C340918,  //  0063  GETMET	R13	R4	K24
+          0x7C340200,  //  0064  CALL	R13	1
+          0x68380002,  //  0065  GETUPV	R14	U2
+          0x8C381D19,  //  0066  GETMET	R14	R14	K25
+          0x5C401800,  //  0067  MOVE	R16	R12
+          0x5C440400,  //  0068  MOVE	R17	R2
+          0x5C481A00,  //  0069  MOVE	R18	R13
+          0x504C0000,  //  006A  LDBOOL	R19	0	0
+          0x7C380A00,  //  006B  CALL	R14	5
+          0x8C38151A,  //  006C  GETMET	R14	R10	K26
+          0x5C401800,  //  006D  MOVE	R16	R12
+          0x7C380400,  //  006E  CALL	R14	2
+          0x60380010,  //  006F  GETGBL	R14	G16
+          0x883C0D1B,  //  0070  GETMBR	R15	R6	K27
+          0x7C380200,  //  0071  CALL	R14	1
+          0xA8020010,  //  0072  EXBLK	0	#0084
+          0x5C3C1C00,  //  0073  MOVE	R15	R14
+          0x7C3C0000,  //  0074  CALL	R15	0
+          0x60400015,  //  0075  GETGBL	R16	G21
+          0x5446002F,  //  0076  LDINT	R17	48
+          0x7C400200,  //  0077  CALL	R16	1
+          0x5C302000,  //  0078  MOVE	R12	R16
+          0x68400002,  //  0079  GETUPV	R16	U2
+          0x8C402119,  //  007A  GETMET	R16	R16	K25
+          0x5C481800,  //  007B  MOVE	R18	R12
+          0x5C4C0400,  //  007C  MOVE	R19	R2
+          0x5C501E00,  //  007D  MOVE	R20	R15
+          0x50540200,  //  007E  LDBOOL	R21	1	0
+          0x7C400A00,  //  007F  CALL	R16	5
+          0x8C40151A,  //  0080  GETMET	R16	R10	K26
+          0x5C481800,  //  0081  MOVE	R18	R12
+          0x7C400400,  //  0082  CALL	R16	2
+          0x7001FFEE,  //  0083  JMP		#0073
+          0x5838001C,  //  0084  LDCONST	R14	K28
+          0xAC380200,  //  0085  CATCH	R14	1	0
+          0xB0080000,  //  0086  RAISE	2	R0	R0
+          0x70020009,  //  0087  JMP		#0092
+          0x60300015,  //  0088  GETGBL	R12	G21
+          0x5436002F,  //  0089  LDINT	R13	48
+          0x7C300200,  //  008A  CALL	R12	1
+          0x5C281800,  //  008B  MOVE	R10	R12
+          0x68300002,  //  008C  GETUPV	R12	U2
+          0x8C301919,  //  008D  GETMET	R12	R12	K25
+          0x5C381400,  //  008E  MOVE	R14	R10
           0x5C3C0400,  //  008F  MOVE	R15	R2
-          0x7C380200,  //  0090  CALL	R14	1
-          0x5C3C0A00,  //  0091  MOVE	R15	R5
-          0x88400508,  //  0092  GETMBR	R16	R2	K8
-          0x88440508,  //  0093  GETMBR	R17	R2	K8
-          0xB84A0000,  //  0094  GETNGBL	R18	K0
-          0x8848251E,  //  0095  GETMBR	R18	R18	K30
-          0x1C442212,  //  0096  EQ	R17	R17	R18
-          0x78460001,  //  0097  JMPF	R17	#009A
-          0x5844001E,  //  0098  LDCONST	R17	K30
-          0x70020000,  //  0099  JMP		#009B
-          0x58440007,  //  009A  LDCONST	R17	K7
-          0x7C2C0C00,  //  009B  CALL	R11	6
-          0x5830001A,  //  009C  LDCONST	R12	K26
-          0x7C240600,  //  009D  CALL	R9	3
-          0x70020010,  //  009E  JMP		#00B0
-          0x68240002,  //  009F  GETUPV	R9	U2
-          0x7426000C,  //  00A0  JMPT	R9	#00AE
-          0xB8262C00,  //  00A1  GETNGBL	R9	K22
-          0x8C241317,  //  00A2  GETMET	R9	R9	K23
-          0x602C0018,  //  00A3  GETGBL	R11	G24
-          0x5830001F,  //  00A4  LDCONST	R12	K31
-          0x68340000,  //  00A5  GETUPV	R13	U0
-          0x88341B19,  //  00A6  GETMBR	R13	R13	K25
-          0x60380008,  //  00A7  GETGBL	R14	G8
-          0x5C3C0400,  //  00A8  MOVE	R15	R2
-          0x7C380200,  //  00A9  CALL	R14	1
-          0x5C3C0A00,  //  00AA  MOVE	R15	R5
-          0x7C2C0800,  //  00AB  CALL	R11	4
-          0x5830001A,  //  00AC  LDCONST	R12	K26
-          0x7C240600,  //  00AD  CALL	R9	3
-          0x780E0000,  //  00AE  JMPF	R3	#00B0
-          0x501C0000,  //  00AF  LDBOOL	R7	0	0
-          0x6024000F,  //  00B0  GETGBL	R9	G15
-          0x5C281000,  //  00B1  MOVE	R10	R8
-          0x602C0012,  //  00B2  GETGBL	R11	G18
-          0x7C240400,  //  00B3  CALL	R9	2
-          0x78260001,  //  00B4  JMPF	R9	#00B7
-          0x58240020,  //  00B5  LDCONST	R9	K32
-          0x70020000,  //  00B6  JMP		#00B8
-          0x4C240000,  //  00B7  LDNIL	R9
-          0x4C280000,  //  00B8  LDNIL	R10
-          0x2028100A,  //  00B9  NE	R10	R8	R10
-          0x782A0031,  //  00BA  JMPF	R10	#00ED
-          0x4C280000,  //  00BB  LDNIL	R10
-          0x1C28120A,  //  00BC  EQ	R10	R9	R10
-          0x782A0001,  //  00BD  JMPF	R10	#00C0
-          0x5C281000,  //  00BE  MOVE	R10	R8
-          0x70020000,  //  00BF  JMP		#00C1
-          0x94281009,  //  00C0  GETIDX	R10	R8	R9
-          0x602C000C,  //  00C1  GETGBL	R11	G12
-          0x88300121,  //  00C2  GETMBR	R12	R0	K33
-          0x7C2C0200,  //  00C3  CALL	R11	1
-          0x1C2C1720,  //  00C4  EQ	R11	R11	K32
-          0x782E0004,  //  00C5  JMPF	R11	#00CB
-          0x882C0121,  //  00C6  GETMBR	R11	R0	K33
-          0x8C2C1713,  //  00C7  GETMET	R11	R11	K19
-          0x5C341400,  //  00C8  MOVE	R13	R10
-          0x7C2C0400,  //  00C9  CALL	R11	2
-          0x70020014,  //  00CA  JMP		#00E0
-          0x882C0121,  //  00CB  GETMBR	R11	R0	K33
-          0x5431FFFE,  //  00CC  LDINT	R12	-1
-          0x942C160C,  //  00CD  GETIDX	R11	R11	R12
-          0x6030000C,  //  00CE  GETGBL	R12	G12
-          0x5C341600,  //  00CF  MOVE	R13	R11
-          0x7C300200,  //  00D0  CALL	R12	1
-          0x6034000C,  //  00D1  GETGBL	R13	G12
-          0x5C381400,  //  00D2  MOVE	R14	R10
-          0x7C340200,  //  00D3  CALL	R13	1
-          0x0030180D,  //  00D4  ADD	R12	R12	R13
-          0xB8360000,  //  00D5  GETNGBL	R13	K0
-          0x88341B0F,  //  00D6  GETMBR	R13	R13	K15
-          0x88341B10,  //  00D7  GETMBR	R13	R13	K16
-          0x1830180D,  //  00D8  LE	R12	R12	R13
-          0x78320001,  //  00D9  JMPF	R12	#00DC
-          0x4030160A,  //  00DA  CONNECT	R12	R11	R10
-          0x70020003,  //  00DB  JMP		#00E0
-          0x88300121,  //  00DC  GETMBR	R12	R0	K33
-          0x8C301913,  //  00DD  GETMET	R12	R12	K19
-          0x5C381400,  //  00DE  MOVE	R14	R10
-          0x7C300400,  //  00DF  CALL	R12	2
-          0x4C2C0000,  //  00E0  LDNIL	R11
-          0x1C2C120B,  //  00E1  EQ	R11	R9	R11
-          0x782E0001,  //  00E2  JMPF	R11	#00E5
-          0x4C200000,  //  00E3  LDNIL	R8
-          0x70020006,  //  00E4  JMP		#00EC
-          0x00241322,  //  00E5  ADD	R9	R9	K34
-          0x602C000C,  //  00E6  GETGBL	R11	G12
-          0x5C301000,  //  00E7  MOVE	R12	R8
-          0x7C2C0200,  //  00E8  CALL	R11	1
-          0x282C120B,  //  00E9  GE	R11	R9	R11
-          0x782E0000,  //  00EA  JMPF	R11	#00EC
-          0x4C200000,  //  00EB  LDNIL	R8
-          0x7001FFCA,  //  00EC  JMP		#00B8
-          0x80040E00,  //  00ED  RET	1	R7
+          0x5C400C00,  //  0090  MOVE	R16	R6
+          0x7C300800,  //  0091  CALL	R12	4
+          0x781E0005,  //  0092  JMPF	R7	#0099
+          0x68300000,  //  0093  GETUPV	R12	U0
+          0x8C30191D,  //  0094  GETMET	R12	R12	K29
+          0x5C380400,  //  0095  MOVE	R14	R2
+          0x5C3C1400,  //  0096  MOVE	R15	R10
+          0x5C401600,  //  0097  MOVE	R16	R11
+          0x7C300800,  //  0098  CALL	R12	4
+          0x68300003,  //  0099  GETUPV	R12	U3
+          0x7432000B,  //  009A  JMPT	R12	#00A7
+          0xB8321C00,  //  009B  GETNGBL	R12	K14
+          0x8C30190F,  //  009C  GETMET	R12	R12	K15
+          0x60380018,  //  009D  GETGBL	R14	G24
+          0x583C0010,  //  009E  LDCONST	R15	K16
+          0x68400001,  //  009F  GETUPV	R16	U1
+          0x88402111,  //  00A0  GETMBR	R16	R16	K17
+          0x5C440400,  //  00A1  MOVE	R17	R2
+          0x5C480A00,  //  00A2  MOVE	R18	R5
+          0x5C4C1600,  //  00A3  MOVE	R19	R11
+          0x7C380A00,  //  00A4  CALL	R14	5
+          0x583C000D,  //  00A5  LDCONST	R15	K13
+          0x7C300600,  //  00A6  CALL	R12	3
+          0x7002003B,  //  00A7  JMP		#00E4
+          0x882C0508,  //  00A8  GETMBR	R11	R2	K8
+          0x4C300000,  //  00A9  LDNIL	R12
+          0x202C160C,  //  00AA  NE	R11	R11	R12
+          0x782E0026,  //  00AB  JMPF	R11	#00D3
+          0x780E0024,  //  00AC  JMPF	R3	#00D2
+          0x602C0015,  //  00AD  GETGBL	R11	G21
+          0x5432002F,  //  00AE  LDINT	R12	48
+          0x7C2C0200,  //  00AF  CALL	R11	1
+          0x5C281600,  //  00B0  MOVE	R10	R11
+          0x682C0002,  //  00B1  GETUPV	R11	U2
+          0x8C2C171E,  //  00B2  GETMET	R11	R11	K30
+          0x5C341400,  //  00B3  MOVE	R13	R10
+          0x5C380400,  //  00B4  MOVE	R14	R2
+          0x883C0508,  //  00B5  GETMBR	R15	R2	K8
+          0x7C2C0800,  //  00B6  CALL	R11	4
+          0xB82E1C00,  //  00B7  GETNGBL	R11	K14
+          0x8C2C171F,  //  00B8  GETMET	R11	R11	K31
+          0x5834000D,  //  00B9  LDCONST	R13	K13
+          0x7C2C0400,  //  00BA  CALL	R11	2
+          0x782E0015,  //  00BB  JMPF	R11	#00D2
+          0xB82E1C00,  //  00BC  GETNGBL	R11	K14
+          0x8C2C170F,  //  00BD  GETMET	R11	R11	K15
+          0x60340018,  //  00BE  GETGBL	R13	G24
+          0x58380020,  //  00BF  LDCONST	R14	K32
+          0x683C0001,  //  00C0  GETUPV	R15	U1
+          0x883C1F11,  //  00C1  GETMBR	R15	R15	K17
+          0x60400008,  //  00C2  GETGBL	R16	G8
+          0x5C440400,  //  00C3  MOVE	R17	R2
+          0x7C400200,  //  00C4  CALL	R16	1
+          0x5C440A00,  //  00C5  MOVE	R17	R5
+          0x88480508,  //  00C6  GETMBR	R18	R2	K8
+          0x884C0508,  //  00C7  GETMBR	R19	R2	K8
+          0xB8520000,  //  00C8  GETNGBL	R20	K0
+          0x88502921,  //  00C9  GETMBR	R20	R20	K33
+          0x1C4C2614,  //  00CA  EQ	R19	R19	R20
+          0x784E0001,  //  00CB  JMPF	R19	#00CE
+          0x584C0021,  //  00CC  LDCONST	R19	K33
+          0x70020000,  //  00CD  JMP		#00CF
+          0x584C0007,  //  00CE  LDCONST	R19	K7
+          0x7C340C00,  //  00CF  CALL	R13	6
+          0x5838000D,  //  00D0  LDCONST	R14	K13
+          0x7C2C0600,  //  00D1  CALL	R11	3
+          0x70020010,  //  00D2  JMP		#00E4
+          0x682C0003,  //  00D3  GETUPV	R11	U3
+          0x742E000C,  //  00D4  JMPT	R11	#00E2
+          0xB82E1C00,  //  00D5  GETNGBL	R11	K14
+          0x8C2C170F,  //  00D6  GETMET	R11	R11	K15
+          0x60340018,  //  00D7  GETGBL	R13	G24
+          0x58380022,  //  00D8  LDCONST	R14	K34
+          0x683C0001,  //  00D9  GETUPV	R15	U1
+          0x883C1F11,  //  00DA  GETMBR	R15	R15	K17
+          0x60400008,  //  00DB  GETGBL	R16	G8
+          0x5C440400,  //  00DC  MOVE	R17	R2
+          0x7C400200,  //  00DD  CALL	R16	1
+          0x5C440A00,  //  00DE  MOVE	R17	R5
+          0x7C340800,  //  00DF  CALL	R13	4
+          0x5838000D,  //  00E0  LDCONST	R14	K13
+          0x7C2C0600,  //  00E1  CALL	R11	3
+          0x780E0000,  //  00E2  JMPF	R3	#00E4
+          0x50240000,  //  00E3  LDBOOL	R9	0	0
+          0x602C000F,  //  00E4  GETGBL	R11	G15
+          0x5C301400,  //  00E5  MOVE	R12	R10
+          0x60340012,  //  00E6  GETGBL	R13	G18
+          0x7C2C0400,  //  00E7  CALL	R11	2
+          0x782E0001,  //  00E8  JMPF	R11	#00EB
+          0x582C0023,  //  00E9  LDCONST	R11	K35
+          0x70020000,  //  00EA  JMP		#00EC
+          0x4C2C0000,  //  00EB  LDNIL	R11
+          0x4C300000,  //  00EC  LDNIL	R12
+          0x2030140C,  //  00ED  NE	R12	R10	R12
+          0x78320039,  //  00EE  JMPF	R12	#0129
+          0x4C300000,  //  00EF  LDNIL	R12
+          0x1C30160C,  //  00F0  EQ	R12	R11	R12
+          0x78320001,  //  00F1  JMPF	R12	#00F4
+          0x5C301400,  //  00F2  MOVE	R12	R10
+          0x70020000,  //  00F3  JMP		#00F5
+          0x9430140B,  //  00F4  GETIDX	R12	R10	R11
+          0x6034000C,  //  00F5  GETGBL	R13	G12
+          0x88380124,  //  00F6  GETMBR	R14	R0	K36
+          0x7C340200,  //  00F7  CALL	R13	1
+          0x1C341B23,  //  00F8  EQ	R13	R13	K35
+          0x78360008,  //  00F9  JMPF	R13	#0103
+          0x88340124,  //  00FA  GETMBR	R13	R0	K36
+          0x8C341B1A,  //  00FB  GETMET	R13	R13	K26
+          0x781E0002,  //  00FC  JMPF	R7	#0100
+          0x8C3C1925,  //  00FD  GETMET	R15	R12	K37
+          0x7C3C0200,  //  00FE  CALL	R15	1
+          0x70020000,  //  00FF  JMP		#0101
+          0x5C3C1800,  //  0100  MOVE	R15	R12
+          0x7C340400,  //  0101  CALL	R13	2
+          0x70020018,  //  0102  JMP		#011C
+          0x88340124,  //  0103  GETMBR	R13	R0	K36
+          0x5439FFFE,  //  0104  LDINT	R14	-1
+          0x94341A0E,  //  0105  GETIDX	R13	R13	R14
+          0x6038000C,  //  0106  GETGBL	R14	G12
+          0x5C3C1A00,  //  0107  MOVE	R15	R13
+          0x7C380200,  //  0108  CALL	R14	1
+          0x603C000C,  //  0109  GETGBL	R15	G12
+          0x5C401800,  //  010A  MOVE	R16	R12
+          0x7C3C0200,  //  010B  CALL	R15	1
+          0x00381C0F,  //  010C  ADD	R14	R14	R15
+          0xB83E0000,  //  010D  GETNGBL	R15	K0
+          0x883C1F16,  //  010E  GETMBR	R15	R15	K22
+          0x883C1F17,  //  010F  GETMBR	R15	R15	K23
+          0x18381C0F,  //  0110  LE	R14	R14	R15
+          0x783A0001,  //  0111  JMPF	R14	#0114
+          0x40381A0C,  //  0112  CONNECT	R14	R13	R12
+          0x70020007,  //  0113  JMP		#011C
+          0x88380124,  //  0114  GETMBR	R14	R0	K36
+          0x8C381D1A,  //  0115  GETMET	R14	R14	K26
+          0x781E0002,  //  0116  JMPF	R7	#011A
+          0x8C401925,  //  0117  GETMET	R16	R12	K37
+          0x7C400200,  //  0118  CALL	R16	1
+          0x70020000,  //  0119  JMP		#011B
+          0x5C401800,  //  011A  MOVE	R16	R12
+          0x7C380400,  //  011B  CALL	R14	2
+          0x4C340000,  //  011C  LDNIL	R13
+          0x1C34160D,  //  011D  EQ	R13	R11	R13
+          0x78360001,  //  011E  JMPF	R13	#0121
+          0x4C280000,  //  011F  LDNIL	R10
+          0x70020006,  //  0120  JMP		#0128
+          0x002C1726,  //  0121  ADD	R11	R11	K38
+          0x6034000C,  //  0122  GETGBL	R13	G12
+          0x5C381400,  //  0123  MOVE	R14	R10
+          0x7C340200,  //  0124  CALL	R13	1
+          0x2834160D,  //  0125  GE	R13	R11	R13
+          0x78360000,  //  0126  JMPF	R13	#0128
+          0x4C280000,  //  0127  LDNIL	R10
+          0x7001FFC2,  //  0128  JMP		#00EC
+          0x80041200,  //  0129  RET	1	R9
         })
       ),
       be_nested_proto(
@@ -2500,8 +2539,8 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
         0,                          /* varg */
         1,                          /* has upvals */
         ( &(const bupvaldesc[ 2]) {  /* upvals */
-          be_local_const_upval(1, 5),
-          be_local_const_upval(1, 8),
+          be_local_const_upval(1, 7),
+          be_local_const_upval(1, 10),
         }),
         0,                          /* has sup protos */
         NULL,                       /* no sub protos */
@@ -2550,103 +2589,113 @@ be_local_closure(Matter_IM__inner_process_read_request,   /* name */
     }),
     be_str_weak(_inner_process_read_request),
     &be_const_str_solidified,
-    ( &(const binstruction[96]) {  /* code */
-      0x84140000,  //  0000  CLOSURE	R5	P0
-      0x88180100,  //  0001  GETMBR	R6	R0	K0
-      0x8C180D01,  //  0002  GETMET	R6	R6	K1
-      0x7C180200,  //  0003  CALL	R6	1
-      0xB81E0400,  //  0004  GETNGBL	R7	K2
-      0x8C1C0F03,  //  0005  GETMET	R7	R7	K3
-      0x7C1C0200,  //  0006  CALL	R7	1
-      0x901E0803,  //  0007  SETMBR	R7	K4	R3
-      0xB8220400,  //  0008  GETNGBL	R8	K2
-      0x8C201105,  //  0009  GETMET	R8	R8	K5
-      0x7C200200,  //  000A  CALL	R8	1
-      0x60240012,  //  000B  GETGBL	R9	G18
-      0x7C240000,  //  000C  CALL	R9	0
-      0x90220C09,  //  000D  SETMBR	R8	K6	R9
-      0x60240010,  //  000E  GETGBL	R9	G16
-      0x88280507,  //  000F  GETMBR	R10	R2	K7
-      0x7C240200,  //  0010  CALL	R9	1
-      0xA8020048,  //  0011  EXBLK	0	#005B
-      0x5C281200,  //  0012  MOVE	R10	R9
-      0x7C280000,  //  0013  CALL	R10	0
-      0x882C1508,  //  0014  GETMBR	R11	R10	K8
-      0x901E100B,  //  0015  SETMBR	R7	K8	R11
-      0x882C1509,  //  0016  GETMBR	R11	R10	K9
-      0x901E120B,  //  0017  SETMBR	R7	K9	R11
-      0x882C150A,  //  0018  GETMBR	R11	R10	K10
-      0x901E140B,  //  0019  SETMBR	R7	K10	R11
-      0x882C050B,  //  001A  GETMBR	R11	R2	K11
-      0x901E160B,  //  001B  SETMBR	R7	K11	R11
-      0xB82E0400,  //  001C  GETNGBL	R11	K2
-      0x882C170D,  //  001D  GETMBR	R11	R11	K13
-      0x901E180B,  //  001E  SETMBR	R7	K12	R11
-      0x882C0F08,  //  001F  GETMBR	R11	R7	K8
-      0x4C300000,  //  0020  LDNIL	R12
-      0x1C2C160C,  //  0021  EQ	R11	R11	R12
-      0x742E0007,  //  0022  JMPT	R11	#002B
-      0x882C0F09,  //  0023  GETMBR	R11	R7	K9
-      0x4C300000,  //  0024  LDNIL	R12
-      0x1C2C160C,  //  0025  EQ	R11	R11	R12
-      0x742E0003,  //  0026  JMPT	R11	#002B
-      0x882C0F0A,  //  0027  GETMBR	R11	R7	K10
-      0x4C300000,  //  0028  LDNIL	R12
-      0x1C2C160C,  //  0029  EQ	R11	R11	R12
-      0x782E0029,  //  002A  JMPF	R11	#0055
-      0x882C0F09,  //  002B  GETMBR	R11	R7	K9
-      0x4C300000,  //  002C  LDNIL	R12
-      0x202C160C,  //  002D  NE	R11	R11	R12
-      0x782E001A,  //  002E  JMPF	R11	#004A
-      0x882C0F0A,  //  002F  GETMBR	R11	R7	K10
-      0x4C300000,  //  0030  LDNIL	R12
-      0x202C160C,  //  0031  NE	R11	R11	R12
-      0x782E0016,  //  0032  JMPF	R11	#004A
-      0xB82E0400,  //  0033  GETNGBL	R11	K2
-      0x8C2C170E,  //  0034  GETMET	R11	R11	K14
-      0x88340F09,  //  0035  GETMBR	R13	R7	K9
-      0x88380F0A,  //  0036  GETMBR	R14	R7	K10
-      0x7C2C0600,  //  0037  CALL	R11	3
-      0xB8321E00,  //  0038  GETNGBL	R12	K15
-      0x8C301910,  //  0039  GETMET	R12	R12	K16
-      0x60380018,  //  003A  GETGBL	R14	G24
-      0x583C0011,  //  003B  LDCONST	R15	K17
-      0x88400312,  //  003C  GETMBR	R16	R1	K18
-      0x60440008,  //  003D  GETGBL	R17	G8
-      0x5C480E00,  //  003E  MOVE	R18	R7
-      0x7C440200,  //  003F  CALL	R17	1
-      0x782E0002,  //  0040  JMPF	R11	#0044
-      0x004A260B,  //  0041  ADD	R18	K19	R11
-      0x00482514,  //  0042  ADD	R18	R18	K20
-      0x70020000,  //  0043  JMP		#0045
-      0x58480015,  //  0044  LDCONST	R18	K21
-      0x00442212,  //  0045  ADD	R17	R17	R18
-      0x7C380600,  //  0046  CALL	R14	3
-      0x583C0016,  //  0047  LDCONST	R15	K22
-      0x7C300600,  //  0048  CALL	R12	3
-      0x7002000A,  //  0049  JMP		#0055
-      0xB82E1E00,  //  004A  GETNGBL	R11	K15
-      0x8C2C1710,  //  004B  GETMET	R11	R11	K16
-      0x60340018,  //  004C  GETGBL	R13	G24
-      0x58380011,  //  004D  LDCONST	R14	K17
-      0x883C0312,  //  004E  GETMBR	R15	R1	K18
-      0x60400008,  //  004F  GETGBL	R16	G8
-      0x5C440E00,  //  0050  MOVE	R17	R7
-      0x7C400200,  //  0051  CALL	R16	1
-      0x7C340600,  //  0052  CALL	R13	3
-      0x58380016,  //  0053  LDCONST	R14	K22
-      0x7C2C0600,  //  0054  CALL	R11	3
-      0x882C0100,  //  0055  GETMBR	R11	R0	K0
-      0x8C2C1717,  //  0056  GETMET	R11	R11	K23
-      0x5C340E00,  //  0057  MOVE	R13	R7
-      0x84380001,  //  0058  CLOSURE	R14	P1
-      0x7C2C0600,  //  0059  CALL	R11	3
-      0x7001FFB6,  //  005A  JMP		#0012
-      0x58240018,  //  005B  LDCONST	R9	K24
-      0xAC240200,  //  005C  CATCH	R9	1	0
-      0xB0080000,  //  005D  RAISE	2	R0	R0
-      0xA0000000,  //  005E  CLOSE	R0
-      0x80041000,  //  005F  RET	1	R8
+    ( &(const binstruction[106]) {  /* code */
+      0x4C180000,  //  0000  LDNIL	R6
+      0x841C0000,  //  0001  CLOSURE	R7	P0
+      0x88200100,  //  0002  GETMBR	R8	R0	K0
+      0x8C201101,  //  0003  GETMET	R8	R8	K1
+      0x7C200200,  //  0004  CALL	R8	1
+      0xB8260400,  //  0005  GETNGBL	R9	K2
+      0x8C241303,  //  0006  GETMET	R9	R9	K3
+      0x7C240200,  //  0007  CALL	R9	1
+      0x90260803,  //  0008  SETMBR	R9	K4	R3
+      0xB82A0400,  //  0009  GETNGBL	R10	K2
+      0x8C281505,  //  000A  GETMET	R10	R10	K5
+      0x7C280200,  //  000B  CALL	R10	1
+      0x602C0012,  //  000C  GETGBL	R11	G18
+      0x7C2C0000,  //  000D  CALL	R11	0
+      0x902A0C0B,  //  000E  SETMBR	R10	K6	R11
+      0x602C0010,  //  000F  GETGBL	R11	G16
+      0x88300507,  //  0010  GETMBR	R12	R2	K7
+      0x7C2C0200,  //  0011  CALL	R11	1
+      0xA8020051,  //  0012  EXBLK	0	#0065
+      0x5C301600,  //  0013  MOVE	R12	R11
+      0x7C300000,  //  0014  CALL	R12	0
+      0x88341908,  //  0015  GETMBR	R13	R12	K8
+      0x9026100D,  //  0016  SETMBR	R9	K8	R13
+      0x88341909,  //  0017  GETMBR	R13	R12	K9
+      0x9026120D,  //  0018  SETMBR	R9	K9	R13
+      0x8834190A,  //  0019  GETMBR	R13	R12	K10
+      0x9026140D,  //  001A  SETMBR	R9	K10	R13
+      0x8834050B,  //  001B  GETMBR	R13	R2	K11
+      0x9026160D,  //  001C  SETMBR	R9	K11	R13
+      0xB8360400,  //  001D  GETNGBL	R13	K2
+      0x88341B0D,  //  001E  GETMBR	R13	R13	K13
+      0x9026180D,  //  001F  SETMBR	R9	K12	R13
+      0x4C340000,  //  0020  LDNIL	R13
+      0x20340A0D,  //  0021  NE	R13	R5	R13
+      0x78360003,  //  0022  JMPF	R13	#0027
+      0x8834190B,  //  0023  GETMBR	R13	R12	K11
+      0x74360001,  //  0024  JMPT	R13	#0027
+      0x5C340A00,  //  0025  MOVE	R13	R5
+      0x70020000,  //  0026  JMP		#0028
+      0x4C340000,  //  0027  LDNIL	R13
+      0x5C181A00,  //  0028  MOVE	R6	R13
+      0x88341308,  //  0029  GETMBR	R13	R9	K8
+      0x4C380000,  //  002A  LDNIL	R14
+      0x1C341A0E,  //  002B  EQ	R13	R13	R14
+      0x74360007,  //  002C  JMPT	R13	#0035
+      0x88341309,  //  002D  GETMBR	R13	R9	K9
+      0x4C380000,  //  002E  LDNIL	R14
+      0x1C341A0E,  //  002F  EQ	R13	R13	R14
+      0x74360003,  //  0030  JMPT	R13	#0035
+      0x8834130A,  //  0031  GETMBR	R13	R9	K10
+      0x4C380000,  //  0032  LDNIL	R14
+      0x1C341A0E,  //  0033  EQ	R13	R13	R14
+      0x78360029,  //  0034  JMPF	R13	#005F
+      0x88341309,  //  0035  GETMBR	R13	R9	K9
+      0x4C380000,  //  0036  LDNIL	R14
+      0x20341A0E,  //  0037  NE	R13	R13	R14
+      0x7836001A,  //  0038  JMPF	R13	#0054
+      0x8834130A,  //  0039  GETMBR	R13	R9	K10
+      0x4C380000,  //  003A  LDNIL	R14
+      0x20341A0E,  //  003B  NE	R13	R13	R14
+      0x78360016,  //  003C  JMPF	R13	#0054
+      0xB8360400,  //  003D  GETNGBL	R13	K2
+      0x8C341B0E,  //  003E  GETMET	R13	R13	K14
+      0x883C1309,  //  003F  GETMBR	R15	R9	K9
+      0x8840130A,  //  0040  GETMBR	R16	R9	K10
+      0x7C340600,  //  0041  CALL	R13	3
+      0xB83A1E00,  //  0042  GETNGBL	R14	K15
+      0x8C381D10,  //  0043  GETMET	R14	R14	K16
+      0x60400018,  //  0044  GETGBL	R16	G24
+      0x58440011,  //  0045  LDCONST	R17	K17
+      0x88480312,  //  0046  GETMBR	R18	R1	K18
+      0x604C0008,  //  0047  GETGBL	R19	G8
+      0x5C501200,  //  0048  MOVE	R20	R9
+      0x7C4C0200,  //  0049  CALL	R19	1
+      0x78360002,  //  004A  JMPF	R13	#004E
+      0x0052260D,  //  004B  ADD	R20	K19	R13
+      0x00502914,  //  004C  ADD	R20	R20	K20
+      0x70020000,  //  004D  JMP		#004F
+      0x58500015,  //  004E  LDCONST	R20	K21
+      0x004C2614,  //  004F  ADD	R19	R19	R20
+      0x7C400600,  //  0050  CALL	R16	3
+      0x58440016,  //  0051  LDCONST	R17	K22
+      0x7C380600,  //  0052  CALL	R14	3
+      0x7002000A,  //  0053  JMP		#005F
+      0xB8361E00,  //  0054  GETNGBL	R13	K15
+      0x8C341B10,  //  0055  GETMET	R13	R13	K16
+      0x603C0018,  //  0056  GETGBL	R15	G24
+      0x58400011,  //  0057  LDCONST	R16	K17
+      0x88440312,  //  0058  GETMBR	R17	R1	K18
+      0x60480008,  //  0059  GETGBL	R18	G8
+      0x5C4C1200,  //  005A  MOVE	R19	R9
+      0x7C480200,  //  005B  CALL	R18	1
+      0x7C3C0600,  //  005C  CALL	R15	3
+      0x58400016,  //  005D  LDCONST	R16	K22
+      0x7C340600,  //  005E  CALL	R13	3
+      0x88340100,  //  005F  GETMBR	R13	R0	K0
+      0x8C341B17,  //  0060  GETMET	R13	R13	K23
+      0x5C3C1200,  //  0061  MOVE	R15	R9
+      0x84400001,  //  0062  CLOSURE	R16	P1
+      0x7C340600,  //  0063  CALL	R13	3
+      0x7001FFAD,  //  0064  JMP		#0013
+      0x582C0018,  //  0065  LDCONST	R11	K24
+      0xAC2C0200,  //  0066  CATCH	R11	1	0
+      0xB0080000,  //  0067  RAISE	2	R0	R0
+      0xA0000000,  //  0068  CLOSE	R0
+      0x80041400,  //  0069  RET	1	R10
     })
   )
 );
@@ -126,46 +126,51 @@ be_local_closure(Matter_IM_Subscription__add_attribute_unique_path,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 7]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_const_int(0),
     /* K1   */  be_nested_str_weak(updates),
     /* K2   */  be_nested_str_weak(endpoint),
     /* K3   */  be_nested_str_weak(cluster),
     /* K4   */  be_nested_str_weak(attribute),
-    /* K5   */  be_const_int(1),
-    /* K6   */  be_nested_str_weak(push),
+    /* K5   */  be_nested_str_weak(fabric_filtered),
+    /* K6   */  be_const_int(1),
+    /* K7   */  be_nested_str_weak(push),
     }),
     be_str_weak(_add_attribute_unique_path),
     &be_const_str_solidified,
-    ( &(const binstruction[28]) {  /* code */
+    ( &(const binstruction[32]) {  /* code */
       0x58080000,  //  0000  LDCONST	R2	K0
       0x600C000C,  //  0001  GETGBL	R3	G12
       0x88100101,  //  0002  GETMBR	R4	R0	K1
       0x7C0C0200,  //  0003  CALL	R3	1
       0x140C0403,  //  0004  LT	R3	R2	R3
-      0x780E0010,  //  0005  JMPF	R3	#0017
+      0x780E0014,  //  0005  JMPF	R3	#001B
       0x880C0101,  //  0006  GETMBR	R3	R0	K1
       0x940C0602,  //  0007  GETIDX	R3	R3	R2
       0x88100702,  //  0008  GETMBR	R4	R3	K2
       0x88140302,  //  0009  GETMBR	R5	R1	K2
       0x1C100805,  //  000A  EQ	R4	R4	R5
-      0x78120008,  //  000B  JMPF	R4	#0015
+      0x7812000C,  //  000B  JMPF	R4	#0019
       0x88100703,  //  000C  GETMBR	R4	R3	K3
       0x88140303,  //  000D  GETMBR	R5	R1	K3
       0x1C100805,  //  000E  EQ	R4	R4	R5
-      0x78120004,  //  000F  JMPF	R4	#0015
+      0x78120008,  //  000F  JMPF	R4	#0019
       0x88100704,  //  0010  GETMBR	R4	R3	K4
       0x88140304,  //  0011  GETMBR	R5	R1	K4
       0x1C100805,  //  0012  EQ	R4	R4	R5
-      0x78120000,  //  0013  JMPF	R4	#0015
-      0x80000800,  //  0014  RET	0
-      0x00080505,  //  0015  ADD	R2	R2	K5
-      0x7001FFE9,  //  0016  JMP		#0001
-      0x880C0101,  //  0017  GETMBR	R3	R0	K1
-      0x8C0C0706,  //  0018  GETMET	R3	R3	K6
-      0x5C140200,  //  0019  MOVE	R5	R1
-      0x7C0C0400,  //  001A  CALL	R3	2
-      0x80000000,  //  001B  RET	0
+      0x78120004,  //  0013  JMPF	R4	#0019
+      0x88100305,  //  0014  GETMBR	R4	R1	K5
+      0x78120001,  //  0015  JMPF	R4	#0018
+      0x50100200,  //  0016  LDBOOL	R4	1	0
+      0x900E0A04,  //  0017  SETMBR	R3	K5	R4
+      0x80000800,  //  0018  RET	0
+      0x00080506,  //  0019  ADD	R2	R2	K6
+      0x7001FFE5,  //  001A  JMP		#0001
+      0x880C0101,  //  001B  GETMBR	R3	R0	K1
+      0x8C0C0707,  //  001C  GETMET	R3	R3	K7
+      0x5C140200,  //  001D  MOVE	R5	R1
+      0x7C0C0400,  //  001E  CALL	R3	2
+      0x80000000,  //  001F  RET	0
     })
   )
 );
@@ -425,143 +430,6 @@ void be_load_Matter_IM_Subscription_class(bvm *vm) {
 
 extern const bclass be_class_Matter_IM_Subscription_Shop;
 
-/********************************************************************
-** Solidified function: every_250ms
-********************************************************************/
-be_local_closure(Matter_IM_Subscription_Shop_every_250ms,   /* name */
-  be_nested_proto(
-    6,                          /* nstack */
-    1,                          /* argc */
-    2,                          /* varg */
-    0,                          /* has upvals */
-    NULL,                       /* no upvals */
-    0,                          /* has sup protos */
-    NULL,                       /* no sub protos */
-    1,                          /* has constants */
-    ( &(const bvalue[14]) {     /* constants */
-    /* K0   */  be_const_int(0),
-    /* K1   */  be_nested_str_weak(subs),
-    /* K2   */  be_nested_str_weak(wait_status),
-    /* K3   */  be_nested_str_weak(updates),
-    /* K4   */  be_nested_str_weak(tasmota),
-    /* K5   */  be_nested_str_weak(time_reached),
-    /* K6   */  be_nested_str_weak(not_before),
-    /* K7   */  be_nested_str_weak(im),
-    /* K8   */  be_nested_str_weak(send_subscribe_update),
-    /* K9   */  be_nested_str_weak(clear_before_arm),
-    /* K10  */  be_const_int(1),
-    /* K11  */  be_nested_str_weak(expiration),
-    /* K12  */  be_nested_str_weak(send_subscribe_heartbeat),
-    /* K13  */  be_nested_str_weak(re_arm),
-    }),
-    be_str_weak(every_250ms),
-    &be_const_str_solidified,
-    ( &(const binstruction[54]) {  /* code */
-      0x58040000,  //  0000  LDCONST	R1	K0
-      0x6008000C,  //  0001  GETGBL	R2	G12
-      0x880C0101,  //  0002  GETMBR	R3	R0	K1
-      0x7C080200,  //  0003  CALL	R2	1
-      0x14080202,  //  0004  LT	R2	R1	R2
-      0x780A0015,  //  0005  JMPF	R2	#001C
-      0x88080101,  //  0006  GETMBR	R2	R0	K1
-      0x94080401,  //  0007  GETIDX	R2	R2	R1
-      0x880C0502,  //  0008  GETMBR	R3	R2	K2
-      0x740E000F,  //  0009  JMPT	R3	#001A
-      0x600C000C,  //  000A  GETGBL	R3	G12
-      0x88100503,  //  000B  GETMBR	R4	R2	K3
-      0x7C0C0200,  //  000C  CALL	R3	1
-      0x240C0700,  //  000D  GT	R3	R3	K0
-      0x780E000A,  //  000E  JMPF	R3	#001A
-      0xB80E0800,  //  000F  GETNGBL	R3	K4
-      0x8C0C0705,  //  0010  GETMET	R3	R3	K5
-      0x88140506,  //  0011  GETMBR	R5	R2	K6
-      0x7C0C0400,  //  0012  CALL	R3	2
-      0x780E0005,  //  0013  JMPF	R3	#001A
-      0x880C0107,  //  0014  GETMBR	R3	R0	K7
-      0x8C0C0708,  //  0015  GETMET	R3	R3	K8
-      0x5C140400,  //  0016  MOVE	R5	R2
-      0x7C0C0400,  //  0017  CALL	R3	2
-      0x8C0C0509,  //  0018  GETMET	R3	R2	K9
-      0x7C0C0200,  //  0019  CALL	R3	1
-      0x0004030A,  //  001A  ADD	R1	R1	K10
-      0x7001FFE4,  //  001B  JMP		#0001
-      0x58040000,  //  001C  LDCONST	R1	K0
-      0x6008000C,  //  001D  GETGBL	R2	G12
-      0x880C0101,  //  001E  GETMBR	R3	R0	K1
-      0x7C080200,  //  001F  CALL	R2	1
-      0x14080202,  //  0020  LT	R2	R1	R2
-      0x780A0012,  //  0021  JMPF	R2	#0035
-      0x88080101,  //  0022  GETMBR	R2	R0	K1
-      0x94080401,  //  0023  GETIDX	R2	R2	R1
-      0x880C0502,  //  0024  GETMBR	R3	R2	K2
-      0x740E000C,  //  0025  JMPT	R3	#0033
-      0xB80E0800,  //  0026  GETNGBL	R3	K4
-      0x8C0C0705,  //  0027  GETMET	R3	R3	K5
-      0x8814050B,  //  0028  GETMBR	R5	R2	K11
-      0x7C0C0400,  //  0029  CALL	R3	2
-      0x780E0007,  //  002A  JMPF	R3	#0033
-      0x880C0107,  //  002B  GETMBR	R3	R0	K7
-      0x8C0C070C,  //  002C  GETMET	R3	R3	K12
-      0x5C140400,  //  002D  MOVE	R5	R2
-      0x7C0C0400,  //  002E  CALL	R3	2
-      0x8C0C0509,  //  002F  GETMET	R3	R2	K9
-      0x7C0C0200,  //  0030  CALL	R3	1
-      0x8C0C050D,  //  0031  GETMET	R3	R2	K13
-      0x7C0C0200,  //  0032  CALL	R3	1
-      0x0004030A,  //  0033  ADD	R1	R1	K10
-      0x7001FFE7,  //  0034  JMP		#001D
-      0x80000000,  //  0035  RET	0
-    })
-  )
-);
-/*******************************************************************/
-
-
-/********************************************************************
-** Solidified function: get_by_id
-********************************************************************/
-be_local_closure(Matter_IM_Subscription_Shop_get_by_id,   /* name */
-  be_nested_proto(
-    5,                          /* nstack */
-    2,                          /* argc */
-    2,                          /* varg */
-    0,                          /* has upvals */
-    NULL,                       /* no upvals */
-    0,                          /* has sup protos */
-    NULL,                       /* no sub protos */
-    1,                          /* has constants */
-    ( &(const bvalue[ 4]) {     /* constants */
-    /* K0   */  be_const_int(0),
-    /* K1   */  be_nested_str_weak(subs),
-    /* K2   */  be_nested_str_weak(subscription_id),
-    /* K3   */  be_const_int(1),
-    }),
-    be_str_weak(get_by_id),
-    &be_const_str_solidified,
-    ( &(const binstruction[17]) {  /* code */
-      0x58080000,  //  0000  LDCONST	R2	K0
-      0x600C000C,  //  0001  GETGBL	R3	G12
-      0x88100101,  //  0002  GETMBR	R4	R0	K1
-      0x7C0C0200,  //  0003  CALL	R3	1
-      0x140C0403,  //  0004  LT	R3	R2	R3
-      0x780E0009,  //  0005  JMPF	R3	#0010
-      0x880C0101,  //  0006  GETMBR	R3	R0	K1
-      0x940C0602,  //  0007  GETIDX	R3	R3	R2
-      0x880C0702,  //  0008  GETMBR	R3	R3	K2
-      0x1C0C0601,  //  0009  EQ	R3	R3	R1
-      0x780E0002,  //  000A  JMPF	R3	#000E
-      0x880C0101,  //  000B  GETMBR	R3	R0	K1
-      0x940C0602,  //  000C  GETIDX	R3	R3	R2
-      0x80040600,  //  000D  RET	1	R3
-      0x00080503,  //  000E  ADD	R2	R2	K3
-      0x7001FFF0,  //  000F  JMP		#0001
-      0x80000000,  //  0010  RET	0
-    })
-  )
-);
-/*******************************************************************/
-
-
 /********************************************************************
 ** Solidified function: new_subscription
 ********************************************************************/
@@ -629,6 +497,194 @@ be_local_closure(Matter_IM_Subscription_Shop_new_subscription,   /* name */
 /*******************************************************************/
 
 
+/********************************************************************
+** Solidified function: add_report
+********************************************************************/
+be_local_closure(Matter_IM_Subscription_Shop_add_report,   /* name */
+  be_nested_proto(
+    8,                          /* nstack */
+    4,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 5]) {     /* constants */
+    /* K0   */  be_nested_str_weak(reports),
+    /* K1   */  be_nested_str_weak(push),
+    /* K2   */  be_nested_str_weak(endpoint),
+    /* K3   */  be_nested_str_weak(cluster),
+    /* K4   */  be_nested_str_weak(attribute),
+    }),
+    be_str_weak(add_report),
+    &be_const_str_solidified,
+    ( &(const binstruction[14]) {  /* code */
+      0x88100100,  //  0000  GETMBR	R4	R0	K0
+      0x8C100901,  //  0001  GETMET	R4	R4	K1
+      0x60180012,  //  0002  GETGBL	R6	G18
+      0x7C180000,  //  0003  CALL	R6	0
+      0x881C0302,  //  0004  GETMBR	R7	R1	K2
+      0x401C0C07,  //  0005  CONNECT	R7	R6	R7
+      0x881C0303,  //  0006  GETMBR	R7	R1	K3
+      0x401C0C07,  //  0007  CONNECT	R7	R6	R7
+      0x881C0304,  //  0008  GETMBR	R7	R1	K4
+      0x401C0C07,  //  0009  CONNECT	R7	R6	R7
+      0x401C0C02,  //  000A  CONNECT	R7	R6	R2
+      0x401C0C03,  //  000B  CONNECT	R7	R6	R3
+      0x7C100400,  //  000C  CALL	R4	2
+      0x80000000,  //  000D  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: find_report
+********************************************************************/
+be_local_closure(Matter_IM_Subscription_Shop_find_report,   /* name */
+  be_nested_proto(
+    6,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 7]) {     /* constants */
+    /* K0   */  be_const_int(0),
+    /* K1   */  be_nested_str_weak(reports),
+    /* K2   */  be_nested_str_weak(endpoint),
+    /* K3   */  be_const_int(1),
+    /* K4   */  be_nested_str_weak(cluster),
+    /* K5   */  be_const_int(2),
+    /* K6   */  be_nested_str_weak(attribute),
+    }),
+    be_str_weak(find_report),
+    &be_const_str_solidified,
+    ( &(const binstruction[25]) {  /* code */
+      0x58080000,  //  0000  LDCONST	R2	K0
+      0x600C000C,  //  0001  GETGBL	R3	G12
+      0x88100101,  //  0002  GETMBR	R4	R0	K1
+      0x7C0C0200,  //  0003  CALL	R3	1
+      0x140C0403,  //  0004  LT	R3	R2	R3
+      0x780E0010,  //  0005  JMPF	R3	#0017
+      0x880C0101,  //  0006  GETMBR	R3	R0	K1
+      0x940C0602,  //  0007  GETIDX	R3	R3	R2
+      0x94100700,  //  0008  GETIDX	R4	R3	K0
+      0x88140302,  //  0009  GETMBR	R5	R1	K2
+      0x1C100805,  //  000A  EQ	R4	R4	R5
+      0x78120008,  //  000B  JMPF	R4	#0015
+      0x94100703,  //  000C  GETIDX	R4	R3	K3
+      0x88140304,  //  000D  GETMBR	R5	R1	K4
+      0x1C100805,  //  000E  EQ	R4	R4	R5
+      0x78120004,  //  000F  JMPF	R4	#0015
+      0x94100705,  //  0010  GETIDX	R4	R3	K5
+      0x88140306,  //  0011  GETMBR	R5	R1	K6
+      0x1C100805,  //  0012  EQ	R4	R4	R5
+      0x78120000,  //  0013  JMPF	R4	#0015
+      0x80040600,  //  0014  RET	1	R3
+      0x00080503,  //  0015  ADD	R2	R2	K3
+      0x7001FFE9,  //  0016  JMP		#0001
+      0x4C0C0000,  //  0017  LDNIL	R3
+      0x80040600,  //  0018  RET	1	R3
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: remove_by_fabric
+********************************************************************/
+be_local_closure(Matter_IM_Subscription_Shop_remove_by_fabric,   /* name */
+  be_nested_proto(
+    7,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 3]) {     /* constants */
+    /* K0   */  be_nested_str_weak(_sessions),
+    /* K1   */  be_nested_str_weak(remove_by_session),
+    /* K2   */  be_nested_str_weak(stop_iteration),
+    }),
+    be_str_weak(remove_by_fabric),
+    &be_const_str_solidified,
+    ( &(const binstruction[14]) {  /* code */
+      0x60080010,  //  0000  GETGBL	R2	G16
+      0x880C0300,  //  0001  GETMBR	R3	R1	K0
+      0x7C080200,  //  0002  CALL	R2	1
+      0xA8020005,  //  0003  EXBLK	0	#000A
+      0x5C0C0400,  //  0004  MOVE	R3	R2
+      0x7C0C0000,  //  0005  CALL	R3	0
+      0x8C100101,  //  0006  GETMET	R4	R0	K1
+      0x5C180600,  //  0007  MOVE	R6	R3
+      0x7C100400,  //  0008  CALL	R4	2
+      0x7001FFF9,  //  0009  JMP		#0004
+      0x58080002,  //  000A  LDCONST	R2	K2
+      0xAC080200,  //  000B  CATCH	R2	1	0
+      0xB0080000,  //  000C  RAISE	2	R0	R0
+      0x80000000,  //  000D  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: remove_by_session
+********************************************************************/
+be_local_closure(Matter_IM_Subscription_Shop_remove_by_session,   /* name */
+  be_nested_proto(
+    6,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 5]) {     /* constants */
+    /* K0   */  be_const_int(0),
+    /* K1   */  be_nested_str_weak(subs),
+    /* K2   */  be_nested_str_weak(session),
+    /* K3   */  be_nested_str_weak(remove),
+    /* K4   */  be_const_int(1),
+    }),
+    be_str_weak(remove_by_session),
+    &be_const_str_solidified,
+    ( &(const binstruction[19]) {  /* code */
+      0x58080000,  //  0000  LDCONST	R2	K0
+      0x600C000C,  //  0001  GETGBL	R3	G12
+      0x88100101,  //  0002  GETMBR	R4	R0	K1
+      0x7C0C0200,  //  0003  CALL	R3	1
+      0x140C0403,  //  0004  LT	R3	R2	R3
+      0x780E000B,  //  0005  JMPF	R3	#0012
+      0x880C0101,  //  0006  GETMBR	R3	R0	K1
+      0x940C0602,  //  0007  GETIDX	R3	R3	R2
+      0x880C0702,  //  0008  GETMBR	R3	R3	K2
+      0x1C0C0601,  //  0009  EQ	R3	R3	R1
+      0x780E0004,  //  000A  JMPF	R3	#0010
+      0x880C0101,  //  000B  GETMBR	R3	R0	K1
+      0x8C0C0703,  //  000C  GETMET	R3	R3	K3
+      0x5C140400,  //  000D  MOVE	R5	R2
+      0x7C0C0400,  //  000E  CALL	R3	2
+      0x70020000,  //  000F  JMP		#0011
+      0x00080504,  //  0010  ADD	R2	R2	K4
+      0x7001FFEE,  //  0011  JMP		#0001
+      0x80000000,  //  0012  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
 /********************************************************************
 ** Solidified function: remove_sub
 ********************************************************************/
@@ -675,12 +731,139 @@ be_local_closure(Matter_IM_Subscription_Shop_remove_sub,   /* name */
 /*******************************************************************/
 
 
+/********************************************************************
+** Solidified function: every_250ms
+********************************************************************/
+be_local_closure(Matter_IM_Subscription_Shop_every_250ms,   /* name */
+  be_nested_proto(
+    8,                          /* nstack */
+    1,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[19]) {     /* constants */
+    /* K0   */  be_const_int(0),
+    /* K1   */  be_nested_str_weak(change_set),
+    /* K2   */  be_nested_str_weak(subs),
+    /* K3   */  be_nested_str_weak(attribute_updated_ctx),
+    /* K4   */  be_nested_str_weak(fabric_filtered),
+    /* K5   */  be_const_int(1),
+    /* K6   */  be_nested_str_weak(clear),
+    /* K7   */  be_nested_str_weak(wait_status),
+    /* K8   */  be_nested_str_weak(updates),
+    /* K9   */  be_nested_str_weak(tasmota),
+    /* K10  */  be_nested_str_weak(time_reached),
+    /* K11  */  be_nested_str_weak(not_before),
+    /* K12  */  be_nested_str_weak(im),
+    /* K13  */  be_nested_str_weak(send_subscribe_update),
+    /* K14  */  be_nested_str_weak(clear_before_arm),
+    /* K15  */  be_nested_str_weak(expiration),
+    /* K16  */  be_nested_str_weak(send_subscribe_heartbeat),
+    /* K17  */  be_nested_str_weak(re_arm),
+    /* K18  */  be_nested_str_weak(reports),
+    }),
+    be_str_weak(every_250ms),
+    &be_const_str_solidified,
+    ( &(const binstruction[84]) {  /* code */
+      0x58040000,  //  0000  LDCONST	R1	K0
+      0x6008000C,  //  0001  GETGBL	R2	G12
+      0x880C0101,  //  0002  GETMBR	R3	R0	K1
+      0x7C080200,  //  0003  CALL	R2	1
+      0x14080202,  //  0004  LT	R2	R1	R2
+      0x780A0011,  //  0005  JMPF	R2	#0018
+      0x88080101,  //  0006  GETMBR	R2	R0	K1
+      0x94080401,  //  0007  GETIDX	R2	R2	R1
+      0x580C0000,  //  0008  LDCONST	R3	K0
+      0x6010000C,  //  0009  GETGBL	R4	G12
+      0x88140102,  //  000A  GETMBR	R5	R0	K2
+      0x7C100200,  //  000B  CALL	R4	1
+      0x14100604,  //  000C  LT	R4	R3	R4
+      0x78120007,  //  000D  JMPF	R4	#0016
+      0x88100102,  //  000E  GETMBR	R4	R0	K2
+      0x94100803,  //  000F  GETIDX	R4	R4	R3
+      0x8C100903,  //  0010  GETMET	R4	R4	K3
+      0x5C180400,  //  0011  MOVE	R6	R2
+      0x881C0504,  //  0012  GETMBR	R7	R2	K4
+      0x7C100600,  //  0013  CALL	R4	3
+      0x000C0705,  //  0014  ADD	R3	R3	K5
+      0x7001FFF2,  //  0015  JMP		#0009
+      0x00040305,  //  0016  ADD	R1	R1	K5
+      0x7001FFE8,  //  0017  JMP		#0001
+      0x88080101,  //  0018  GETMBR	R2	R0	K1
+      0x8C080506,  //  0019  GETMET	R2	R2	K6
+      0x7C080200,  //  001A  CALL	R2	1
+      0x58040000,  //  001B  LDCONST	R1	K0
+      0x6008000C,  //  001C  GETGBL	R2	G12
+      0x880C0102,  //  001D  GETMBR	R3	R0	K2
+      0x7C080200,  //  001E  CALL	R2	1
+      0x14080202,  //  001F  LT	R2	R1	R2
+      0x780A0015,  //  0020  JMPF	R2	#0037
+      0x88080102,  //  0021  GETMBR	R2	R0	K2
+      0x94080401,  //  0022  GETIDX	R2	R2	R1
+      0x880C0507,  //  0023  GETMBR	R3	R2	K7
+      0x740E000F,  //  0024  JMPT	R3	#0035
+      0x600C000C,  //  0025  GETGBL	R3	G12
+      0x88100508,  //  0026  GETMBR	R4	R2	K8
+      0x7C0C0200,  //  0027  CALL	R3	1
+      0x240C0700,  //  0028  GT	R3	R3	K0
+      0x780E000A,  //  0029  JMPF	R3	#0035
+      0xB80E1200,  //  002A  GETNGBL	R3	K9
+      0x8C0C070A,  //  002B  GETMET	R3	R3	K10
+      0x8814050B,  //  002C  GETMBR	R5	R2	K11
+      0x7C0C0400,  //  002D  CALL	R3	2
+      0x780E0005,  //  002E  JMPF	R3	#0035
+      0x880C010C,  //  002F  GETMBR	R3	R0	K12
+      0x8C0C070D,  //  0030  GETMET	R3	R3	K13
+      0x5C140400,  //  0031  MOVE	R5	R2
+      0x7C0C0400,  //  0032  CALL	R3	2
+      0x8C0C050E,  //  0033  GETMET	R3	R2	K14
+      0x7C0C0200,  //  0034  CALL	R3	1
+      0x00040305,  //  0035  ADD	R1	R1	K5
+      0x7001FFE4,  //  0036  JMP		#001C
+      0x58040000,  //  0037  LDCONST	R1	K0
+      0x6008000C,  //  0038  GETGBL	R2	G12
+      0x880C0102,  //  0039  GETMBR	R3	R0	K2
+      0x7C080200,  //  003A  CALL	R2	1
+      0x14080202,  //  003B  LT	R2	R1	R2
+      0x780A0012,  //  003C  JMPF	R2	#0050
+      0x88080102,  //  003D  GETMBR	R2	R0	K2
+      0x94080401,  //  003E  GETIDX	R2	R2	R1
+      0x880C0507,  //  003F  GETMBR	R3	R2	K7
+      0x740E000C,  //  0040  JMPT	R3	#004E
+      0xB80E1200,  //  0041  GETNGBL	R3	K9
+      0x8C0C070A,  //  0042  GETMET	R3	R3	K10
+      0x8814050F,  //  0043  GETMBR	R5	R2	K15
+      0x7C0C0400,  //  0044  CALL	R3	2
+      0x780E0007,  //  0045  JMPF	R3	#004E
+      0x880C010C,  //  0046  GETMBR	R3	R0	K12
+      0x8C0C0710,  //  0047  GETMET	R3	R3	K16
+      0x5C140400,  //  0048  MOVE	R5	R2
+      0x7C0C0400,  //  0049  CALL	R3	2
+      0x8C0C050E,  //  004A  GETMET	R3	R2	K14
+      0x7C0C0200,  //  004B  CALL	R3	1
+      0x8C0C0511,  //  004C  GETMET	R3	R2	K17
+      0x7C0C0200,  //  004D  CALL	R3	1
+      0x00040305,  //  004E  ADD	R1	R1	K5
+      0x7001FFE7,  //  004F  JMP		#0038
+      0x88080112,  //  0050  GETMBR	R2	R0	K18
+      0x8C080506,  //  0051  GETMET	R2	R2	K6
+      0x7C080200,  //  0052  CALL	R2	1
+      0x80000000,  //  0053  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
 /********************************************************************
 ** Solidified function: attribute_updated_ctx
 ********************************************************************/
 be_local_closure(Matter_IM_Subscription_Shop_attribute_updated_ctx,   /* name */
   be_nested_proto(
-    8,                          /* nstack */
+    7,                          /* nstack */
     3,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -688,30 +871,51 @@ be_local_closure(Matter_IM_Subscription_Shop_attribute_updated_ctx,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 4]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_const_int(0),
-    /* K1   */  be_nested_str_weak(subs),
-    /* K2   */  be_nested_str_weak(attribute_updated_ctx),
-    /* K3   */  be_const_int(1),
+    /* K1   */  be_nested_str_weak(change_set),
+    /* K2   */  be_nested_str_weak(endpoint),
+    /* K3   */  be_nested_str_weak(cluster),
+    /* K4   */  be_nested_str_weak(attribute),
+    /* K5   */  be_nested_str_weak(fabric_filtered),
+    /* K6   */  be_const_int(1),
+    /* K7   */  be_nested_str_weak(push),
     }),
     be_str_weak(attribute_updated_ctx),
     &be_const_str_solidified,
-    ( &(const binstruction[15]) {  /* code */
+    ( &(const binstruction[32]) {  /* code */
       0x580C0000,  //  0000  LDCONST	R3	K0
       0x6010000C,  //  0001  GETGBL	R4	G12
       0x88140101,  //  0002  GETMBR	R5	R0	K1
       0x7C100200,  //  0003  CALL	R4	1
       0x14100604,  //  0004  LT	R4	R3	R4
-      0x78120007,  //  0005  JMPF	R4	#000E
+      0x78120013,  //  0005  JMPF	R4	#001A
       0x88100101,  //  0006  GETMBR	R4	R0	K1
       0x94100803,  //  0007  GETIDX	R4	R4	R3
-      0x8C100902,  //  0008  GETMET	R4	R4	K2
-      0x5C180200,  //  0009  MOVE	R6	R1
-      0x5C1C0400,  //  000A  MOVE	R7	R2
-      0x7C100600,  //  000B  CALL	R4	3
-      0x000C0703,  //  000C  ADD	R3	R3	K3
-      0x7001FFF2,  //  000D  JMP		#0001
-      0x80000000,  //  000E  RET	0
+      0x88140902,  //  0008  GETMBR	R5	R4	K2
+      0x88180302,  //  0009  GETMBR	R6	R1	K2
+      0x1C140A06,  //  000A  EQ	R5	R5	R6
+      0x7816000B,  //  000B  JMPF	R5	#0018
+      0x88140903,  //  000C  GETMBR	R5	R4	K3
+      0x88180303,  //  000D  GETMBR	R6	R1	K3
+      0x1C140A06,  //  000E  EQ	R5	R5	R6
+      0x78160007,  //  000F  JMPF	R5	#0018
+      0x88140904,  //  0010  GETMBR	R5	R4	K4
+      0x88180304,  //  0011  GETMBR	R6	R1	K4
+      0x1C140A06,  //  0012  EQ	R5	R5	R6
+      0x78160003,  //  0013  JMPF	R5	#0018
+      0x780A0001,  //  0014  JMPF	R2	#0017
+      0x50140200,  //  0015  LDBOOL	R5	1	0
+      0x90120A05,  //  0016  SETMBR	R4	K5	R5
+      0x80000A00,  //  0017  RET	0
+      0x000C0706,  //  0018  ADD	R3	R3	K6
+      0x7001FFE6,  //  0019  JMP		#0001
+      0x90060A02,  //  001A  SETMBR	R1	K5	R2
+      0x88100101,  //  001B  GETMBR	R4	R0	K1
+      0x8C100907,  //  001C  GETMET	R4	R4	K7
+      0x5C180200,  //  001D  MOVE	R6	R1
+      0x7C100400,  //  001E  CALL	R4	2
+      0x80000000,  //  001F  RET	0
     })
   )
 );
@@ -719,11 +923,11 @@ be_local_closure(Matter_IM_Subscription_Shop_attribute_updated_ctx,   /* name */
 
 
 /********************************************************************
-** Solidified function: remove_by_session
+** Solidified function: get_by_id
 ********************************************************************/
-be_local_closure(Matter_IM_Subscription_Shop_remove_by_session,   /* name */
+be_local_closure(Matter_IM_Subscription_Shop_get_by_id,   /* name */
   be_nested_proto(
-    6,                          /* nstack */
+    5,                          /* nstack */
     2,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -731,35 +935,32 @@ be_local_closure(Matter_IM_Subscription_Shop_remove_by_session,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 5]) {     /* constants */
+    ( &(const bvalue[ 4]) {     /* constants */
     /* K0   */  be_const_int(0),
     /* K1   */  be_nested_str_weak(subs),
-    /* K2   */  be_nested_str_weak(session),
-    /* K3   */  be_nested_str_weak(remove),
-    /* K4   */  be_const_int(1),
+    /* K2   */  be_nested_str_weak(subscription_id),
+    /* K3   */  be_const_int(1),
     }),
-    be_str_weak(remove_by_session),
+    be_str_weak(get_by_id),
     &be_const_str_solidified,
-    ( &(const binstruction[19]) {  /* code */
+    ( &(const binstruction[17]) {  /* code */
       0x58080000,  //  0000  LDCONST	R2	K0
       0x600C000C,  //  0001  GETGBL	R3	G12
       0x88100101,  //  0002  GETMBR	R4	R0	K1
       0x7C0C0200,  //  0003  CALL	R3	1
       0x140C0403,  //  0004  LT	R3	R2	R3
-      0x780E000B,  //  0005  JMPF	R3	#0012
+      0x780E0009,  //  0005  JMPF	R3	#0010
       0x880C0101,  //  0006  GETMBR	R3	R0	K1
       0x940C0602,  //  0007  GETIDX	R3	R3	R2
       0x880C0702,  //  0008  GETMBR	R3	R3	K2
       0x1C0C0601,  //  0009  EQ	R3	R3	R1
-      0x780E0004,  //  000A  JMPF	R3	#0010
+      0x780E0002,  //  000A  JMPF	R3	#000E
       0x880C0101,  //  000B  GETMBR	R3	R0	K1
-      0x8C0C0703,  //  000C  GETMET	R3	R3	K3
-      0x5C140400,  //  000D  MOVE	R5	R2
-      0x7C0C0400,  //  000E  CALL	R3	2
-      0x70020000,  //  000F  JMP		#0011
-      0x00080504,  //  0010  ADD	R2	R2	K4
-      0x7001FFEE,  //  0011  JMP		#0001
-      0x80000000,  //  0012  RET	0
+      0x940C0602,  //  000C  GETIDX	R3	R3	R2
+      0x80040600,  //  000D  RET	1	R3
+      0x00080503,  //  000E  ADD	R2	R2	K3
+      0x7001FFF0,  //  000F  JMP		#0001
+      0x80000000,  //  0010  RET	0
     })
   )
 );
@@ -779,59 +980,26 @@ be_local_closure(Matter_IM_Subscription_Shop_init,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 2]) {     /* constants */
+    ( &(const bvalue[ 4]) {     /* constants */
     /* K0   */  be_nested_str_weak(im),
     /* K1   */  be_nested_str_weak(subs),
+    /* K2   */  be_nested_str_weak(change_set),
+    /* K3   */  be_nested_str_weak(reports),
     }),
     be_str_weak(init),
     &be_const_str_solidified,
-    ( &(const binstruction[ 5]) {  /* code */
+    ( &(const binstruction[11]) {  /* code */
       0x90020001,  //  0000  SETMBR	R0	K0	R1
       0x60080012,  //  0001  GETGBL	R2	G18
       0x7C080000,  //  0002  CALL	R2	0
       0x90020202,  //  0003  SETMBR	R0	K1	R2
-      0x80000000,  //  0004  RET	0
-    })
-  )
-);
-/*******************************************************************/
-
-
-/********************************************************************
-** Solidified function: remove_by_fabric
-********************************************************************/
-be_local_closure(Matter_IM_Subscription_Shop_remove_by_fabric,   /* name */
-  be_nested_proto(
-    7,                          /* nstack */
-    2,                          /* argc */
-    2,                          /* varg */
-    0,                          /* has upvals */
-    NULL,                       /* no upvals */
-    0,                          /* has sup protos */
-    NULL,                       /* no sub protos */
-    1,                          /* has constants */
-    ( &(const bvalue[ 3]) {     /* constants */
-    /* K0   */  be_nested_str_weak(_sessions),
-    /* K1   */  be_nested_str_weak(remove_by_session),
-    /* K2   */  be_nested_str_weak(stop_iteration),
-    }),
-    be_str_weak(remove_by_fabric),
-    &be_const_str_solidified,
-    ( &(const binstruction[14]) {  /* code */
-      0x60080010,  //  0000  GETGBL	R2	G16
-      0x880C0300,  //  0001  GETMBR	R3	R1	K0
-      0x7C080200,  //  0002  CALL	R2	1
-      0xA8020005,  //  0003  EXBLK	0	#000A
-      0x5C0C0400,  //  0004  MOVE	R3	R2
-      0x7C0C0000,  //  0005  CALL	R3	0
-      0x8C100101,  //  0006  GETMET	R4	R0	K1
-      0x5C180600,  //  0007  MOVE	R6	R3
-      0x7C100400,  //  0008  CALL	R4	2
-      0x7001FFF9,  //  0009  JMP		#0004
-      0x58080002,  //  000A  LDCONST	R2	K2
-      0xAC080200,  //  000B  CATCH	R2	1	0
-      0xB0080000,  //  000C  RAISE	2	R0	R0
-      0x80000000,  //  000D  RET	0
+      0x60080012,  //  0004  GETGBL	R2	G18
+      0x7C080000,  //  0005  CALL	R2	0
+      0x90020402,  //  0006  SETMBR	R0	K2	R2
+      0x60080012,  //  0007  GETGBL	R2	G18
+      0x7C080000,  //  0008  CALL	R2	0
+      0x90020602,  //  0009  SETMBR	R0	K3	R2
+      0x80000000,  //  000A  RET	0
     })
   )
 );
@@ -842,20 +1010,24 @@ be_local_closure(Matter_IM_Subscription_Shop_remove_by_fabric,   /* name */
 ** Solidified class: Matter_IM_Subscription_Shop
 ********************************************************************/
 be_local_class(Matter_IM_Subscription_Shop,
-    2,
+    4,
     NULL,
-    be_nested_map(10,
+    be_nested_map(14,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_const_key_weak(every_250ms, -1), be_const_closure(Matter_IM_Subscription_Shop_every_250ms_closure) },
+        { be_const_key_weak(change_set, 4), be_const_var(2) },
+        { be_const_key_weak(new_subscription, 2), be_const_closure(Matter_IM_Subscription_Shop_new_subscription_closure) },
+        { be_const_key_weak(add_report, -1), be_const_closure(Matter_IM_Subscription_Shop_add_report_closure) },
+        { be_const_key_weak(find_report, -1), be_const_closure(Matter_IM_Subscription_Shop_find_report_closure) },
+        { be_const_key_weak(reports, -1), be_const_var(3) },
+        { be_const_key_weak(remove_by_fabric, 7), be_const_closure(Matter_IM_Subscription_Shop_remove_by_fabric_closure) },
+        { be_const_key_weak(remove_by_session, -1), be_const_closure(Matter_IM_Subscription_Shop_remove_by_session_closure) },
+        { be_const_key_weak(init, -1), be_const_closure(Matter_IM_Subscription_Shop_init_closure) },
+        { be_const_key_weak(remove_sub, 11), be_const_closure(Matter_IM_Subscription_Shop_remove_sub_closure) },
+        { be_const_key_weak(attribute_updated_ctx, 10), be_const_closure(Matter_IM_Subscription_Shop_attribute_updated_ctx_closure) },
         { be_const_key_weak(get_by_id, -1), be_const_closure(Matter_IM_Subscription_Shop_get_by_id_closure) },
-        { be_const_key_weak(attribute_updated_ctx, -1), be_const_closure(Matter_IM_Subscription_Shop_attribute_updated_ctx_closure) },
-        { be_const_key_weak(init, 2), be_const_closure(Matter_IM_Subscription_Shop_init_closure) },
-        { be_const_key_weak(remove_sub, -1), be_const_closure(Matter_IM_Subscription_Shop_remove_sub_closure) },
-        { be_const_key_weak(new_subscription, 3), be_const_closure(Matter_IM_Subscription_Shop_new_subscription_closure) },
-        { be_const_key_weak(subs, 8), be_const_var(0) },
+        { be_const_key_weak(every_250ms, -1), be_const_closure(Matter_IM_Subscription_Shop_every_250ms_closure) },
+        { be_const_key_weak(subs, -1), be_const_var(0) },
         { be_const_key_weak(im, -1), be_const_var(1) },
-        { be_const_key_weak(remove_by_session, -1), be_const_closure(Matter_IM_Subscription_Shop_remove_by_session_closure) },
-        { be_const_key_weak(remove_by_fabric, -1), be_const_closure(Matter_IM_Subscription_Shop_remove_by_fabric_closure) },
     })),
     be_str_weak(Matter_IM_Subscription_Shop)
 );
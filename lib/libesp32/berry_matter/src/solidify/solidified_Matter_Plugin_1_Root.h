@@ -1197,6 +1197,49 @@ be_local_closure(Matter_Plugin_Root_write_attribute,   /* name */
 /*******************************************************************/
 
 
+/********************************************************************
+** Solidified function: is_session_dependent
+********************************************************************/
+be_local_closure(Matter_Plugin_Root_is_session_dependent,   /* name */
+  be_nested_proto(
+    5,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 3]) {     /* constants */
+    /* K0   */  be_nested_str_weak(cluster),
+    /* K1   */  be_nested_str_weak(attribute),
+    /* K2   */  be_const_int(0),
+    }),
+    be_str_weak(is_session_dependent),
+    &be_const_str_solidified,
+    ( &(const binstruction[16]) {  /* code */
+      0x88080300,  //  0000  GETMBR	R2	R1	K0
+      0x880C0301,  //  0001  GETMBR	R3	R1	K1
+      0x5412002F,  //  0002  LDINT	R4	48
+      0x1C100404,  //  0003  EQ	R4	R2	R4
+      0x78120001,  //  0004  JMPF	R4	#0007
+      0x1C100702,  //  0005  EQ	R4	R3	K2
+      0x74120006,  //  0006  JMPT	R4	#000E
+      0x5412003D,  //  0007  LDINT	R4	62
+      0x1C100404,  //  0008  EQ	R4	R2	R4
+      0x78120002,  //  0009  JMPF	R4	#000D
+      0x54120004,  //  000A  LDINT	R4	5
+      0x1C100604,  //  000B  EQ	R4	R3	R4
+      0x74120000,  //  000C  JMPT	R4	#000E
+      0x50100001,  //  000D  LDBOOL	R4	0	1
+      0x50100200,  //  000E  LDBOOL	R4	1	0
+      0x80040800,  //  000F  RET	1	R4
+    })
+  )
+);
+/*******************************************************************/
+
+
 /********************************************************************
 ** Solidified function: invoke_request
 ********************************************************************/
@@ -2103,18 +2146,19 @@ extern const bclass be_class_Matter_Plugin;
 be_local_class(Matter_Plugin_Root,
     0,
     &be_class_Matter_Plugin,
-    be_nested_map(7,
+    be_nested_map(8,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_const_key_weak(read_attribute, 1), be_const_closure(Matter_Plugin_Root_read_attribute_closure) },
-        { be_const_key_weak(invoke_request, 6), be_const_closure(Matter_Plugin_Root_invoke_request_closure) },
-        { be_const_key_weak(TYPE, -1), be_nested_str_weak(root) },
-        { be_const_key_weak(TYPES, 2), be_const_simple_instance(be_nested_simple_instance(&be_class_map, {
+        { be_const_key_weak(invoke_request, -1), be_const_closure(Matter_Plugin_Root_invoke_request_closure) },
+        { be_const_key_weak(read_attribute, 7), be_const_closure(Matter_Plugin_Root_read_attribute_closure) },
+        { be_const_key_weak(TYPES, 1), be_const_simple_instance(be_nested_simple_instance(&be_class_map, {
         be_const_map( *     be_nested_map(1,
     ( (struct bmapnode*) &(const bmapnode[]) {
         { be_const_key_int(22, -1), be_const_int(1) },
     }))    ) } )) },
-        { be_const_key_weak(write_attribute, -1), be_const_closure(Matter_Plugin_Root_write_attribute_closure) },
+        { be_const_key_weak(write_attribute, 0), be_const_closure(Matter_Plugin_Root_write_attribute_closure) },
         { be_const_key_weak(DISPLAY_NAME, -1), be_nested_str_weak(Root_X20node) },
+        { be_const_key_weak(TYPE, 4), be_nested_str_weak(root) },
+        { be_const_key_weak(is_session_dependent, -1), be_const_closure(Matter_Plugin_Root_is_session_dependent_closure) },
         { be_const_key_weak(CLUSTERS, -1), be_const_simple_instance(be_nested_simple_instance(&be_class_map, {
         be_const_map( *     be_nested_map(14,
     ( (struct bmapnode*) &(const bmapnode[]) {
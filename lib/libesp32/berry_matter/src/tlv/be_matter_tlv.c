@@ -0,0 +1,735 @@
+/*
+  be_matter_tlv.c - native encoding and decoding of Matter TLV structures (Tag/Length/Value) Appendix A.
+
+  Copyright (C) 2023  Stephan Hadinger & Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/********************************************************************
+ * Native helpers for `Matter_TLV`
+ *
+ * The Berry classes `Matter_TLV_item`, `Matter_TLV_list`, `Matter_TLV_struct`
+ * and `Matter_TLV_array` stay the public API. This module does the
+ * byte-level work for them:
+ *
+ * `matter_tlv.parse(cls:class, b:bytes [, idx:int, parent]) -> instance`
+ *    the whole buffer is first scanned as a flat sequence of elements
+ *    (`tlv_elt_t`) and validated, then only the first element is built.
+ *    A container keeps its encoded bytes in `_raw` and its children are
+ *    built by `expand()` when they are first accessed, so an element that
+ *    is never read costs no allocation.
+ *    `cls` is `Matter_TLV` and provides the classes to instanciate.
+ *
+ * `matter_tlv.expand(item) -> nil`
+ *    builds the direct children of a parsed container into `val`.
+ *
+ * `matter_tlv.encode(item, b:bytes) -> bytes`
+ *    serializes the tree `item` directly at the end of the buffer of `b`,
+ *    which grows geometrically and is trimmed to the exact length once done.
+ *
+ * `matter_tlv.encode_len(item) -> int`
+ *    size in bytes of the encoded tree, without encoding it.
+ *******************************************************************/
+
+#include "be_constobj.h"
+#include "be_mapping.h"
+#include <stdio.h>
+#include <string.h>
+
+// TLV types, see Matter_TLV.be
+enum {
+  TLV_I1 = 0x00, TLV_I2, TLV_I4, TLV_I8,
+  TLV_U1, TLV_U2, TLV_U4, TLV_U8,
+  TLV_BFALSE, TLV_BTRUE, TLV_FLOAT, TLV_DOUBLE,
+  TLV_UTF1, TLV_UTF2, TLV_UTF4, TLV_UTF8,
+  TLV_B1, TLV_B2, TLV_B4, TLV_B8,
+  TLV_NULL, TLV_STRUCT, TLV_ARRAY, TLV_LIST, TLV_EOC,
+  TLV_RAW = 0xFF
+};
+
+#define TLV_MAX_DEPTH     24      // maximum nesting of containers
+
+// length of the value for each type, negative is the size of the length prefix, -99 for containers
+static const int8_t tlv_len[] = {
+  1, 2, 4, 8, 1, 2, 4, 8,
+  0, 0, 4, 8,
+  -1, -2, -4, -8,
+  -1, -2, -4, -8,
+  0, -99, -99, -99, 0
+};
+
+// one element of the flat representation of a TLV buffer
+typedef struct {
+  uint8_t   typ;          // TLV type
+  uint8_t   control;      // tag control 0x00-0xE0
+  bbool     has_vendor;
+  bbool     has_number;
+  bbool     has_sub;
+  int32_t   profile;      // -1 for Matter common profile, only valid if has_vendor or common profile
+  int32_t   vendor;
+  int32_t   number;
+  int32_t   sub;
+  uint32_t  val_idx;      // offset of the value in the buffer
+  uint32_t  val_len;      // length of the value (excluding length prefix)
+  uint32_t  next_idx;     // offset of the next element
+} tlv_elt_t;
+
+static inline uint32_t tlv_get_le(const uint8_t *p, int len) {
+  uint32_t v = 0;
+  for (int i = len - 1; i >= 0; i--) {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+/*********************************************************************************************\
+ * Decoding
+\*********************************************************************************************/
+// decode the element at `idx`, returns NULL if ok or an error message
+static const char * tlv_scan_elt(const uint8_t *buf, size_t len, uint32_t idx, tlv_elt_t *elt) {
+  if (idx >= len) { return "truncated TLV"; }
+  memset(elt, 0, sizeof(tlv_elt_t));
+  elt->typ = buf[idx] & 0x1F;
+  elt->control = buf[idx] & 0xE0;
+  idx++;
+  if (elt->typ > TLV_EOC) { return "invalid TLV type"; }
+
+  // tag
+  uint32_t tag_len;
+  switch (elt->control) {
+    case 0x00:  tag_len = 0; break;
+    case 0x20:  tag_len = 1; break;
+    case 0x40:  case 0x80:  tag_len = 2; break;
+    case 0x60:  case 0xA0:  tag_len = 4; break;
+    case 0xC0:  tag_len = 6; break;
+    default:    tag_len = 8; break;     // 0xE0
+  }
+  if (idx + tag_len > len) { return "truncated TLV"; }
+  if (elt->control == 0xC0 || elt->control == 0xE0) {
+    elt->has_vendor = btrue;
+    elt->vendor = tlv_get_le(buf + idx, 2);
+    elt->profile = tlv_get_le(buf + idx + 2, 2);
+    idx += 4;
+    tag_len -= 4;
+  } else if (elt->control == 0x40 || elt->control == 0x60) {
+    elt->profile = -1;
+  }
+  if (elt->control == 0x20) {
+    elt->has_sub = btrue;
+    elt->sub = buf[idx];
+  } else if (tag_len > 0) {
+    elt->has_number = btrue;
+    elt->number = (int32_t) tlv_get_le(buf + idx, tag_len);
+  }
+  idx += tag_len;
+
+  // value
+  int item_len = tlv_len[elt->typ];
+  if (item_len >= 0) {
+    elt->val_idx = idx;
+    elt->val_len = item_len;
+  } else if (item_len >= -4) {          // length prefix of 1/2/4 bytes
+    if (idx + (-item_len) > len) { return "truncated TLV"; }
+    elt->val_len = tlv_get_le(buf + idx, -item_len);
+    elt->val_idx = idx + (-item_len);
+  } else if (item_len == -8) {
+    return "unsupported TLV length";
+  } else {                              // container, value is the following elements
+    elt->val_idx = idx;
+    elt->val_len = 0;
+  }
+  if (elt->val_len > len || elt->val_idx + elt->val_len > len) { return "truncated TLV"; }
+  elt->next_idx = elt->val_idx + elt->val_len;
+  return NULL;
+}
+
+// walk the flat sequence of elements from `idx` and check that containers are balanced
+static uint32_t tlv_validate(bvm *vm, const uint8_t *buf, size_t len, uint32_t idx) {
+  int depth = 0;
+  do {
+    tlv_elt_t elt;
+    const char * err = tlv_scan_elt(buf, len, idx, &elt);
+    if (err) { be_raise(vm, "TLV_error", err); }
+    if (elt.typ >= TLV_STRUCT && elt.typ <= TLV_LIST) {
+      if (++depth > TLV_MAX_DEPTH) { be_raise(vm, "TLV_error", "TLV too deep"); }
+    } else if (elt.typ == TLV_EOC) {
+      // only an anonymous EOC closes a container
+      if (buf[idx] != TLV_EOC || depth == 0) { be_raise(vm, "TLV_error", "unexpected end of container"); }
+      depth--;
+    }
+    idx = elt.next_idx;
+  } while (depth > 0);
+  return idx;
+}
+
+// set member `name` of instance at `obj` with the value on top of stack, and pop it
+static void tlv_setmember(bvm *vm, int obj, const char *name) {
+  be_setmember(vm, obj, name);
+  be_pop(vm, 1);
+}
+
+static void tlv_setmember_int(bvm *vm, int obj, const char *name, bint v) {
+  be_pushint(vm, v);
+  tlv_setmember(vm, obj, name);
+}
+
+// read an optional int member, returns bfalse if nil
+static bbool tlv_getmember_int(bvm *vm, int obj, const char *name, int32_t *v) {
+  bbool found = be_getmember(vm, obj, name) && !be_isnil(vm, -1);
+  if (found) { *v = be_toint(vm, -1); }
+  be_pop(vm, 1);
+  return found;
+}
+
+// push the value of a scalar element
+static void tlv_push_value(bvm *vm, int b_idx, const uint8_t *buf, const tlv_elt_t *elt) {
+  const uint8_t *p = buf + elt->val_idx;
+  switch (elt->typ) {
+    case TLV_I1:  be_pushint(vm, (int8_t) p[0]);  break;
+    case TLV_I2:  be_pushint(vm, (int16_t) tlv_get_le(p, 2));  break;
+    case TLV_I4:  be_pushint(vm, (int32_t) tlv_get_le(p, 4));  break;
+    case TLV_U1:  be_pushint(vm, p[0]);  break;
+    case TLV_U2:  be_pushint(vm, tlv_get_le(p, 2));  break;
+    case TLV_U4:  be_pushint(vm, (int32_t) tlv_get_le(p, 4));  break;
+    case TLV_BFALSE:  be_pushbool(vm, bfalse);  break;
+    case TLV_BTRUE:   be_pushbool(vm, btrue);  break;
+    case TLV_FLOAT:
+      {
+        union { uint32_t u; float f; } v;
+        v.u = tlv_get_le(p, 4);
+        be_pushreal(vm, (breal) v.f);
+      }
+      break;
+    case TLV_I8: case TLV_U8: case TLV_DOUBLE:  // int64.frombytes(b, idx)
+      be_getglobal(vm, "int64");
+      be_getmember(vm, -1, "frombytes");
+      be_remove(vm, -2);
+      be_pushvalue(vm, b_idx);
+      be_pushint(vm, elt->val_idx);
+      be_call(vm, 2);
+      be_pop(vm, 2);
+      break;
+    case TLV_UTF1: case TLV_UTF2: case TLV_UTF4: case TLV_UTF8:
+      be_pushnstring(vm, (const char*) p, elt->val_len);
+      break;
+    case TLV_B1: case TLV_B2: case TLV_B4: case TLV_B8:
+      be_pushbytes(vm, p, elt->val_len);
+      break;
+    default:      // TLV_NULL, unexpected TLV_EOC
+      be_pushnil(vm);
+      break;
+  }
+}
+
+// build the Berry object for the element at `idx` of `_raw` (stack index `raw`), push it and return the index of the next element
+// `cls` is the stack index of the `Matter_TLV` class, `parent` of the parent object
+// `delta` is added to the indices in `_raw` to get `next_idx` in the original buffer
+// containers are not decoded, they keep a reference to `_raw` and their children are built on first access
+static uint32_t tlv_build(bvm *vm, int cls, int raw, const uint8_t *buf, size_t len, uint32_t idx, int parent, bbool anonymous, int32_t delta) {
+  tlv_elt_t elt;
+  const char * err = tlv_scan_elt(buf, len, idx, &elt);
+  if (err) { be_raise(vm, "TLV_error", err); }
+  be_stack_require(vm, 6 + BE_STACK_FREE_MIN);
+
+  const char * cl_name;
+  switch (elt.typ) {
+    case TLV_STRUCT:  cl_name = "Matter_TLV_struct";  break;
+    case TLV_ARRAY:   cl_name = "Matter_TLV_array";   break;
+    case TLV_LIST:    cl_name = "Matter_TLV_list";    break;
+    default:          cl_name = "Matter_TLV_item";    break;
+  }
+  be_getmember(vm, cls, cl_name);
+  be_pushvalue(vm, parent);
+  be_call(vm, 1);
+  be_pop(vm, 1);
+  int item = be_absindex(vm, -1);
+
+  tlv_setmember_int(vm, item, "typ", elt.typ);
+  if (!anonymous) {       // elements of arrays have their tags removed
+    if (elt.has_vendor) {
+      tlv_setmember_int(vm, item, "tag_vendor", elt.vendor);
+    }
+    if (elt.has_vendor || elt.profile == -1) {
+      tlv_setmember_int(vm, item, "tag_profile", elt.profile);
+    }
+    if (elt.has_number) {
+      tlv_setmember_int(vm, item, "tag_number", elt.number);
+    }
+    if (elt.has_sub) {
+      tlv_setmember_int(vm, item, "tag_sub", elt.sub);
+    }
+  }
+
+  if (elt.typ >= TLV_STRUCT && elt.typ <= TLV_LIST) {
+    idx = tlv_validate(vm, buf, len, idx);
+    if (idx > elt.next_idx + 1) {           // not empty, `val` stays the empty list from `init()` otherwise
+      be_pushvalue(vm, raw);
+      tlv_setmember(vm, item, "_raw");
+      tlv_setmember_int(vm, item, "_idx", elt.next_idx);
+      be_pushnil(vm);
+      tlv_setmember(vm, item, "val");
+    }
+  } else {
+    tlv_push_value(vm, raw, buf, &elt);
+    tlv_setmember(vm, item, "val");
+    idx = elt.next_idx;
+  }
+  tlv_setmember_int(vm, item, "next_idx", idx + delta);
+  return idx;
+}
+
+// `matter_tlv.parse(cls:class, b:bytes [, idx:int, parent]) -> instance`
+//
+// the buffer is validated first, a container gets a copy of its encoded bytes so that `b` can be reused by the caller
+static int matter_tlv_parse(bvm *vm) {
+  int32_t argc = be_top(vm);
+  if (argc >= 2 && be_isclass(vm, 1) && be_isbytes(vm, 2)) {
+    size_t len;
+    const uint8_t * buf = (const uint8_t*) be_tobytes(vm, 2, &len);
+    uint32_t idx = (argc >= 3 && be_isint(vm, 3)) ? be_toint(vm, 3) : 0;
+    while (be_top(vm) < 4) { be_pushnil(vm); }    // parent
+    uint32_t next_idx = tlv_validate(vm, buf, len, idx);    // raises an exception if the buffer is malformed
+    if ((buf[idx] & 0x1F) >= TLV_STRUCT && (buf[idx] & 0x1F) <= TLV_LIST) {
+      be_pushbytes(vm, buf + idx, next_idx - idx);
+      int raw = be_absindex(vm, -1);
+      buf = (const uint8_t*) be_tobytes(vm, raw, &len);
+      tlv_build(vm, 1, raw, buf, len, 0, 4, bfalse, idx);
+    } else {
+      tlv_build(vm, 1, 2, buf, len, idx, 4, bfalse, 0);
+    }
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+// decode the children of the parsed container at stack index `item`, if not already done
+static void tlv_expand(bvm *vm, int item) {
+  be_stack_require(vm, 8 + BE_STACK_FREE_MIN);
+  if (!be_getmember(vm, item, "_raw") || !be_isbytes(vm, -1)) {
+    be_pop(vm, 1);
+    return;                               // not parsed, or already decoded
+  }
+  int raw = be_absindex(vm, -1);
+  size_t len;
+  const uint8_t * buf = (const uint8_t*) be_tobytes(vm, raw, &len);
+  int32_t idx = 0, next_idx = 0, typ = 0;
+  tlv_getmember_int(vm, item, "_idx", &idx);
+  tlv_getmember_int(vm, item, "next_idx", &next_idx);
+  tlv_getmember_int(vm, item, "typ", &typ);
+  be_getmember(vm, item, "TLV");
+  int cls = be_absindex(vm, -1);
+
+  // indices of the children in the original buffer, from the end of this container
+  uint32_t end = idx;
+  while (end < len && buf[end] != TLV_EOC) {
+    end = tlv_validate(vm, buf, len, end);
+  }
+  if (end >= len) { be_raise(vm, "TLV_error", "truncated TLV"); }
+  int32_t delta = next_idx - (int32_t)(end + 1);
+
+  be_newobject(vm, "list");               // instance and `.p`
+  int list = be_absindex(vm, -1);
+  while (idx < (int32_t)end) {
+    idx = tlv_build(vm, cls, raw, buf, len, idx, item, typ == TLV_ARRAY, delta);
+    be_data_push(vm, list);
+    be_pop(vm, 1);
+  }
+  be_pop(vm, 1);                          // `.p`
+  tlv_setmember(vm, item, "val");
+  be_pushnil(vm);
+  tlv_setmember(vm, item, "_raw");
+  be_pushnil(vm);
+  tlv_setmember(vm, item, "_idx");
+  be_pop(vm, 2);                          // `_raw` and class
+}
+
+// `matter_tlv.expand(item) -> nil`
+static int matter_tlv_expand(bvm *vm) {
+  if (be_top(vm) >= 1 && be_isinstance(vm, 1)) {
+    tlv_expand(vm, 1);
+  }
+  be_return_nil(vm);
+}
+
+/*********************************************************************************************\
+ * Encoding
+\*********************************************************************************************/
+typedef struct {
+  bvm     *vm;
+  int      b;             // stack index of the destination bytes(), 0 when only computing the length
+  uint8_t *buf;           // buffer of the destination bytes()
+  size_t   len;           // current length, including what was already in the bytes()
+  size_t   size;          // current size of the bytes() buffer
+} tlv_out_t;
+
+// tags of an item, for sorting structs
+typedef struct {
+  bbool     has_vendor, has_profile, has_number, has_sub;
+  int32_t   vendor, profile, number, sub;
+} tlv_tag_t;
+
+// resize the destination bytes() object and fetch its new buffer
+static void tlv_out_resize(tlv_out_t *out, size_t size) {
+  bvm *vm = out->vm;
+  be_getmember(vm, out->b, "resize");
+  be_pushvalue(vm, out->b);
+  be_pushint(vm, size);
+  be_call(vm, 2);
+  be_pop(vm, 3);
+  be_getmember(vm, out->b, "_buffer");
+  be_pushvalue(vm, out->b);
+  be_call(vm, 1);
+  out->buf = (uint8_t*) be_tocomptr(vm, -2);
+  be_pop(vm, 2);
+  out->size = size;
+}
+
+// the bytes() object grows geometrically, it is trimmed to the exact length at the end
+static void tlv_out_reserve(tlv_out_t *out, size_t n) {
+  if (out->b && out->len + n > out->size) {
+    size_t size = out->size * 2;
+    if (size < out->len + n) { size = out->len + n; }
+    if (size < 64) { size = 64; }
+    tlv_out_resize(out, size);
+  }
+}
+
+static void tlv_out_add(tlv_out_t *out, uint32_t v, int len) {
+  tlv_out_reserve(out, len);
+  if (out->b) {
+    for (int i = 0; i < len; i++) {
+      out->buf[out->len + i] = (uint8_t) v;
+      v >>= 8;
+    }
+  }
+  out->len += len;
+}
+
+static void tlv_out_raw(tlv_out_t *out, const void *p, size_t len) {
+  tlv_out_reserve(out, len);
+  if (out->b) { memmove(out->buf + out->len, p, len); }
+  out->len += len;
+}
+
+static bbool tlv_getmember_bool(bvm *vm, int obj, const char *name) {
+  bbool ret = be_getmember(vm, obj, name) && be_tobool(vm, -1);
+  be_pop(vm, 1);
+  return ret;
+}
+
+static void tlv_get_tag(bvm *vm, int obj, tlv_tag_t *tag) {
+  tag->has_vendor = tlv_getmember_int(vm, obj, "tag_vendor", &tag->vendor);
+  tag->has_profile = tlv_getmember_int(vm, obj, "tag_profile", &tag->profile);
+  tag->has_number = tlv_getmember_int(vm, obj, "tag_number", &tag->number);
+  tag->has_sub = tlv_getmember_int(vm, obj, "tag_sub", &tag->sub);
+}
+
+// same as `Matter_TLV_item._cmp_gt()`: returns btrue if `a` is strictly greater than `k`
+static bbool tlv_tag_gt(const tlv_tag_t *a, const tlv_tag_t *k) {
+  if (a->has_vendor) {
+    if (!k->has_vendor)                   { return btrue; }
+    if (a->vendor > k->vendor)            { return btrue; }
+    if (a->vendor == k->vendor) {
+      if (a->profile > k->profile)        { return btrue; }
+    }
+  }
+  if (a->has_profile && a->profile == -1) {
+    if (!k->has_profile)                  { return btrue; }
+  } else if (!a->has_profile) {
+    if (k->has_profile && k->profile == -1) { return bfalse; }
+  }
+  if (a->has_number) {
+    if (!k->has_number)                   { return btrue; }
+    return a->number > k->number;
+  }
+  if (a->has_sub) {
+    if (!k->has_sub)                      { return btrue; }
+    if (a->sub > k->sub)                  { return btrue; }
+  }
+  return bfalse;
+}
+
+// convert value at top of stack to int, like `int()`
+static bint tlv_toint(bvm *vm) {
+  if (be_isint(vm, -1)) { return be_toint(vm, -1); }
+  be_getbuiltin(vm, "int");
+  be_pushvalue(vm, -2);
+  be_call(vm, 1);
+  be_pop(vm, 1);
+  bint v = be_isint(vm, -1) ? be_toint(vm, -1) : 0;
+  be_pop(vm, 1);
+  return v;
+}
+
+// size of the value at top of stack, like `size()` for string and bytes
+static size_t tlv_size(bvm *vm) {
+  if (be_isstring(vm, -1)) { return be_strlen(vm, -1); }
+  if (be_isbytes(vm, -1)) { size_t len; be_tobytes(vm, -1, &len); return len; }
+  be_raise(vm, "value_error", "string or bytes expected");
+  return 0;
+}
+
+static void tlv_encode_tag(tlv_out_t *out, const tlv_tag_t *tag, uint8_t typ) {
+  int32_t number = tag->has_number ? tag->number : 0;
+  bbool huge = (number >= 65536) || (number < 0);
+  if (tag->has_vendor) {
+    tlv_out_add(out, (huge ? 0xE0 : 0xC0) + typ, 1);
+    tlv_out_add(out, tag->vendor, 2);
+    tlv_out_add(out, tag->profile, 2);
+    tlv_out_add(out, number, huge ? 4 : 2);
+  } else if (tag->has_profile && tag->profile == -1) {    // Matter common profile
+    tlv_out_add(out, (huge ? 0x60 : 0x40) + typ, 1);
+    tlv_out_add(out, number, huge ? 4 : 2);
+  } else if (tag->has_profile) {
+    tlv_out_add(out, (huge ? 0xA0 : 0x80) + typ, 1);
+    tlv_out_add(out, number, huge ? 4 : 2);
+  } else if (tag->has_sub) {
+    tlv_out_add(out, 0x20 + typ, 1);
+    tlv_out_add(out, tag->sub, 1);
+  } else {                                                // anonymous tag
+    tlv_out_add(out, typ, 1);
+  }
+}
+
+static void tlv_encode_item(tlv_out_t *out, int item);
+
+// encode the object at top of stack: a TLV item, raw bytes, or any object with `tlv2raw()`/`encode_len()`
+static void tlv_encode_value(tlv_out_t *out) {
+  bvm *vm = out->vm;
+  if (be_isbytes(vm, -1)) {
+    size_t len;
+    const void * p = be_tobytes(vm, -1, &len);
+    tlv_out_raw(out, p, len);
+  } else if (!be_isinstance(vm, -1)) {
+    be_raise(vm, "value_error", "TLV item expected");
+  } else if (be_getmember(vm, -1, "typ")) {
+    be_pop(vm, 1);
+    tlv_encode_item(out, be_absindex(vm, -1));
+  } else {
+    be_pop(vm, 1);
+    be_getmember(vm, -1, out->b ? "tlv2raw" : "encode_len");
+    be_pushvalue(vm, -2);
+    if (out->b) {
+      be_pushbytes(vm, NULL, 0);
+      be_call(vm, 2);
+      be_pop(vm, 2);
+      size_t len;
+      const void * p = be_tobytes(vm, -1, &len);
+      tlv_out_raw(out, p, len);
+    } else {
+      be_call(vm, 1);
+      be_pop(vm, 1);
+      out->len += be_toint(vm, -1);
+    }
+    be_pop(vm, 1);
+  }
+}
+
+static void tlv_encode_container(tlv_out_t *out, int item, const tlv_tag_t *tag, uint8_t typ) {
+  bvm *vm = out->vm;
+  tlv_expand(vm, item);
+  tlv_encode_tag(out, tag, typ);
+  be_getmember(vm, item, "val");
+  be_getmember(vm, -1, ".p");
+  int list = be_absindex(vm, -1);
+  int count = be_data_size(vm, list);
+  if (count > 0) {
+    uint16_t *order = NULL;
+    if (out->b && tlv_getmember_bool(vm, item, "is_struct")) {
+      // structs are encoded in tag order, insertion sort as in `Matter_TLV_item.sort()`
+      // the scratch memory is a bytes() object on the stack, so it is reclaimed even if encoding raises
+      tlv_tag_t *tags = (tlv_tag_t*) be_pushbytes(vm, NULL, count * (sizeof(tlv_tag_t) + sizeof(uint16_t)));
+      order = (uint16_t*) (tags + count);
+      for (int i = 0; i < count; i++) {
+        be_pushint(vm, i);
+        be_getindex(vm, list);
+        if (be_isinstance(vm, -1)) {
+          tlv_get_tag(vm, be_absindex(vm, -1), &tags[i]);
+        } else {
+          memset(&tags[i], 0, sizeof(tlv_tag_t));
+        }
+        be_pop(vm, 2);
+        int j = i;
+        while (j > 0 && tlv_tag_gt(&tags[order[j - 1]], &tags[i])) {
+          order[j] = order[j - 1];
+          j--;
+        }
+        order[j] = i;
+      }
+    }
+    for (int i = 0; i < count; i++) {
+      be_pushint(vm, order ? order[i] : i);
+      be_getindex(vm, list);
+      tlv_encode_value(out);
+      be_pop(vm, 2);
+    }
+    if (order) { be_pop(vm, 1); }
+  }
+  be_pop(vm, 2);
+  tlv_out_add(out, TLV_EOC, 1);
+}
+
+// encode the TLV item at stack index `item`, same rules as `Matter_TLV_item.tlv2raw()`
+static void tlv_encode_item(tlv_out_t *out, int item) {
+  bvm *vm = out->vm;
+  be_stack_require(vm, 8 + BE_STACK_FREE_MIN);
+  int32_t typ = 0;
+  tlv_getmember_int(vm, item, "typ", &typ);
+  tlv_tag_t tag;
+  tlv_get_tag(vm, item, &tag);
+
+  if (typ >= TLV_STRUCT && typ <= TLV_LIST) {
+    tlv_encode_container(out, item, &tag, typ);
+    return;
+  }
+
+  be_getmember(vm, item, "val");
+  if (typ == TLV_RAW) {
+    tlv_encode_value(out);
+    be_pop(vm, 1);
+    return;
+  }
+
+  // compress the type to the smallest possible, and store it back in the item
+  int32_t typ_new = typ;
+  bint i = 0;
+  if (typ == TLV_BFALSE || typ == TLV_BTRUE) {
+    typ_new = be_tobool(vm, -1) ? TLV_BTRUE : TLV_BFALSE;
+  } else if (typ >= TLV_I1 && typ <= TLV_U4 && typ != TLV_I8) {
+    i = tlv_toint(vm);
+    if (typ >= TLV_I2 && typ <= TLV_I4) {
+      if (i <= 127 && i >= -128)            { typ_new = TLV_I1; }
+      else if (i <= 32767 && i >= -32768)   { typ_new = TLV_I2; }
+    } else if (typ >= TLV_U2 && typ <= TLV_U4) {
+      if (i <= 255 && i >= 0)               { typ_new = TLV_U1; }
+      else if (i <= 65535 && i >= 0)        { typ_new = TLV_U2; }
+    }
+  } else if (typ >= TLV_UTF1 && typ <= TLV_B8) {
+    size_t len = tlv_size(vm);
+    int32_t base = (typ <= TLV_UTF8) ? TLV_UTF1 : TLV_B1;
+    typ_new = base + ((len <= 255) ? 0 : (len <= 65535) ? 1 : 2);   // 4 bytes length is unlikely, 8 is impossible
+  }
+  if (typ_new != typ) {
+    typ = typ_new;
+    tlv_setmember_int(vm, item, "typ", typ);
+  }
+
+  tlv_encode_tag(out, &tag, typ);
+  switch (typ) {
+    case TLV_I1: case TLV_U1:   tlv_out_add(out, i, 1);   break;
+    case TLV_I2: case TLV_U2:   tlv_out_add(out, i, 2);   break;
+    case TLV_I4: case TLV_U4:   tlv_out_add(out, i, 4);   break;
+    case TLV_I8: case TLV_U8:   // can be encoded from bytes(8)/int64/int
+      {
+        uint8_t i64[8] = {0};
+        if (!out->b) {
+          // only the length is needed
+        } else if (be_isbytes(vm, -1)) {
+          size_t len;
+          const void * p = be_tobytes(vm, -1, &len);
+          memmove(i64, p, len < 8 ? len : 8);
+        } else if (be_isinstance(vm, -1)) {    // int64
+          be_getmember(vm, -1, "tobytes");
+          be_pushvalue(vm, -2);
+          be_call(vm, 1);
+          be_pop(vm, 1);
+          size_t len;
+          const void * p = be_tobytes(vm, -1, &len);
+          memmove(i64, p, len < 8 ? len : 8);
+          be_pop(vm, 1);
+        } else {
+          int64_t v = tlv_toint(vm);
+          for (int k = 0; k < 8; k++) { i64[k] = (uint8_t) (v >> (8 * k)); }
+        }
+        tlv_out_raw(out, i64, 8);
+      }
+      break;
+    case TLV_BFALSE: case TLV_BTRUE: case TLV_NULL:
+      break;    // no value
+    case TLV_FLOAT:
+      {
+        union { uint32_t u; float f; } v;
+        v.f = be_isnumber(vm, -1) ? (float) be_toreal(vm, -1) : 0.0f;
+        tlv_out_add(out, v.u, 4);
+      }
+      break;
+    case TLV_DOUBLE:
+      be_raise(vm, "value_error", "Unsupported type TLV.DOUBLE");
+      break;
+    case TLV_UTF1: case TLV_UTF2: case TLV_B1: case TLV_B2:
+      {
+        size_t len = tlv_size(vm);
+        tlv_out_add(out, len, (typ == TLV_UTF1 || typ == TLV_B1) ? 1 : 2);
+        if (be_isstring(vm, -1)) {
+          tlv_out_raw(out, be_tostring(vm, -1), len);
+        } else {
+          tlv_out_raw(out, be_tobytes(vm, -1, &len), len);
+        }
+      }
+      break;
+    default:
+      {
+        char msg[32];
+        snprintf(msg, sizeof(msg), "unsupported type %i", (int) typ);
+        be_raise(vm, "value_error", msg);
+      }
+  }
+  be_pop(vm, 1);
+}
+
+// `matter_tlv.encode(item, b:bytes) -> bytes`
+// the encoding is appended directly in the buffer of `b`
+static int matter_tlv_encode(bvm *vm) {
+  int32_t argc = be_top(vm);
+  if (argc >= 2 && be_isbytes(vm, 2)) {
+    size_t b_len;
+    tlv_out_t out = { vm, 2, NULL, 0, 0 };
+    out.buf = (uint8_t*) be_tobytes(vm, 2, &b_len);
+    out.len = out.size = b_len;
+    be_pushvalue(vm, 1);
+    tlv_encode_value(&out);
+    be_pop(vm, 1);
+    if (out.size != out.len) {
+      tlv_out_resize(&out, out.len);    // trim to the actual length
+    }
+    be_pushvalue(vm, 2);
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+// `matter_tlv.encode_len(item) -> int`
+static int matter_tlv_encode_len(bvm *vm) {
+  int32_t argc = be_top(vm);
+  if (argc >= 1) {
+    tlv_out_t out = { vm, 0, NULL, 0, 0 };
+    be_pushvalue(vm, 1);
+    tlv_encode_value(&out);
+    be_pushint(vm, out.len);
+    be_return(vm);
+  }
+  be_raise(vm, "type_error", NULL);
+}
+
+#include "be_fixed_matter_tlv.h"
+
+/* @const_object_info_begin
+module matter_tlv (scope: global, strings: weak) {
+  parse, func(matter_tlv_parse)
+  encode, func(matter_tlv_encode)
+  encode_len, func(matter_tlv_encode_len)
+  expand, func(matter_tlv_expand)
+}
+@const_object_info_end */
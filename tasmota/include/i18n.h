@@ -404,6 +404,7 @@
 #define D_CMND_TOUCH_NUM "TouchNum"
 #define D_CMND_CPU_FREQUENCY "CpuFrequency"
 #endif  // ESP32
+#define D_CMND_PROFILE "Profile"
 
 // Commands xdrv_02_mqtt.ino
 #define D_SO_MQTTJSONONLY "MqttJSONOnly"
@@ -436,6 +436,20 @@ enum XsnsFunctions { FUNC_SETTINGS_OVERRIDE, FUNC_SETUP_RING1, FUNC_SETUP_RING2,
                      FUNC_last_function         // Insert functions WITH return results before here
                      };
 
+// Frequent functions a driver handles, declared in the driver as XDRV_xx_FUNC or XSNS_xx_FUNC.
+// Undeclared drivers get all of them. Other functions are always sent to all drivers.
+#define XFUNC_LOOP                0x01
+#define XFUNC_SLEEP_LOOP          0x02
+#define XFUNC_EVERY_50_MSECOND    0x04
+#define XFUNC_EVERY_100_MSECOND   0x08
+#define XFUNC_EVERY_200_MSECOND   0x10
+#define XFUNC_EVERY_250_MSECOND   0x20
+#define XFUNC_EVERY_SECOND        0x40
+#define XFUNC_NONE                0x00
+#define XFUNC_ALL                 0x7F
+#define XFUNC_FAST_FIRST          FUNC_LOOP           // Bit 0 of XFUNC mask
+#define XFUNC_FAST_COUNT          7                   // FUNC_LOOP up to FUNC_EVERY_SECOND
+
 enum AddressConfigSteps { ADDR_IDLE, ADDR_RECEIVE, ADDR_SEND };
 
 enum SettingsTextIndex { SET_OTAURL,
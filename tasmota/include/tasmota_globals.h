@@ -288,6 +288,7 @@ const char WIFI_HOSTNAME[] = WIFI_DEFAULT_HOSTNAME;    // Override by user_confi
 #define TASM_FILE_ZIGBEE_LEGACY_V2  "/zb"              // Zigbee devices information blob, legacy v2
 #define TASM_FILE_ZIGBEE            "/zbv4"            // Zigbee devices information blob, now v4
 #define TASM_FILE_ZIGBEE_DATA       "/zbdata"          // Zigbee last known values of devices
+#define TASM_FILE_ZIGBEE_JOURNAL    "/zbjournal"       // Zigbee changes of values since last zbdata
 #define TASM_FILE_AUTOEXEC          "/autoexec.bat"    // Commands executed after restart
 #define TASM_FILE_CONFIG            "/config.sys"      // Settings executed after restart
 
@@ -584,6 +585,14 @@ bool first_device_group_is_local = true;
 #define PROFILE_FUNCTION(DRIVER, INDEX, FUNCTION, START)
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_PROFILE_STATS
+#define PROFILE_STATS_START(START) uint32_t START = ESP.getCycleCount()
+#define PROFILE_STATS(TYPE, INDEX, FUNCTION, START) ProfileStatsAdd(TYPE, INDEX, FUNCTION, START)
+#else
+#define PROFILE_STATS_START(START)
+#define PROFILE_STATS(TYPE, INDEX, FUNCTION, START)
+#endif  // USE_PROFILE_STATS
+
 /*********************************************************************************************\
  * Macro for SetOption synonyms
  *
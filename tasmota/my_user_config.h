@@ -430,6 +430,8 @@ https://rya.nc/tasmota-fingerprint.html"
 //  #define INFLUXDB_TOKEN     ""                  // [IfxPassword, IfxToken] Influxdb v1 password or v2 token
 //  #define INFLUXDB_BUCKET    "db"                // [IfxDatabase, IfxBucket] Influxdb v1 database or v2 bucket
 //  #define INFLUXDB_RP        ""                  // [IfxRP] Influxdb retention policy
+//  #define INFLUXDB_TIMEOUT   2000                // Max number of ms to wait for connect and each reply read (blocks the loop on ESP8266)
+//  #define INFLUXDB_GZIP      0                   // Do not gzip batches on ESP32 with PSRAM
 
 // -- MQTT ----------------------------------------
 #define MQTT_LWT_OFFLINE       "Offline"         // MQTT LWT offline topic message
@@ -1272,6 +1274,8 @@ https://rya.nc/tasmota-fingerprint.html"
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_STATS                        // Enable driver function call statistics with command Profile and web page (+3k code, +3k mem)
+//  #define PROFILE_STATS_SLOTS        64          // Number of driver and function pairs recorded
 
 /*********************************************************************************************\
  * Optional firmware configurations
@@ -54,6 +54,7 @@
 #include <LList.h>
 #include <JsonParser.h>
 #include <JsonGenerator.h>
+#include <JsonStreamParser.h>
 #ifdef ESP8266
 #ifdef USE_ARDUINO_OTA
 #include <ArduinoOTA.h>                     // Arduino OTA
@@ -555,6 +555,7 @@ bool SettingsConfigRestore(void) {
   if (valid_settings) {
     SettingsDefaultSet2();
     memcpy((char*)Settings +16, settings_buffer +16, sizeof(TSettings) -16);
+    SettingsTextInvalidate();
     Settings->version = buffer_version;            // Restore version and auto upgrade after restart
   }
 
@@ -597,12 +598,35 @@ bool SettingsConfigRestore(void) {
  * Config Settings->text char array support
 \*********************************************************************************************/
 
-uint32_t GetSettingsTextLen(void) {
+uint16_t settings_text_offset[SET_MAX];      // Start of each text in Settings->text_pool
+bool settings_text_index_valid = false;      // Offset table needs a rebuild after Settings has been loaded or reset
+uint32_t settings_text_generation = 1;       // Incremented on any text change to invalidate values derived from texts
+
+void SettingsTextIndex(void) {
+  // Rebuild offset table with a single scan of Settings->text_pool
   char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
+  for (uint32_t index = 0; index < SET_MAX; index++) {
+    settings_text_offset[index] = position - Settings->text_pool;
     while (*position++ != '\0') { }
   }
-  return position - Settings->text_pool;
+  settings_text_index_valid = true;
+  settings_text_generation++;
+}
+
+void SettingsTextInvalidate(void) {
+  // Settings->text_pool has been overwritten as a whole
+  settings_text_index_valid = false;
+  settings_text_generation++;
+}
+
+uint32_t SettingsTextGeneration(void) {
+  return settings_text_generation;
+}
+
+uint32_t GetSettingsTextLen(void) {
+  if (!settings_text_index_valid) { SettingsTextIndex(); }
+  uint32_t last = settings_text_offset[SET_MAX -1];
+  return last + strlen(Settings->text_pool + last) +1;
 }
 
 bool settings_text_mutex = false;
@@ -627,22 +651,10 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
   uint32_t replace_len = strlen_P(replace_me);
   char replace[replace_len +1];
   memcpy_P(replace, replace_me, sizeof(replace));
-  uint32_t index_save = index;
 
-  uint32_t start_pos = 0;
-  uint32_t end_pos = 0;
-  char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
-    while (*position++ != '\0') { }
-    if (1 == index) {
-      start_pos = position - Settings->text_pool;
-    }
-    else if (0 == index) {
-      end_pos = position - Settings->text_pool -1;
-    }
-    index--;
-  }
-  uint32_t char_len = position - Settings->text_pool;
+  uint32_t char_len = GetSettingsTextLen();    // Also rebuilds offset table if needed
+  uint32_t start_pos = settings_text_offset[index];
+  uint32_t end_pos = start_pos + strlen(Settings->text_pool + start_pos);
 
   uint32_t current_len = end_pos - start_pos;
   int diff = replace_len - current_len;
@@ -664,17 +676,21 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
     if (diff != 0) {
       // Shift Settings->text up or down
       memmove_P(Settings->text_pool + start_pos + replace_len, Settings->text_pool + end_pos, char_len - end_pos);
+      for (uint32_t i = index +1; i < SET_MAX; i++) {
+        settings_text_offset[i] += diff;
+      }
     }
     // Replace text
     memmove_P(Settings->text_pool + start_pos, replace, replace_len);
     // Fill for future use
     memset(Settings->text_pool + char_len + diff, 0x00, settings_text_size - char_len - diff);
+    settings_text_generation++;
 
     settings_text_mutex = false;
   }
 
 #ifdef DEBUG_FUNC_SETTINGSUPDATETEXT
-  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d, Id %02d = \"%s\""), GetSettingsTextLen(), settings_text_size, settings_text_busy_count, index_save, replace);
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d, Id %02d = \"%s\""), GetSettingsTextLen(), settings_text_size, settings_text_busy_count, index, replace);
 #else
   AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d"), GetSettingsTextLen(), settings_text_size, settings_text_busy_count);
 #endif
@@ -693,9 +709,8 @@ char* SettingsText(uint32_t index) {
     position += settings_text_size -1;  // Setting not supported - internal error - return empty string
   } else {
     SettingsUpdateFinished();
-    for (;index > 0; index--) {
-      while (*position++ != '\0') { }
-    }
+    if (!settings_text_index_valid) { SettingsTextIndex(); }
+    position += settings_text_offset[index];
   }
   return position;
 }
@@ -855,6 +870,7 @@ void SettingsLoad(void) {
   }
   settings_crc32 = GetSettingsCrc32();
 #endif  // FIRMWARE_MINIMAL
+  SettingsTextInvalidate();
 
   RtcSettingsLoad(1);
 }
@@ -936,6 +952,7 @@ void SettingsDefault(void) {
 
 void SettingsDefaultSet1(void) {
   memset(Settings, 0x00, sizeof(TSettings));
+  SettingsTextInvalidate();
 
   Settings->cfg_holder = (uint16_t)CFG_HOLDER;
   Settings->cfg_size = sizeof(TSettings);
@@ -951,6 +968,7 @@ const uint8_t default_fingerprint2[] PROGMEM = { MQTT_FINGERPRINT2 };
 
 void SettingsDefaultSet2(void) {
   memset((char*)Settings +16, 0x00, sizeof(TSettings) -16);
+  SettingsTextInvalidate();
 
   // this little trick allows GCC to optimize the assignment by grouping values and doing only ORs
   SOBitfield   flag = { 0 };
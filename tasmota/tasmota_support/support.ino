@@ -1957,6 +1957,76 @@ uint32_t JsonParsePath(JsonParserObject *jobj, const char *spath, char delim, fl
 
 }
 
+/*********************************************************************************************\
+ * Parse json payload with path, streaming in constant memory
+ *
+ * Same path syntax and results as JsonParsePath(), but the json string is neither copied nor
+ * modified and there is no limit on its size
+\*********************************************************************************************/
+
+struct JSON_PATH_STREAM {
+  const char *spath;
+  char delim;
+  float *nres;
+  char *sres;
+  uint32_t slen;
+  uint32_t res;
+};
+
+// check if the path of the current value matches spath
+bool JsonParsePathMatch(JsonStreamParser &parser, const char *spath, char delim) {
+  const char *cp = spath;
+  uint32_t level = 0;
+  char selem[64];
+  while (1) {
+    uint32_t sp = 0;
+    while (*cp && (*cp != delim) && (sp < sizeof(selem) -1)) {
+      selem[sp++] = *cp++;
+    }
+    selem[sp] = 0;
+    if (*cp) { cp++; }
+    uint32_t aindex = 0;
+    char *ap = strchr(selem, '[');
+    if (ap) {
+      *ap = 0;
+      aindex = atoi(ap +1);
+    }
+    if ((level >= parser.depth()) || strcasecmp(parser.key(level), selem)) { return false; }
+    level++;
+    if (level == parser.depth()) {
+      return !*cp;                                   // direct value
+    }
+    if ((parser.index(level) >= 0) && (level +1 == parser.depth())) {
+      return (parser.index(level) == aindex);        // element of an array
+    }
+    if (!*cp) { return false; }
+  }
+}
+
+void JsonParsePathStreamCb(void *ctx, JsonStreamParser &parser, JsonStreamEvent event) {
+  JSON_PATH_STREAM *jps = (JSON_PATH_STREAM*)ctx;
+  if (JSON_STREAM_VALUE != event) { return; }
+  if (!JsonParsePathMatch(parser, jps->spath, jps->delim)) { return; }
+  if (parser.isNum() && (parser.index(parser.depth() -1) < 0)) {
+    if (jps->nres) { *jps->nres = parser.getFloat(); }
+    jps->res = 1;
+  } else {
+    jps->res = 2;                                    // array elements are returned as string like JsonParsePath()
+  }
+  if (jps->sres) {
+    strlcpy(jps->sres, parser.getStr(), jps->slen);
+  }
+  parser.stop();
+}
+
+uint32_t JsonParsePathStr(const char *json, const char *spath, char delim, float *nres, char *sres, uint32_t slen) {
+  JSON_PATH_STREAM jps = { spath, delim, nres, sres, slen, 0 };
+  if (sres && slen) { *sres = 0; }
+  JsonStreamParser parser(JsonParsePathStreamCb, &jps);
+  parser.feed(json);
+  return jps.res;
+}
+
 #endif // USE_SCRIPT
 
 /*********************************************************************************************\
@@ -2423,22 +2493,139 @@ void SyslogAsync(bool refresh) {
   }
 }
 
-bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
-  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
+/*********************************************************************************************\
+ * Log ring buffer
+ *
+ * Entries are stored in TasmotaGlobal.log_buffer as [loglevel][log data]['\1'] and never wrap:
+ * if an entry does not fit at the end of the buffer it is stored at the start, and the end of
+ * the buffer stays unused until the oldest entries are removed. The offset of each entry is kept
+ * by log index so adding, removing and finding an entry does not scan the buffer.
+ *
+ * On ESP32 writers take log_buffer_mutex. Readers take a consistent snapshot of the offsets by
+ * checking the sequence number, which is odd while a writer is changing them.
+\*********************************************************************************************/
 
+#ifndef LOG_INDEX_SIZE
+#define LOG_INDEX_SIZE 128                 // Max number of entries in log buffer, power of 2 up to 128
+#endif
+
+struct {
+  uint16_t offset[LOG_INDEX_SIZE];         // Offset in log_buffer of entry by log index
+  uint16_t head;                           // Offset of oldest entry
+  uint16_t tail;                           // Offset after newest entry
+  uint16_t end;                            // Offset after last entry at the end of the buffer when wrapped
+  uint8_t oldest;                          // Log index of oldest entry
+  uint8_t count;                           // Number of entries
+  bool wrapped;                            // Newest entries are at the start of the buffer
 #ifdef ESP32
-  // this takes the mutex, and will be release when the class is destroyed -
-  // i.e. when the functon leaves  You CAN call mutex.give() to leave early.
-  TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
+  volatile uint32_t seq;                   // Changed before and after each update, odd while updating
 #endif  // ESP32
+} TasLog;
+
+uint32_t LogNextIndex(uint32_t index) {
+  index++;
+  if (index > 255) { index = 1; }          // Skip 0 as it is not allowed
+  return index;
+}
+
+// Bytes in use from the oldest entry up to offset
+uint32_t LogUsed(uint32_t offset) {
+  if (!TasLog.count) { return 0; }
+  if (offset >= TasLog.head) { return offset - TasLog.head; }
+  return (TasLog.end - TasLog.head) + offset;
+}
+
+// Find entry by log index, returns position from the oldest entry or -1 if not in log buffer
+int32_t LogFind(uint32_t index, uint32_t* offset_p, uint32_t* size_p) {
+  if (!TasLog.count || !index) { return -1; }
+  uint32_t pos = (index >= TasLog.oldest) ? index - TasLog.oldest : index + 255 - TasLog.oldest;
+  if (pos >= TasLog.count) { return -1; }
+  uint32_t offset = TasLog.offset[index & (LOG_INDEX_SIZE -1)];
+  uint32_t next = (pos == TasLog.count -1U) ? TasLog.tail : TasLog.offset[LogNextIndex(index) & (LOG_INDEX_SIZE -1)];
+  if (next <= offset) { next = TasLog.end; } // Next entry wrapped to start of buffer
+  *offset_p = offset;
+  *size_p = next - offset;
+  return pos;
+}
+
+void LogRemoveOldest(void) {
+  uint32_t offset;
+  uint32_t size;
+  if (LogFind(TasLog.oldest, &offset, &size) < 0) { return; }
+  TasLog.count--;
+  TasLog.oldest = LogNextIndex(TasLog.oldest);
+  if (!TasLog.count) {
+    TasLog.head = 0;
+    TasLog.tail = 0;
+    TasLog.wrapped = false;
+    return;
+  }
+  uint32_t head = TasLog.offset[TasLog.oldest & (LOG_INDEX_SIZE -1)];
+  if (head < TasLog.head) { TasLog.wrapped = false; }  // Oldest entry is now at start of buffer
+  TasLog.head = head;
+}
+
+// Reserve size bytes for a new entry with log index, removing oldest entries if needed
+char* LogReserve(uint32_t index, uint32_t size) {
+  while (TasLog.count >= LOG_INDEX_SIZE -1) { LogRemoveOldest(); }
+  while (true) {
+    if (!TasLog.count) {
+      TasLog.oldest = index;
+    }
+    if (TasLog.wrapped) {
+      if (TasLog.tail + size <= TasLog.head) { break; }
+    } else {
+      if (TasLog.tail + size <= LOG_BUFFER_SIZE) { break; }
+      if (TasLog.count && (size <= TasLog.head)) {
+        TasLog.end = TasLog.tail;          // Continue at start of buffer
+        TasLog.tail = 0;
+        TasLog.wrapped = true;
+        break;
+      }
+    }
+    LogRemoveOldest();
+  }
+  uint32_t offset = TasLog.tail;
+  TasLog.offset[index & (LOG_INDEX_SIZE -1)] = offset;
+  TasLog.tail += size;
+  TasLog.count++;
+  return TasmotaGlobal.log_buffer + offset;
+}
+
+bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
+  if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
 
   // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (LogUsed(TasLog.tail) < LOG_BUFFER_SIZE / 2) { return false; }
 
   char* line;
   size_t len;
   if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
-  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+  return (LogUsed(line -1 - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+}
+
+// Find next entry from log index with a loglevel up to req_loglevel, returns false if none
+bool LogFindNext(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
+  uint32_t index = *index_p;
+  uint32_t offset;
+  uint32_t size;
+  if (!index || (LogFind(index, &offset, &size) < 0)) {
+    index = TasLog.oldest;                 // Dump all or requested entries are gone
+  }
+  while (TasLog.count && (index != TasmotaGlobal.log_buffer_pointer)) {
+    if (LogFind(index, &offset, &size) < 0) { break; }
+    index = LogNextIndex(index);
+    uint32_t loglevel = TasmotaGlobal.log_buffer[offset] - '0';
+    if ((loglevel <= req_loglevel) &&
+        (TasmotaGlobal.masterlog_level <= req_loglevel)) {
+      *index_p = index;
+      *entry_pp = TasmotaGlobal.log_buffer + offset +1;  // Skip loglevel
+      *len_p = size -1;                    // Log data including terminating '\1'
+      return true;
+    }
+  }
+  *index_p = TasmotaGlobal.log_buffer_pointer;
+  return false;
 }
 
 bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
@@ -2449,45 +2636,25 @@ bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* l
   if (!req_loglevel || (index == TasmotaGlobal.log_buffer_pointer)) { return false; }
 
 #ifdef ESP32
-  // this takes the mutex, and will be release when the class is destroyed -
-  // i.e. when the functon leaves  You CAN call mutex.give() to leave early.
-  TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
-#endif  // ESP32
-
-  if (!index) {                            // Dump all
-    index = TasmotaGlobal.log_buffer[0];
-  }
-
-  do {
-    size_t len = 0;
-    uint32_t loglevel = 0;
-    char* entry_p = TasmotaGlobal.log_buffer;
-    do {
-      uint32_t cur_idx = *entry_p;
-      entry_p++;
-      size_t tmp = strchrspn(entry_p, '\1');
-      tmp++;                               // Skip terminating '\1'
-      if (cur_idx == index) {              // Found the requested entry
-        loglevel = *entry_p - '0';
-        entry_p++;                         // Skip loglevel
-        len = tmp -1;
-        break;
+  // Retry a few times if a writer changed the log buffer meanwhile, then wait for the mutex
+  for (uint32_t retry = 0; retry < 3; retry++) {
+    uint32_t seq = TasLog.seq;
+    __sync_synchronize();
+    if (!(seq & 1)) {
+      uint32_t found_index = index;
+      bool found = LogFindNext(req_loglevel, &found_index, entry_pp, len_p);
+      __sync_synchronize();
+      if (seq == TasLog.seq) {
+        *index_p = found_index;
+        return found;
       }
-      entry_p += tmp;
-    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
-    index++;
-    if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
-    *index_p = index;
-    if ((len > 0) &&
-        (loglevel <= req_loglevel) &&
-        (TasmotaGlobal.masterlog_level <= req_loglevel)) {
-      *entry_pp = entry_p;
-      *len_p = len;
-      return true;
     }
     delay(0);
-  } while (index != TasmotaGlobal.log_buffer_pointer);
-  return false;
+  }
+  TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
+#endif  // ESP32
+
+  return LogFindNext(req_loglevel, index_p, entry_pp, len_p);
 }
 
 void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_payload = nullptr, const char* log_data_retained = nullptr) {
@@ -2538,8 +2705,8 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
   if ((loglevel <= highest_loglevel) &&    // Log only when needed
       (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
-    // Delimited, zero-terminated buffer of log lines.
-    // Each entry has this format: [index][loglevel][log data]['\1']
+    // Ring buffer of log lines, see LogReserve().
+    // Each entry has this format: [loglevel][log data]['\1']
 
     // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
     uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
@@ -2554,23 +2721,32 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
     TasmotaGlobal.log_buffer_pointer &= 0xFF;
     if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
-    }
-    while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
-    {
-      char* it = TasmotaGlobal.log_buffer;
-      it++;                                // Skip log_buffer_pointer
-      it += strchrspn(it, '\1');           // Skip log line
-      it++;                                // Skip delimiting "\1"
-      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
-    }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
-    TasmotaGlobal.log_buffer_pointer &= 0xFF;
-    if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed
     }
+    uint32_t mxtime_len = strlen(mxtime);
+    uint32_t log_data_len1 = strlen(log_data);
+    uint32_t log_data_len2 = strlen(log_data_payload);
+    uint32_t log_data_len3 = strlen(log_data_retained);
+#ifdef ESP32
+    TasLog.seq++;                          // Odd, readers retry
+    __sync_synchronize();
+#endif  // ESP32
+    char* entry = LogReserve(TasmotaGlobal.log_buffer_pointer, mxtime_len + log_data_len1 + log_data_len2 + log_data_len3 + 2);  // 2 = loglevel + '\1'
+    *entry++ = '0' + loglevel;
+    memcpy(entry, mxtime, mxtime_len);
+    entry += mxtime_len;
+    memcpy(entry, log_data, log_data_len1);
+    entry += log_data_len1;
+    memcpy(entry, log_data_payload, log_data_len2);
+    entry += log_data_len2;
+    memcpy(entry, log_data_retained, log_data_len3);
+    entry += log_data_len3;
+    *entry = '\1';
+    TasmotaGlobal.log_buffer_pointer = LogNextIndex(TasmotaGlobal.log_buffer_pointer);
+#ifdef ESP32
+    __sync_synchronize();
+    TasLog.seq++;                          // Even, update done
+#endif  // ESP32
   }
 }
 
@@ -50,31 +50,55 @@
  * Profiling services
 \*********************************************************************************************/
 
+#if defined(USE_PROFILING) || defined(USE_PROFILE_STATS)
+
+// Below needs to be inline with enum XsnsFunctions
+const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|SETUP_RING1|SETUP_RING2|PRE_INIT|INIT|ACTIVE|"
+                                      "LOOP|SLEEP_LOOP|EVERY_50_MSECOND|EVERY_100_MSECOND|EVERY_200_MSECOND|EVERY_250_MSECOND|EVERY_SECOND|"
+                                      "RESET_SETTINGS|RESTORE_SETTINGS|SAVE_SETTINGS|SAVE_AT_MIDNIGHT|SAVE_BEFORE_RESTART|INTERRUPT_STOP|INTERRUPT_START|"
+                                      "AFTER_TELEPERIOD|JSON_APPEND|WEB_SENSOR|WEB_COL_SENSOR|"
+                                      "MQTT_SUBSCRIBE|MQTT_INIT|"
+                                      "SET_POWER|SHOW_SENSOR|ANY_KEY|LED_LINK|"
+                                      "ENERGY_EVERY_SECOND|ENERGY_RESET|"
+                                      "TELEPERIOD_RULES_PROCESS|FREE_MEM|"
+                                      "WEB_ADD_BUTTON|WEB_ADD_CONSOLE_BUTTON|WEB_ADD_MANAGEMENT_BUTTON|WEB_ADD_MAIN_BUTTON|"
+                                      "WEB_GET_ARG|WEB_ADD_HANDLER|SET_SCHEME|HOTPLUG_SCAN|TIME_SYNCED|"
+                                      "DEVICE_GROUP_ITEM|"
+                                      "NETWORK_UP|NETWORK_DOWN";
+// Functions after FUNC_return_result
+const char kXSnsFunctionsResult[] PROGMEM = "PIN_STATE|MODULE_INIT|ADD_BUTTON|ADD_SWITCH|BUTTON_PRESSED|BUTTON_MULTI_PRESSED|"
+                                            "SET_DEVICE_POWER|"
+                                            "MQTT_DATA|SERIAL|"
+                                            "COMMAND|COMMAND_SENSOR|COMMAND_DRIVER|"
+                                            "RULES_PROCESS|"
+                                            "SET_CHANNELS";
+
+char* GetFunctionName(char* name, size_t size, uint32_t function) {
+  if (function > FUNC_return_result) {
+    GetTextIndexed(name, size, function - FUNC_return_result -1, kXSnsFunctionsResult);
+  } else {
+    GetTextIndexed(name, size, function, kXSnsFunctions);
+  }
+  if (!name[0]) {
+    snprintf_P(name, size, PSTR("%d"), function);  // Unknown or display function
+  }
+  return name;
+}
+
+#endif  // USE_PROFILING or USE_PROFILE_STATS
+
 #ifdef USE_PROFILING
 
 #ifndef PROFILE_THRESHOLD
 #define PROFILE_THRESHOLD            70       // Minimum duration in milliseconds to start logging
 #endif
 
-// Below needs to be inline with enum XsnsFunctions
-const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|PIN_STATE|MODULE_INIT|PRE_INIT|INIT|"
-                                      "LOOP|EVERY_50_MSECOND|EVERY_100_MSECOND|EVERY_200_MSECOND|EVERY_250_MSECOND|EVERY_SECOND|"
-                                      "SAVE_SETTINGS|SAVE_AT_MIDNIGHT|SAVE_BEFORE_RESTART|"
-                                      "AFTER_TELEPERIOD|JSON_APPEND|WEB_SENSOR|COMMAND|COMMAND_SENSOR|COMMAND_DRIVER|"
-                                      "MQTT_SUBSCRIBE|MQTT_INIT|MQTT_DATA|"
-                                      "SET_POWER|SET_DEVICE_POWER|SHOW_SENSOR|ANY_KEY|"
-                                      "ENERGY_EVERY_SECOND|ENERGY_RESET|"
-                                      "RULES_PROCESS|TELEPERIOD_RULES_PROCESS|SERIAL|FREE_MEM|BUTTON_PRESSED|"
-                                      "WEB_ADD_BUTTON|WEB_ADD_CONSOLE_BUTTON|WEB_ADD_MANAGEMENT_BUTTON|WEB_ADD_MAIN_BUTTON|"
-                                      "WEB_ADD_HANDLER|SET_CHANNELS|SET_SCHEME|HOTPLUG_SCAN|"
-                                      "DEVICE_GROUP_ITEM";
-
 #ifdef USE_PROFILE_DRIVER
 void AddLogDriver(const char *driver, uint8_t function, uint32_t start) {
   uint32_t profile_millis = millis() - start;
   if (profile_millis > PROFILE_THRESHOLD) {
-    char stemp1[20];
-    AddLog(LOG_LEVEL_DEBUG, PSTR("PRF: *** x%s FUNC_%s (%d ms)"), driver, GetTextIndexed(stemp1, sizeof(stemp1), function, kXSnsFunctions), profile_millis);
+    char stemp1[32];
+    AddLog(LOG_LEVEL_DEBUG, PSTR("PRF: *** x%s FUNC_%s (%d ms)"), driver, GetFunctionName(stemp1, sizeof(stemp1), function), profile_millis);
   }
 }
 #endif  // USE_PROFILE_DRIVER
@@ -83,10 +107,206 @@ void AddLogDriver(const char *driver, uint8_t function, uint32_t start) {
 void AddLogFunction(const char *driver, uint8_t index, uint8_t function, uint32_t start) {
   uint32_t profile_millis = millis() - start;
   if (profile_millis > PROFILE_THRESHOLD) {
-    char stemp1[20];
-    AddLog(LOG_LEVEL_DEBUG, PSTR("PRF: *** x%s_%02d FUNC_%s (%d ms)"), driver, index, GetTextIndexed(stemp1, sizeof(stemp1), function, kXSnsFunctions), profile_millis);
+    char stemp1[32];
+    AddLog(LOG_LEVEL_DEBUG, PSTR("PRF: *** x%s_%02d FUNC_%s (%d ms)"), driver, index, GetFunctionName(stemp1, sizeof(stemp1), function), profile_millis);
   }
 }
 #endif  // USE_PROFILE_DRIVER
 
 #endif  // USE_PROFILING
+
+/*********************************************************************************************\
+ * Driver function call statistics
+ *
+ * Every call from XdrvCall, XsnsCall, XnrgCall, XlgtCall and XdspCall is timed with the
+ * cpu cycle counter and accounted to its (driver, function) pair in a fixed hash table:
+ * number of calls, total and maximum duration and a log2 histogram in microseconds.
+ * Nested calls are inclusive, i.e. time spent in XnrgCall is also accounted to xdrv_03.
+ *
+ * Profile        - Show statistics since last reset and reset them
+ * /pr            - Web page with current statistics
+\*********************************************************************************************/
+
+#ifdef USE_PROFILE_STATS
+
+#ifndef PROFILE_STATS_SLOTS
+#ifdef ESP8266
+#define PROFILE_STATS_SLOTS          48       // Number of (driver, function) pairs recorded
+#else
+#define PROFILE_STATS_SLOTS          128      // Number of (driver, function) pairs recorded
+#endif
+#endif
+#define PROFILE_STATS_BUCKETS        16       // Bucket n counts calls from 2^n up to 2^(n+1) us, bucket 0 below 2 us, last bucket 32 ms and up
+
+enum ProfileStatsDrivers { PRF_NONE, PRF_DRV, PRF_SNS, PRF_NRG, PRF_LGT, PRF_DSP };
+const char kProfileStatsDrivers[] PROGMEM = "|drv|sns|nrg|lgt|dsp";
+
+struct PROFILESTATS {
+  uint64_t total_us;
+  uint32_t count;
+  uint32_t max_us;
+  uint32_t key;                               // (type << 16) | (index << 8) | function, 0 if free
+  uint16_t histogram[PROFILE_STATS_BUCKETS];  // Saturates at 65535
+};
+
+struct {
+  PROFILESTATS slot[PROFILE_STATS_SLOTS];
+  uint32_t since;                             // millis() at last reset
+  uint32_t missed;                            // Calls not recorded as table is full
+  bool init;
+} ProfileStats;
+
+void ProfileStatsReset(void) {
+  memset(ProfileStats.slot, 0, sizeof(ProfileStats.slot));
+  ProfileStats.since = millis();
+  ProfileStats.missed = 0;
+  ProfileStats.init = true;
+}
+
+void ProfileStatsAdd(uint32_t type, uint32_t index, uint32_t function, uint32_t start) {
+  uint32_t cycles = ESP.getCycleCount() - start;
+  uint32_t cpu_mhz = ESP.getCpuFreqMHz();        // Not cached as CpuFrequency, Berry or scripts may change it
+  if (!ProfileStats.init) { ProfileStatsReset(); }
+
+  uint32_t key = (type << 16) | ((index & 0xFF) << 8) | (function & 0xFF);
+  uint32_t i = ((key * 2654435761U) >> 16) % PROFILE_STATS_SLOTS;  // Knuth multiplicative hash
+  for (uint32_t probe = 0; probe < PROFILE_STATS_SLOTS; probe++) {
+    PROFILESTATS &stat = ProfileStats.slot[i];
+    if (!stat.key) { stat.key = key; }
+    if (stat.key == key) {
+      uint32_t us = cycles / cpu_mhz;
+      stat.count++;
+      stat.total_us += us;
+      if (us > stat.max_us) { stat.max_us = us; }
+      uint32_t bucket = (us > 1) ? 31 - __builtin_clz(us) : 0;
+      if (bucket >= PROFILE_STATS_BUCKETS) { bucket = PROFILE_STATS_BUCKETS -1; }
+      if (stat.histogram[bucket] < 0xFFFF) { stat.histogram[bucket]++; }
+      return;
+    }
+    i++;
+    if (PROFILE_STATS_SLOTS == i) { i = 0; }
+  }
+  ProfileStats.missed++;
+}
+
+int32_t ProfileStatsNext(uint32_t last_key) {
+  // Return slot with lowest key above last_key or -1 if none to list in driver order
+  int32_t next = -1;
+  for (uint32_t i = 0; i < PROFILE_STATS_SLOTS; i++) {
+    uint32_t key = ProfileStats.slot[i].key;
+    if ((key > last_key) && ((next < 0) || (key < ProfileStats.slot[next].key))) {
+      next = i;
+    }
+  }
+  return next;
+}
+
+char* ProfileStatsDriverName(char* name, size_t size, uint32_t key) {
+  // Type and driver number as in kXdrvList or kXsnsList, or position for others
+  uint32_t type = key >> 16;
+  uint32_t index = (key >> 8) & 0xFF;
+  if (PRF_DRV == type) {
+#ifdef XFUNC_PTR_IN_ROM
+    index = pgm_read_byte(kXdrvList + index);
+#else
+    index = kXdrvList[index];
+#endif
+  }
+  else if (PRF_SNS == type) {
+#ifdef XFUNC_PTR_IN_ROM
+    index = pgm_read_byte(kXsnsList + index);
+#else
+    index = kXsnsList[index];
+#endif
+  }
+  char stemp[4];
+  snprintf_P(name, size, PSTR("%s%02d"), GetTextIndexed(stemp, sizeof(stemp), type, kProfileStatsDrivers), index);
+  return name;
+}
+
+char* ProfileStatsFunctionName(char* name, size_t size, uint32_t key) {
+  // Display functions are a separate enum XdspFunctions, which depends on build options
+  if (PRF_DSP == (key >> 16)) {
+    snprintf_P(name, size, PSTR("DISPLAY_%d"), key & 0xFF);
+    return name;
+  }
+  return GetFunctionName(name, size, key & 0xFF);
+}
+
+void CmndProfile(void) {
+  if (!ProfileStats.init) { ProfileStatsReset(); }
+
+  Response_P(PSTR("{\"" D_CMND_PROFILE "\":{\"Period\":%d,\"Missed\":%d"),
+    (millis() - ProfileStats.since) / 1000, ProfileStats.missed);
+  uint32_t last_key = 0;
+  uint32_t last_driver = 0;
+  int32_t i;
+  while ((i = ProfileStatsNext(last_key)) >= 0) {
+    PROFILESTATS &stat = ProfileStats.slot[i];
+    uint32_t driver = stat.key >> 8;
+    if (driver != last_driver) {
+      char name[12];
+      ResponseAppend_P(PSTR("%s\"%s\":{"), (last_driver) ? "}," : ",", ProfileStatsDriverName(name, sizeof(name), stat.key));
+    } else {
+      ResponseAppend_P(PSTR(","));
+    }
+    char function[32];
+    ResponseAppend_P(PSTR("\"%s\":{\"Count\":%u,\"TotalMs\":%u,\"MaxUs\":%u,\"Hist\":["),
+      ProfileStatsFunctionName(function, sizeof(function), stat.key), stat.count, (uint32_t)(stat.total_us / 1000), stat.max_us);
+    uint32_t buckets = PROFILE_STATS_BUCKETS;
+    while ((buckets > 1) && !stat.histogram[buckets -1]) { buckets--; }  // Skip empty high buckets
+    for (uint32_t b = 0; b < buckets; b++) {
+      ResponseAppend_P(PSTR("%s%u"), (b) ? "," : "", stat.histogram[b]);
+    }
+    ResponseAppend_P(PSTR("]}"));
+    last_key = stat.key;
+    last_driver = driver;
+  }
+  ResponseAppend_P(PSTR("%s}}"), (last_driver) ? "}" : "");
+
+  ProfileStatsReset();
+}
+
+#ifdef USE_WEBSERVER
+const char HTTP_BTN_MENU_PROFILE[] PROGMEM =
+  "<p><form action='pr' method='get'><button>" D_CMND_PROFILE "</button></form></p>";
+
+void HandleProfileStats(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP D_CMND_PROFILE));
+
+  if (!ProfileStats.init || Webserver->hasArg(F("rst"))) { ProfileStatsReset(); }
+
+  WSContentStart_P(PSTR(D_CMND_PROFILE));
+  WSContentSendStyle();
+  WSContentSend_P(PSTR("<div style='text-align:right;font-size:11px'>%d s, %d missed</div>"),
+    (millis() - ProfileStats.since) / 1000, ProfileStats.missed);
+  WSContentSend_P(PSTR("<table style='width:100%%;font-size:11px'><tr><th>Driver</th><th>Function</th><th>Count</th><th>Avg us</th><th>Max us</th><th>Total ms</th><th>Histogram</th></tr>"));
+  uint32_t last_key = 0;
+  int32_t i;
+  while ((i = ProfileStatsNext(last_key)) >= 0) {
+    PROFILESTATS &stat = ProfileStats.slot[i];
+    char name[12];
+    char function[32];
+    char histogram[PROFILE_STATS_BUCKETS * 6 +1];
+    histogram[0] = '\0';
+    uint32_t buckets = PROFILE_STATS_BUCKETS;
+    while ((buckets > 1) && !stat.histogram[buckets -1]) { buckets--; }
+    for (uint32_t b = 0; b < buckets; b++) {
+      size_t len = strlen(histogram);
+      snprintf_P(histogram + len, sizeof(histogram) - len, PSTR("%s%u"), (b) ? " " : "", stat.histogram[b]);
+    }
+    WSContentSend_P(PSTR("<tr><td>%s</td><td>%s</td><td style='text-align:right'>%u</td><td style='text-align:right'>%u</td><td style='text-align:right'>%u</td><td style='text-align:right'>%u</td><td>%s</td></tr>"),
+      ProfileStatsDriverName(name, sizeof(name), stat.key), ProfileStatsFunctionName(function, sizeof(function), stat.key),
+      stat.count, (stat.count) ? (uint32_t)(stat.total_us / stat.count) : 0, stat.max_us, (uint32_t)(stat.total_us / 1000), histogram);
+    last_key = stat.key;
+  }
+  WSContentSend_P(PSTR("</table>"));
+  WSContentSend_P(PSTR("<p><form action='pr' method='get'><button name='rst' class='button bred'>" D_CMND_RESET "</button></form></p>"));
+  WSContentSpaceButton(BUTTON_MANAGEMENT);
+  WSContentStop();
+}
+#endif  // USE_WEBSERVER
+
+#endif  // USE_PROFILE_STATS
@@ -88,6 +88,11 @@ String ResolveToken(const char* input) {
   return resolved;
 }
 
+struct TOPIC_CACHE {
+  String fulltopic[3];                       // Resolved full topic of TasmotaGlobal.mqtt_topic for Cmnd, Stat and Tele
+  uint32_t generation[3] = { 0 };            // SettingsTextGeneration() when resolved, 0 = not cached
+} TopicCache;
+
 char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* subtopic)
 {
   /* prefix 0 = Cmnd
@@ -104,6 +109,12 @@ char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* s
   String fulltopic;
 
   snprintf_P(romram, sizeof(romram), subtopic);
+  // Device topics are resolved once and cached until any Settings text changes
+  bool cacheable = !TasmotaGlobal.fallback_topic_flag && (prefix < 3) && (topic == TasmotaGlobal.mqtt_topic) && TasmotaGlobal.hostname[0];
+  if (cacheable && (TopicCache.generation[prefix] == SettingsTextGeneration())) {
+    snprintf_P(stopic, TOPSZ, PSTR("%s%s"), TopicCache.fulltopic[prefix].c_str(), romram);
+    return stopic;
+  }
   if (TasmotaGlobal.fallback_topic_flag || (prefix > 3)) {
     bool fallback = (prefix < 8);
     prefix &= 3;
@@ -138,6 +149,10 @@ char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* s
   if (!fulltopic.endsWith("/")) {
     fulltopic += "/";
   }
+  if (cacheable) {
+    TopicCache.fulltopic[prefix] = fulltopic;
+    TopicCache.generation[prefix] = SettingsTextGeneration();
+  }
   snprintf_P(stopic, TOPSZ, PSTR("%s%s"), fulltopic.c_str(), romram);
   return stopic;
 }
@@ -1069,6 +1084,9 @@ bool MqttShowSensor(bool call_show_sensor) {
 void MqttPublishSensor(void) {
   ResponseClear();
   if (MqttShowSensor(true)) {
+#ifdef USE_PROMETHEUS
+    PrometheusProcess();
+#endif
     MqttPublishTeleSensor();
   }
 }
@@ -1076,6 +1094,9 @@ void MqttPublishSensor(void) {
 void MqttPublishTeleperiodSensor(void) {
   ResponseClear();
   if (MqttShowSensor(true)) {
+#ifdef USE_PROMETHEUS
+    PrometheusProcess();
+#endif
     MqttPublishPrefixTopic_P(TELE, PSTR(D_RSLT_SENSOR), Settings->flag.mqtt_sensor_retain);  // CMND_SENSORRETAIN
     XdrvRulesProcess(1);
   }
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XDRV_01                                   1
+#define XDRV_01_FUNC                              (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 // Enable below demo feature only if defines USE_UNISHOX_COMPRESSION and USE_SCRIPT_WEB_DISPLAY are disabled
 //#define USE_WEB_SSE
@@ -50,6 +51,7 @@
                                                          //   a window telling that the WiFi Configuration was Ok and that the window can be closed.
 
 const uint16_t CHUNKED_BUFFER_SIZE = 500;                // Chunk buffer size (needs to be well below stack space (4k for ESP8266, 8k for ESP32) but large enough to cache some small messages)
+const uint16_t WEB_CHUNK_BUFFER_SIZE = 2 * CHUNKED_BUFFER_SIZE;  // Preallocated output buffer, content is formatted directly into it
 
 const uint16_t HTTP_REFRESH_TIME = 2345;                 // milliseconds
 const uint16_t HTTP_RESTART_RECONNECT_TIME = 10000;      // milliseconds - Allow time for restart and wifi reconnect
@@ -456,8 +458,24 @@ enum WebCmndStatus { WEBCMND_DONE, WEBCMND_WRONG_PARAMETERS, WEBCMND_CONNECT_FAI
 DNSServer *DnsServer;
 ESP8266WebServer *Webserver;
 
+typedef struct WebPageStats_t {
+  uint32_t time;                                    // Milliseconds to build and send the page
+  uint32_t bytes;                                   // Bytes of content
+  uint32_t heap_used;                               // Peak heap used while building the page
+  uint16_t chunks;                                  // Chunks sent
+  char uri[24];
+} WebPageStats_t;
+
 struct WEB {
-  String chunk_buffer = "";                         // Could be max 2 * CHUNKED_BUFFER_SIZE
+  char *chunk_buffer = nullptr;                     // Output buffer of WEB_CHUNK_BUFFER_SIZE, allocated once
+  uint16_t chunk_len = 0;                           // Bytes pending in chunk_buffer
+  uint32_t page_start = 0;                          // Statistics of the page being sent
+  uint32_t page_heap = 0;
+  uint32_t page_heap_min = 0;
+  WebPageStats_t page;
+  WebPageStats_t last_page = {};                    // Statistics of the last page, reported by command WebStats
+  uint32_t max_time = 0;
+  uint32_t max_heap_used = 0;
   uint32_t upload_size = 0;
   uint16_t upload_error = 0;
   uint8_t state = HTTP_OFF;
@@ -582,6 +600,9 @@ const WebServerDispatch_t WebServerDispatch[] PROGMEM = {
 #ifndef FIRMWARE_MINIMAL_ONLY
   { "in", HTTP_ANY, HandleInformation },
 #endif  // Not FIRMWARE_MINIMAL_ONLY
+#ifdef USE_PROFILE_STATS
+  { "pr", HTTP_GET, HandleProfileStats },
+#endif  // USE_PROFILE_STATS
 };
 
 void WebServer_on(const char * prefix, void (*func)(void), uint8_t method = HTTP_ANY) {
@@ -602,7 +623,14 @@ void StartWebserver(int type)
     if (!Webserver) {
       Webserver = new ESP8266WebServer((HTTP_MANAGER == type || HTTP_MANAGER_RESET_ONLY == type) ? 80 : WEB_PORT);
 
-      const char* headerkeys[] = { "Referer", "Host" };
+      const char* headerkeys[] = { "Referer", "Host"
+#ifdef USE_PROMETHEUS
+                                   , "Accept"                   // Used by /metrics
+#endif
+#if defined(USE_PROMETHEUS) || (defined(USE_EMULATION) && defined(USE_EMULATION_HUE))
+                                   , "If-None-Match"            // Used by /metrics and Hue /lights
+#endif
+                                 };
       size_t headerkeyssize = sizeof(headerkeys) / sizeof(char*);
       Webserver->collectHeaders(headerkeys, headerkeyssize);
 
@@ -774,68 +802,84 @@ void WSSend(int code, int ctype, const String& content)
 * HTTP Content Chunk handler
 **********************************************************************************************/
 
+void _WSContentInit(void) {                       // Reset chunk buffer and page statistics, call after sending headers
+  if (nullptr == Web.chunk_buffer) {
+    Web.chunk_buffer = (char*)malloc(WEB_CHUNK_BUFFER_SIZE);  // Kept for the lifetime of the webserver
+  }
+  Web.chunk_len = 0;
+  Web.page_start = millis();
+  Web.page_heap = ESP_getFreeHeap();
+  Web.page_heap_min = Web.page_heap;
+  Web.page.bytes = 0;
+  Web.page.chunks = 0;
+  strlcpy(Web.page.uri, Webserver->uri().c_str(), sizeof(Web.page.uri));
+}
+
 void WSContentBegin(int code, int ctype) {
   Webserver->client().flush();
   WSHeaderSend();
   Webserver->setContentLength(CONTENT_LENGTH_UNKNOWN);
   WSSend(code, ctype, "");                         // Signal start of chunked content
-  Web.chunk_buffer = "";
+  _WSContentInit();
 }
 
-void _WSContentSend(const char* content, size_t size) {  // Lowest level sendContent for all core versions
-  Webserver->sendContent(content, size);
+void _WSContentStats(size_t size) {
+  Web.page.bytes += size;
+  Web.page.chunks++;
+  uint32_t heap = ESP_getFreeHeap();
+  if (heap < Web.page_heap_min) { Web.page_heap_min = heap; }
 
   SHOW_FREE_MEM(PSTR("WSContentSend"));
   DEBUG_CORE_LOG(PSTR("WEB: Chunk size %d"), size);
 }
 
+void _WSContentSend(const char* content, size_t size) {  // Lowest level sendContent for all core versions
+  Webserver->sendContent(content, size);
+  _WSContentStats(size);
+}
+
 void _WSContentSend(const String& content) {       // Low level sendContent for all core versions
   _WSContentSend(content.c_str(), content.length());
 }
 
 void WSContentFlush(void) {
-  if (Web.chunk_buffer.length() > 0) {
-    _WSContentSend(Web.chunk_buffer);              // Flush chunk buffer
-    Web.chunk_buffer = "";
+  if (Web.chunk_len > 0) {
+    _WSContentSend(Web.chunk_buffer, Web.chunk_len);  // Flush chunk buffer
+    Web.chunk_len = 0;
   }
 }
 
-void _WSContentSendBufferChunk(const char* content) {
-  int len = strlen(content);
-  if (len < CHUNKED_BUFFER_SIZE) {                 // Append chunk buffer with small content
-    Web.chunk_buffer += content;
-    len = Web.chunk_buffer.length();
+void _WSContentAppend(const char* content, size_t size, bool progmem) {
+  if (0 == size) { return; }                       // Empty chunk would end the content
+  if (Web.chunk_len + size > WEB_CHUNK_BUFFER_SIZE) {
+    WSContentFlush();                              // Send chunk buffer before content
   }
-  if (len >= CHUNKED_BUFFER_SIZE) {                // Either content or chunk buffer is oversize
-    WSContentFlush();                              // Send chunk buffer before possible content oversize
-  }
-  if (strlen(content) >= CHUNKED_BUFFER_SIZE) {    // Content is oversize
-    _WSContentSend(content);                       // Send content
-  }
-}
-
-void WSContentSend(const char* content, size_t size) {
-  // To speed up transmission use chunked buffer if possible
-  if (size < CHUNKED_BUFFER_SIZE) {
-    // Terminate non-terminated content
-    char buffer[size +1];
-    strlcpy(buffer, content, sizeof(buffer));      // Terminate with '\0'
-    _WSContentSendBufferChunk(buffer);
+  if ((size >= WEB_CHUNK_BUFFER_SIZE) || (nullptr == Web.chunk_buffer)) {
+    if (progmem) {                                 // Content is oversize, send it without copy
+      Webserver->sendContent_P(content, size);
+      _WSContentStats(size);
+    } else {
+      _WSContentSend(content, size);
+    }
   } else {
-    WSContentFlush();                              // Flush chunk buffer
-    _WSContentSend(content, size);
+    if (progmem) {
+      memcpy_P(Web.chunk_buffer + Web.chunk_len, content, size);
+    } else {
+      memcpy(Web.chunk_buffer + Web.chunk_len, content, size);
+    }
+    Web.chunk_len += size;
   }
 }
 
-void _WSContentSendBuffer(bool decimal, const char * formatP, va_list arg) {
-  char* content = ext_vsnprintf_malloc_P(formatP, arg);
-  if (content == nullptr) { return; }              // Avoid crash
-
-  int len = strlen(content);
-  if (0 == len) { return; }                        // No content
+void _WSContentSendBufferChunk(const char* content) {
+  _WSContentAppend(content, strlen(content), false);
+}
 
-  WSContentSeparator(2);                           // Print separator on next WSContentSeparator(1)
+void WSContentSend(const char* content, size_t size) {
+  _WSContentAppend(content, size, false);
+}
 
+void _WSContentDecimal(bool decimal, char* content, uint32_t len) {
   if (decimal && (D_DECIMAL_SEPARATOR[0] != '.')) {
     for (uint32_t i = 0; i < len; i++) {
       if ('.' == content[i]) {
@@ -843,8 +887,58 @@ void _WSContentSendBuffer(bool decimal, const char * formatP, va_list arg) {
       }
     }
   }
+}
+
+int32_t _WSContentConstLen(const char * formatP) {  // Length of format, or -1 if it contains a conversion
+  for (uint32_t i = 0; ; i++) {
+    char c = pgm_read_byte(formatP + i);
+    if ('%' == c) { return -1; }
+    if ('\0' == c) { return i; }
+  }
+}
+
+void _WSContentSendBuffer(bool decimal, const char * formatP, va_list arg) {
+  int32_t const_len = (decimal) ? -1 : _WSContentConstLen(formatP);
+  if (const_len >= 0) {                            // Constant content, streamed without formatting
+    if (0 == const_len) { return; }                // No content
+    WSContentSeparator(2);                         // Print separator on next WSContentSeparator(1)
+    _WSContentAppend(formatP, const_len, true);
+    return;
+  }
 
-  _WSContentSendBufferChunk(content);
+  if (Web.chunk_buffer) {
+    // Format directly at the end of the chunk buffer, retry in an empty buffer if it does not fit
+    for (uint32_t retry = 0; retry < 2; retry++) {
+      if ((retry > 0) || (WEB_CHUNK_BUFFER_SIZE - Web.chunk_len < 2)) {
+        if (0 == Web.chunk_len) { break; }         // Already empty, content is oversize
+        WSContentFlush();
+      }
+      uint32_t room = WEB_CHUNK_BUFFER_SIZE - Web.chunk_len;
+      char* tail = Web.chunk_buffer + Web.chunk_len;
+      va_list arg_copy;
+      va_copy(arg_copy, arg);
+      int32_t len = ext_vsnprintf_P(tail, room, formatP, arg_copy);
+      va_end(arg_copy);
+      if (len <= 0) { return; }                    // No content
+      if ((uint32_t)len < room) {
+        WSContentSeparator(2);                     // Print separator on next WSContentSeparator(1)
+        _WSContentDecimal(decimal, tail, len);
+        Web.chunk_len += len;
+        return;
+      }
+    }
+  }
+
+  // Content is larger than the chunk buffer
+  char* content = ext_vsnprintf_malloc_P(formatP, arg);
+  if (content == nullptr) { return; }              // Avoid crash
+
+  int len = strlen(content);
+  if (0 == len) { free(content); return; }         // No content
+
+  WSContentSeparator(2);                           // Print separator on next WSContentSeparator(1)
+  _WSContentDecimal(decimal, content, len);
+  _WSContentAppend(content, len, false);
   free(content);
 }
 
@@ -1035,8 +1129,14 @@ void WSContentSend_THD(const char *types, float f_temperature, float f_humidity)
 
 void WSContentEnd(void) {
   WSContentFlush();                                // Flush chunk buffer
-  _WSContentSend("");                              // Signal end of chunked content
+  Webserver->sendContent("", 0);                   // Signal end of chunked content
   Webserver->client().stop();
+
+  Web.page.time = TimePassedSince(Web.page_start);
+  Web.page.heap_used = Web.page_heap - Web.page_heap_min;
+  Web.last_page = Web.page;
+  if (Web.page.time > Web.max_time) { Web.max_time = Web.page.time; }
+  if (Web.page.heap_used > Web.max_heap_used) { Web.max_heap_used = Web.page.heap_used; }
 #if defined(USE_MI_ESP32) && !defined(USE_BLE_ESP32)
   MI32resumeScanTask();
 #endif // defined(USE_MI_ESP32) && !defined(USE_BLE_ESP32)
@@ -1140,6 +1240,9 @@ uint32_t WebUseManagementSubmenu(void) {
     XdrvMailbox.index = 1;
     XdrvXsnsCall(FUNC_WEB_ADD_CONSOLE_BUTTON);
     XdrvCall(FUNC_WEB_ADD_MANAGEMENT_BUTTON);
+#ifdef USE_PROFILE_STATS
+    XdrvMailbox.index++;                   // Profile button
+#endif  // USE_PROFILE_STATS
     management_count = XdrvMailbox.index;
   }
   return management_count -1;
@@ -3215,6 +3318,9 @@ void HandleManagement(void)
   XdrvXsnsCall(FUNC_WEB_ADD_CONSOLE_BUTTON);
 //  WSContentSend_P(PSTR("<div></div>"));            // 5px padding
   XdrvCall(FUNC_WEB_ADD_MANAGEMENT_BUTTON);
+#ifdef USE_PROFILE_STATS
+  WSContentSend_P(HTTP_BTN_MENU_PROFILE);
+#endif  // USE_PROFILE_STATS
 
   WSContentSpaceButton(BUTTON_MAIN);
   WSContentStop();
@@ -18,6 +18,7 @@
 */
 
 #define XDRV_02                    2
+#define XDRV_02_FUNC               (XFUNC_EVERY_50_MSECOND)
 
 #define USE_MQTT_NEW_PUBSUBCLIENT
 
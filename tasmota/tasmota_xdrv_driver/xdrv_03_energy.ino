@@ -24,7 +24,9 @@
 \*********************************************************************************************/
 
 #define XDRV_03                3
+#define XDRV_03_FUNC           (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_200_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 #define XSNS_03                3
+#define XSNS_03_FUNC           (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_200_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 //#define USE_ENERGY_MARGIN_DETECTION
 //  #define USE_ENERGY_POWER_LIMIT
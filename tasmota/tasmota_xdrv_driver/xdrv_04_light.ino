@@ -123,6 +123,7 @@
 \*********************************************************************************************/
 
 #define XDRV_04              4
+#define XDRV_04_FUNC         (XFUNC_LOOP | XFUNC_EVERY_50_MSECOND)
 // #define DEBUG_LIGHT
 
 #ifdef USE_NETWORK_LIGHT_SCHEMES
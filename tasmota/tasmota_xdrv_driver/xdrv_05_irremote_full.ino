@@ -58,6 +58,7 @@ def ir_expand(ir_compact):
 \*********************************************************************************************/
 
 #define XDRV_05             5
+#define XDRV_05_FUNC        (XFUNC_EVERY_50_MSECOND)
 
 #include <IRremoteESP8266.h>
 #include <IRsend.h>
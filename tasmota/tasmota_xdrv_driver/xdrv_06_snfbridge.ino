@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_06                   6
+#define XDRV_06_FUNC              XFUNC_NONE
 
 #define SFB_TIME_AVOID_DUPLICATE  2000  // Milliseconds
 
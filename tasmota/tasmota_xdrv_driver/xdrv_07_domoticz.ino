@@ -38,6 +38,7 @@
 \*********************************************************************************************/
 
 #define XDRV_07             7
+#define XDRV_07_FUNC        (XFUNC_EVERY_SECOND)
 
 //#define USE_DOMOTICZ_DEBUG    // Enable additional debug logging
 
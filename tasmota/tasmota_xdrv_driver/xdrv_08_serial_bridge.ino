@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_08                    8
+#define XDRV_08_FUNC               (XFUNC_LOOP | XFUNC_SLEEP_LOOP)
 #define HARDWARE_FALLBACK          2
 
 #define USE_SERIAL_BRIDGE_TEE
@@ -37,6 +37,7 @@
 \*********************************************************************************************/
 
 #define XDRV_09             9
+#define XDRV_09_FUNC        (XFUNC_EVERY_SECOND)
 
 const char kTimerCommands[] PROGMEM = "|"  // No prefix
   D_CMND_TIMER "|" D_CMND_TIMERS
@@ -67,6 +67,7 @@
 \*********************************************************************************************/
 
 #define XDRV_10                 10
+#define XDRV_10_FUNC            (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 #ifndef RULE_MAX_EVENTSZ
 #define RULE_MAX_EVENTSZ        100
@@ -164,11 +165,54 @@ void (* const RulesCommand[])(void) PROGMEM = {
 #endif
   };
 
+#define RULE_INDEX_OVERFLOW     31      // Index bit shared by trigger 31 and any following one
+#define RULE_MAX_TRIGGER_DEPTH  12      // Maximum number of JSON levels in a trigger like SUBTYPE1#SUBTYPE2#CURRENT
+
+#define RULE_TRIGGER_TELE       0x01    // Trigger starts with TELE-
+#define RULE_TRIGGER_BREAK      0x02    // Commands end with BREAK instead of ENDON
+#define RULE_TRIGGER_FILE       0x04    // FILE# data holder, never triggers
+#define RULE_TRIGGER_INVALID    0x08    // Trigger can never match
+
+enum RuleOperands { RULE_OPERAND_CONST, RULE_OPERAND_VAR, RULE_OPERAND_MEM, RULE_OPERAND_TIME, RULE_OPERAND_UPTIME,
+                    RULE_OPERAND_TIMESTAMP, RULE_OPERAND_TIMER, RULE_OPERAND_SUNRISE, RULE_OPERAND_SUNSET, RULE_OPERAND_COLOR };
+
+struct RuleTrigger {
+  float value;                          // Pre-parsed value of constant operand
+  uint16_t key;                         // Offset in text of first NULL separated JSON key
+  uint16_t operand;                     // Offset in text of upper case constant operand
+  uint16_t trigger;                     // Offset in text of trigger as entered
+  uint16_t command;                     // Offset in text of command block
+  uint16_t command_len;
+  uint8_t trigger_len;
+  int8_t compare;                       // COMPARE_OPERATOR_*
+  uint8_t depth;                        // Number of JSON keys
+  uint8_t name_idx;                     // Array index 1..6 like CURRENT[2] or 0 if none
+  uint8_t operand_type;                 // RULE_OPERAND_*
+  uint8_t operand_idx;                  // Index of %VARx%, %MEMx% or %TIMERx%
+  uint8_t flags;                        // RULE_TRIGGER_*
+  bool once;                            // Matched on previous event, used by Rule<x> 5 (Once ON)
+};
+
+struct RuleSetCompiled {
+  char *text;                           // Rule as entered followed by the upper case copy holding keys and operands
+  RuleTrigger *trigger;
+  uint16_t count;
+};
+
+// Triggers per rule set using the same event root key like INA219 in INA219#CURRENT>0.100
+struct RuleKeyIndex {
+  uint32_t hash;                        // GetHash() of upper case root key
+  uint32_t triggers[MAX_RULE_SETS];     // Bitmask of triggers per rule set, bit RULE_INDEX_OVERFLOW for trigger 31 and up
+};
+
 struct RULES {
   String event_value;
   unsigned long timer[MAX_RULE_TIMERS] = { 0 };
-  uint32_t triggers[MAX_RULE_SETS] = { 0 };
-  uint8_t trigger_count[MAX_RULE_SETS] = { 0 };
+  RuleSetCompiled compiled[MAX_RULE_SETS];
+  RuleKeyIndex *index[2] = { nullptr }; // Root key index sorted by hash for events [0] and teleperiod events [1]
+  uint32_t index_any[2][MAX_RULE_SETS] = {{ 0 }};  // Triggers with any root key '?'
+  uint8_t index_count[2] = { 0 };
+  uint8_t compile_pending = 0;          // Bitmask of rule sets to (re)compile before next event
 
   long new_power = -1;
   long old_power = -1;
@@ -409,240 +453,465 @@ int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
 }
 
 /*******************************************************************************************/
+/*
+ * Compiled rule triggers
+ *
+ * A rule set is compiled into a table of triggers when it is changed with command Rule<x> and
+ * at restart. Every `ON <trigger> DO <commands> ENDON` gets one entry holding its pre-split
+ * upper case JSON keys, compare operator, constant value or variable reference and the offset
+ * of its command block. An event is parsed once and each trigger is resolved with a key
+ * lookup and a compare.
+ *
+ * RuleSetCompiled.text holds "<rule as entered>\0<upper case rule>\0" where the upper case
+ * copy is cut in place into NULL terminated keys and operands:
+ *   "ON INA219#CURRENT>0.100 DO ..." -> key "INA219\0CURRENT\0", operand "0.100\0"
+ */
+/*******************************************************************************************/
 
-bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all_rules)
-{
-  // event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
-  // event = {"System":{"Boot":1}}
-  // rule = "INA219#CURRENT>0.100"
+void RulesFreeCompiled(uint32_t rule_set) {
+  RuleSetCompiled &set = Rules.compiled[rule_set];
+  free(set.trigger);
+  free(set.text);
+  set.trigger = nullptr;
+  set.text = nullptr;
+  set.count = 0;
+}
 
-  bool match = false;
-  char stemp[10];
+void RulesResetOnce(uint32_t rule_set) {
+  RuleSetCompiled &set = Rules.compiled[rule_set];
+  for (uint32_t index = 0; index < set.count; index++) {
+    set.trigger[index].once = false;
+  }
+}
 
-  // Step1: Analyse rule
-  String rule_expr = rule;                             // "TELE-INA219#CURRENT>0.100"
-  if (Rules.teleperiod) {
-    int ppos = rule_expr.indexOf(F("TELE-"));          // "TELE-INA219#CURRENT>0.100" or "INA219#CURRENT>0.100"
-    if (ppos == -1) { return false; }                  // No pre-amble in rule
-    rule_expr = rule.substring(5);                     // "INA219#CURRENT>0.100" or "SYSTEM#BOOT"
+// Return index of "%<name><1..max>%" at start of operand or -1 if not found
+int32_t RulesOperandIndex(const char *operand, const char *name, uint32_t max) {
+  char stemp[16];
+  for (uint32_t i = 1; i <= max; i++) {
+    snprintf_P(stemp, sizeof(stemp), PSTR("%%%s%d%%"), name, i);
+    if (!strncmp(operand, stemp, strlen(stemp))) { return i -1; }
   }
+  return -1;
+}
 
-  String rule_name, rule_param;
-  int8_t compareOperator = parseCompareExpression(rule_expr, rule_name, rule_param);  // Parse the compare expression.Return operator and the left, right part of expression
+void RulesCompileOperand(struct RuleTrigger &trigger, const char *operand) {
+  // operand = "0.100" or "%VAR1%"
+  int32_t index;
+  if ((index = RulesOperandIndex(operand, "VAR", MAX_RULE_VARS)) >= 0) {
+    trigger.operand_type = RULE_OPERAND_VAR;
+  }
+  else if ((index = RulesOperandIndex(operand, "MEM", MAX_RULE_MEMS)) >= 0) {
+    trigger.operand_type = RULE_OPERAND_MEM;
+  }
+  else if (!strncmp_P(operand, PSTR("%TIME%"), 6)) {
+    trigger.operand_type = RULE_OPERAND_TIME;
+  }
+  else if (!strncmp_P(operand, PSTR("%UPTIME%"), 8)) {
+    trigger.operand_type = RULE_OPERAND_UPTIME;
+  }
+  else if (!strncmp_P(operand, PSTR("%TIMESTAMP%"), 11)) {
+    trigger.operand_type = RULE_OPERAND_TIMESTAMP;
+  }
+#if defined(USE_TIMERS)
+  else if ((index = RulesOperandIndex(operand, "TIMER", MAX_TIMERS)) >= 0) {
+    trigger.operand_type = RULE_OPERAND_TIMER;
+  }
+#if defined(USE_SUNRISE)
+  else if (!strncmp_P(operand, PSTR("%SUNRISE%"), 9)) {
+    trigger.operand_type = RULE_OPERAND_SUNRISE;
+  }
+  else if (!strncmp_P(operand, PSTR("%SUNSET%"), 8)) {
+    trigger.operand_type = RULE_OPERAND_SUNSET;
+  }
+#endif  // USE_SUNRISE
+#endif  // USE_TIMERS
+#if defined(USE_LIGHT)
+  else if (!strncmp_P(operand, PSTR("%COLOR%"), 7)) {
+    trigger.operand_type = RULE_OPERAND_COLOR;
+  }
+#endif  // USE_LIGHT
+  else {
+    trigger.operand_type = RULE_OPERAND_CONST;
+    int temp_value = GetStateNumber(operand);
+    if (temp_value > -1) {
+      trigger.value = temp_value;
+    } else {
+      trigger.value = CharToFloat(operand);            // 0.1      - This saves 9k code over toFLoat()!
+    }
+  }
+  if (index >= 0) { trigger.operand_idx = index; }
+}
 
-  // rule_name  = "INA219#CURRENT"
-  // rule_param = "0.100" or "%VAR1%"
+// Compile trigger "TELE-INA219#CURRENT[1]>0.100" in place
+void RulesCompileTrigger(struct RuleTrigger &trigger, char *text, char *expr) {
+  if (!strncmp_P(expr, PSTR("FILE#"), 5)) { trigger.flags |= RULE_TRIGGER_FILE; }
+  if (!strncmp_P(expr, PSTR("TELE-"), 5)) { trigger.flags |= RULE_TRIGGER_TELE; }
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM1: Teleperiod %d, Expr %s, Name %s, Param %s"), Rules.teleperiod, rule_expr.c_str(), rule_name.c_str(), rule_param.c_str());
-#endif
+  // Split compare expression like parseCompareExpression()
+  char *operand = expr + strlen(expr);                 // Empty operand if no compare operator
+  trigger.compare = COMPARE_OPERATOR_NONE;
+  char compare_operator[3];
+  for (int32_t i = MAXIMUM_COMPARE_OPERATOR; i >= 0; i--) {
+    snprintf_P(compare_operator, sizeof(compare_operator), kCompareOperators + (i *2));
+    char *position = strstr(expr, compare_operator);
+    if (position && (position > expr)) {
+      trigger.compare = i;
+      *position = '\0';
+      operand = Trim(position + strlen(compare_operator));
+      expr = Trim(expr);                               // "INA219#CURRENT"
+      break;
+    }
+  }
+  if (strlen(operand) > 79) { operand[79] = '\0'; }   // Same limit as in-event value buffer
+  trigger.operand = operand - text;
+  if (trigger.compare != COMPARE_OPERATOR_NONE) {
+    RulesCompileOperand(trigger, operand);
+  }
 
-  char rule_svalue[80] = { 0 };
-  float rule_value = 0;
-  if (compareOperator != COMPARE_OPERATOR_NONE) {
-    for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
-      snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = rules_vars[i];
-        break;
-      }
+  char *bracket = strchr(expr, '[');                   // "SUBTYPE1#CURRENT[1]"
+  if (bracket && (bracket > expr)) {
+    trigger.name_idx = atoi(bracket +1);
+    if ((trigger.name_idx < 1) || (trigger.name_idx > 6)) {  // Allow indexes 1 to 6
+      trigger.name_idx = 1;
     }
-    for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
-      snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-      if (rule_param.startsWith(stemp)) {
-        rule_param = SettingsText(SET_MEM1 + i);
-        break;
-      }
+    *bracket = '\0';                                   // "SUBTYPE1#CURRENT"
+  }
+
+  trigger.key = expr - text;
+  trigger.depth = 1;
+  char *hash;
+  while ((hash = strchr(expr, '#')) && (hash > expr)) {  // "SUBTYPE1#SUBTYPE2#CURRENT"
+    *hash = '\0';
+    expr = hash +1;
+    trigger.depth++;
+  }
+  if (trigger.depth > RULE_MAX_TRIGGER_DEPTH) { trigger.flags |= RULE_TRIGGER_INVALID; }
+}
+
+void RulesCompile(uint32_t rule_set) {
+  bitClear(Rules.compile_pending, rule_set);
+  RulesFreeCompiled(rule_set);
+
+  String rules = GetRule(rule_set);
+  size_t len = rules.length();
+  if (!len) { return; }
+
+  RuleSetCompiled &set = Rules.compiled[rule_set];
+  set.text = (char*)malloc(2 * (len +1));
+  if (!set.text) { return; }
+  memcpy(set.text, rules.c_str(), len +1);
+  char *upper = set.text + len +1;
+  UpperCase(upper, set.text);                          // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
+
+  uint32_t size = 0;
+  char *rule = upper;
+  while (true) {
+    while (isspace(*rule)) { rule++; }
+    if (strncmp_P(rule, PSTR("ON "), 3)) { break; }    // Bad syntax - Nothing to start on
+    char *pevt = strstr_P(rule, PSTR(" DO "));
+    if (!pevt) { break; }                              // Bad syntax - Nothing to do
+    char *pend = strstr_P(rule, PSTR(" ENDON"));
+    char *pbreak = strstr_P(rule, PSTR(" BREAK"));
+    if (!pend && !pbreak) { break; }                   // Bad syntax - No ENDON neither BREAK
+
+    if (set.count == size) {
+      size += 4;
+      RuleTrigger *triggers = (RuleTrigger*)realloc(set.trigger, size * sizeof(RuleTrigger));
+      if (!triggers) { break; }
+      set.trigger = triggers;
+    }
+    RuleTrigger &trigger = set.trigger[set.count++];
+    memset(&trigger, 0, sizeof(RuleTrigger));
+    if (pbreak && (!pend || (pbreak < pend))) {
+      trigger.flags |= RULE_TRIGGER_BREAK;
+      pend = pbreak;
+    }
+
+    char *command = pevt +4;
+    if (command > pend) { command = pend; }
+    while ((command < pend) && isspace(*command)) { command++; }
+    char *command_end = pend;
+    while ((command_end > command) && isspace(*(command_end -1))) { command_end--; }
+    trigger.command = command - upper;                 // Same offset in rule as entered
+    trigger.command_len = command_end - command;
+
+    *pevt = '\0';
+    char *expr = Trim(rule +3);                        // "INA219#CURRENT>0.100"
+    trigger.trigger = expr - upper;
+    trigger.trigger_len = tmin(strlen(expr), 255);
+    RulesCompileTrigger(trigger, set.text, expr);
+
+    rule = pend +6;
+  }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Rule%d compiled %d triggers"), rule_set +1, set.count);
+}
+
+/*******************************************************************************************/
+/*
+ * Root key index
+ *
+ * Maps the first key of every trigger to the triggers using it, so an event only evaluates
+ * triggers whose root key is present in the event:
+ *   {"INA219":{...},"DS18B20":{...}} -> triggers of INA219#... and DS18B20#...
+ * Teleperiod events use a separate index keyed on the root key following TELE-
+ */
+/*******************************************************************************************/
+
+// Return position of hash in index or position where to insert it
+uint32_t RulesIndexSearch(uint32_t tele, uint32_t hash, bool &found) {
+  int32_t low = 0;
+  int32_t high = Rules.index_count[tele] -1;
+  while (low <= high) {
+    int32_t mid = (low + high) / 2;
+    uint32_t mid_hash = Rules.index[tele][mid].hash;
+    if (mid_hash == hash) {
+      found = true;
+      return mid;
+    }
+    if (mid_hash < hash) {
+      low = mid +1;
+    } else {
+      high = mid -1;
     }
-    if (rule_param.startsWith(F("%TIME%"))) {
-      rule_param = String(MinutesPastMidnight());
+  }
+  found = false;
+  return low;
+}
+
+void RulesIndexAdd(uint32_t tele, const char *key, uint32_t rule_set, uint32_t index) {
+  if (!strcmp_P(key, PSTR("?"))) {                     // Any key
+    bitSet(Rules.index_any[tele][rule_set], tmin(index, RULE_INDEX_OVERFLOW));
+    return;
+  }
+  uint32_t hash = GetHash(key, strlen(key));
+  bool found;
+  uint32_t pos = RulesIndexSearch(tele, hash, found);
+  if (!found) {
+    RuleKeyIndex *entries = (RuleKeyIndex*)realloc(Rules.index[tele], (Rules.index_count[tele] +1) * sizeof(RuleKeyIndex));
+    if (!entries) { return; }
+    Rules.index[tele] = entries;
+    memmove(&entries[pos +1], &entries[pos], (Rules.index_count[tele] - pos) * sizeof(RuleKeyIndex));
+    memset(&entries[pos], 0, sizeof(RuleKeyIndex));
+    entries[pos].hash = hash;
+    Rules.index_count[tele]++;
+  }
+  bitSet(Rules.index[tele][pos].triggers[rule_set], tmin(index, RULE_INDEX_OVERFLOW));
+}
+
+void RulesBuildIndex(void) {
+  for (uint32_t tele = 0; tele < 2; tele++) {
+    free(Rules.index[tele]);
+    Rules.index[tele] = nullptr;
+    Rules.index_count[tele] = 0;
+  }
+  memset(Rules.index_any, 0, sizeof(Rules.index_any));
+
+  for (uint32_t rule_set = 0; rule_set < MAX_RULE_SETS; rule_set++) {
+    const RuleSetCompiled &set = Rules.compiled[rule_set];
+    for (uint32_t index = 0; index < set.count; index++) {
+      const RuleTrigger &trigger = set.trigger[index];
+      if (trigger.flags & (RULE_TRIGGER_FILE | RULE_TRIGGER_INVALID)) { continue; }
+      const char *key = set.text + trigger.key;
+      RulesIndexAdd(0, key, rule_set, index);
+      if (trigger.flags & RULE_TRIGGER_TELE) {
+        RulesIndexAdd(1, key +5, rule_set, index);     // Skip "TELE-"
+      }
     }
-    if (rule_param.startsWith(F("%UPTIME%"))) {
-      rule_param = String(MinutesUptime());
+  }
+}
+
+// Collect triggers per rule set for the root keys of the event
+void RulesIndexLookup(class JsonParserObject root, uint32_t *triggers) {
+  uint32_t tele = Rules.teleperiod;
+  memcpy(triggers, Rules.index_any[tele], sizeof(Rules.index_any[tele]));
+  for (auto key : root) {
+    const char *name = key.getStr();                   // Upper case as event is upper case
+    bool found;
+    uint32_t pos = RulesIndexSearch(tele, GetHash(name, strlen(name)), found);
+    if (found) {
+      for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+        triggers[i] |= Rules.index[tele][pos].triggers[i];
+      }
     }
-    if (rule_param.startsWith(F("%TIMESTAMP%"))) {
-      rule_param = GetDateAndTime(DT_LOCAL).c_str();
+  }
+}
+
+// Compile rule sets changed since last event
+void RulesCompilePending(void) {
+  if (!Rules.compile_pending) { return; }
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (bitRead(Rules.compile_pending, i)) {
+      RulesCompile(i);
     }
+  }
+  RulesBuildIndex();
+}
+
+// Resolve operand of trigger to its upper case text and value
+const char* RulesTriggerOperand(const struct RuleSetCompiled &set, const struct RuleTrigger &trigger, char *svalue, size_t ssize, float &value) {
+  if (RULE_OPERAND_CONST == trigger.operand_type) {
+    value = trigger.value;
+    return set.text + trigger.operand;
+  }
+  switch (trigger.operand_type) {
+    case RULE_OPERAND_VAR:
+      strlcpy(svalue, rules_vars[trigger.operand_idx], ssize);
+      break;
+    case RULE_OPERAND_MEM:
+      strlcpy(svalue, SettingsText(SET_MEM1 + trigger.operand_idx), ssize);
+      break;
+    case RULE_OPERAND_TIME:
+      snprintf_P(svalue, ssize, PSTR("%d"), MinutesPastMidnight());
+      break;
+    case RULE_OPERAND_UPTIME:
+      snprintf_P(svalue, ssize, PSTR("%u"), MinutesUptime());
+      break;
+    case RULE_OPERAND_TIMESTAMP:
+      strlcpy(svalue, GetDateAndTime(DT_LOCAL).c_str(), ssize);
+      break;
 #if defined(USE_TIMERS)
-    if (rule_param.startsWith(F("%TIMER"))) {
-      uint32_t index = rule_param.substring(6).toInt();
-      if ((index > 0) && (index <= MAX_TIMERS)) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%TIMER%d%%"), index);
-        if (rule_param.startsWith(stemp)) {
-          rule_param = String(TimerGetTimeOfDay(index -1));
-        }
-      }
-    }
+    case RULE_OPERAND_TIMER:
+      snprintf_P(svalue, ssize, PSTR("%d"), TimerGetTimeOfDay(trigger.operand_idx));
+      break;
 #if defined(USE_SUNRISE)
-    if (rule_param.startsWith(F("%SUNRISE%"))) {
-      rule_param = String(SunMinutes(0));
-    }
-    if (rule_param.startsWith(F("%SUNSET%"))) {
-      rule_param = String(SunMinutes(1));
-    }
+    case RULE_OPERAND_SUNRISE:
+      snprintf_P(svalue, ssize, PSTR("%d"), SunMinutes(0));
+      break;
+    case RULE_OPERAND_SUNSET:
+      snprintf_P(svalue, ssize, PSTR("%d"), SunMinutes(1));
+      break;
 #endif  // USE_SUNRISE
 #endif  // USE_TIMERS
 #if defined(USE_LIGHT)
-    char scolor[LIGHT_COLOR_SIZE];
-    if (rule_param.startsWith(F("%COLOR%"))) {
-      rule_param = LightGetColor(scolor);
+    case RULE_OPERAND_COLOR: {
+      char scolor[LIGHT_COLOR_SIZE];
+      strlcpy(svalue, LightGetColor(scolor), ssize);
+      break;
     }
 #endif  // USE_LIGHT
-// #ifdef USE_ZIGBEE
-//     if (rule_param.startsWith(F("%ZBDEVICE%"))) {
-//       snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-//       rule_param = String(stemp);
-//     }
-//     if (rule_param.startsWith(F("%ZBGROUP%"))) {
-//       rule_param = String(Z_GetLastGroup());
-//     }
-//     if (rule_param.startsWith(F("%ZBCLUSTER%"))) {
-//       rule_param = String(Z_GetLastCluster());
-//     }
-//     if (rule_param.startsWith(F("%ZBENDPOINT%"))) {
-//       rule_param = String(Z_GetLastEndpoint());
-//     }
-// #endif  // USE_ZIGBEE
-    rule_param.toUpperCase();
-    strlcpy(rule_svalue, rule_param.c_str(), sizeof(rule_svalue));
-
-    int temp_value = GetStateNumber(rule_svalue);
-    if (temp_value > -1) {
-      rule_value = temp_value;
-    } else {
-      rule_value = CharToFloat((char*)rule_svalue);    // 0.1      - This saves 9k code over toFLoat()!
-    }
+    default:
+      svalue[0] = '\0';
   }
-
-  // Step2: Search rule_name
-  int pos;
-  int rule_name_idx = 0;
-  if ((pos = rule_name.indexOf(F("["))) > 0) {         // "SUBTYPE1#CURRENT[1]"
-    rule_name_idx = rule_name.substring(pos +1).toInt();
-    if ((rule_name_idx < 1) || (rule_name_idx > 6)) {  // Allow indexes 1 to 6
-      rule_name_idx = 1;
-    }
-    rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
+  UpperCase(svalue, svalue);
+  int temp_value = GetStateNumber(svalue);
+  if (temp_value > -1) {
+    value = temp_value;
+  } else {
+    value = CharToFloat(svalue);
   }
+  return svalue;
+}
 
-  String buf = event;                                  // Copy the string into a new buffer that will be modified
-
-// Do not do below replace as it will replace escaped quote too.
-//  buf.replace("\\"," ");                               // "Disable" any escaped control character
+bool RulesRuleMatch(uint32_t rule_set, uint32_t index, class JsonParserObject obj, bool stop_all_rules)
+{
+  // obj = {"INA219":{"VOLTAGE":4.494,"CURRENT":0.020,"POWER":0.089}}
+  // obj = {"SYSTEM":{"BOOT":1}}
+  // trigger key = "INA219\0CURRENT\0"
 
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM2: RulesRuleMatch '%s'"), buf.c_str());
+  const RuleSetCompiled &set = Rules.compiled[rule_set];
+  RuleTrigger &trigger = set.trigger[index];
+  if (trigger.flags & (RULE_TRIGGER_FILE | RULE_TRIGGER_INVALID)) { return false; }
 
-  JsonParser parser((char*)buf.c_str());
-  JsonParserObject obj = parser.getRootObject();
-  if (!obj) {
-//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event too long (%d)"), event.length());
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), buf.c_str());
-    return false; // No valid JSON data
+  // Step1: Search trigger keys
+  const char *key = set.text + trigger.key;
+  if (Rules.teleperiod) {
+    if (!(trigger.flags & RULE_TRIGGER_TELE)) { return false; }  // No pre-amble in rule
+    key += 5;                                          // Skip "TELE-"
   }
-  String subtype;
-  uint32_t i = 0;
-  while ((pos = rule_name.indexOf(F("#"))) > 0) {      // "SUBTYPE1#SUBTYPE2#CURRENT"
-    subtype = rule_name.substring(0, pos);
-    obj = obj[subtype.c_str()].getObject();
+  for (uint32_t level = 1; level < trigger.depth; level++) {
+    obj = obj[key].getObject();
     if (!obj) { return false; }                        // not found
-
-    rule_name = rule_name.substring(pos +1);
-    if (i++ > 10) { return false; }                    // Abandon possible loop
-
-    yield();
+    key += strlen(key) +1;
   }
 
-  JsonParserToken val = obj[rule_name.c_str()];
+  JsonParserToken val = obj[key];
   if (!val) { return false; }                          // last level not found
   const char* str_value;
-  if (rule_name_idx) {
-    if (val.isArray()) {
-      str_value = (val.getArray())[rule_name_idx -1].getStr();
-    } else {
-      str_value = val.getStr();
-    }
+  if (trigger.name_idx && val.isArray()) {
+    str_value = (val.getArray())[trigger.name_idx -1].getStr();
   } else {
     str_value = val.getStr();                          // "CURRENT"
   }
 
+  // Step2: Resolve rule value
+  char svalue[80];
+  float rule_value = 0;
+  const char *rule_svalue = RulesTriggerOperand(set, trigger, svalue, sizeof(svalue), rule_value);
+
 #ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM3: Name %s, Value '%s', TrigCnt %d, TrigSt %d, Source %s, Json '%s'"),
-    rule_name.c_str(), rule_svalue, Rules.trigger_count[rule_set], bitRead(Rules.triggers[rule_set],
-    Rules.trigger_count[rule_set]), event.c_str(), (str_value[0] != '\0') ? str_value : "none");
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM1: Teleperiod %d, Key %s, Param %s, Value '%s', TrigSt %d"),
+    Rules.teleperiod, key, rule_svalue, str_value, trigger.once);
 #endif
 
-  Rules.event_value = str_value;                       // Prepare %value%
-
   // Step 3: Compare rule (value)
-  float value = 0;
-  if (str_value) {
-    value = CharToFloat((char*)str_value);
-    int int_value = int(value);
-    int int_rule_value = int(rule_value);
-    String str_str_value = String(str_value);
-    switch (compareOperator) {
-      case COMPARE_OPERATOR_EXACT_DIVISION:
-        match = (int_rule_value && (int_value % int_rule_value) == 0);
-        break;
-      case COMPARE_OPERATOR_EQUAL:
-        match = (!strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
-        break;
-      case COMPARE_OPERATOR_BIGGER:
-        match = (value > rule_value);
-        break;
-      case COMPARE_OPERATOR_SMALLER:
-        match = (value < rule_value);
-        break;
-      case COMPARE_OPERATOR_NUMBER_EQUAL:
-        match = (value == rule_value);
-        break;
-      case COMPARE_OPERATOR_NOT_EQUAL:
-        match = (value != rule_value);
-        break;
-      case COMPARE_OPERATOR_BIGGER_EQUAL:
-        match = (value >= rule_value);
-        break;
-      case COMPARE_OPERATOR_SMALLER_EQUAL:
-        match = (value <= rule_value);
-        break;
-      case COMPARE_OPERATOR_STRING_ENDS_WITH:
-        match = str_str_value.endsWith(rule_svalue);
-        break;
-      case COMPARE_OPERATOR_STRING_STARTS_WITH:
-        match = str_str_value.startsWith(rule_svalue);
-        break;
-      case COMPARE_OPERATOR_STRING_CONTAINS:
-        match = (str_str_value.indexOf(rule_svalue) >= 0);
-        break;
-      case  COMPARE_OPERATOR_STRING_NOT_EQUAL:
-        match = (0!=strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
-        break;
-      case  COMPARE_OPERATOR_STRING_NOT_CONTAINS:
-        match = (str_str_value.indexOf(rule_svalue) < 0);
-        break;
-      default:
-        match = true;
-    }
-  } else match = true;
+  bool match = false;
+  float value = CharToFloat((char*)str_value);
+  int int_value = int(value);
+  int int_rule_value = int(rule_value);
+  size_t str_len = strlen(str_value);
+  size_t rule_len = strlen(rule_svalue);
+  switch (trigger.compare) {
+    case COMPARE_OPERATOR_EXACT_DIVISION:
+      match = (int_rule_value && (int_value % int_rule_value) == 0);
+      break;
+    case COMPARE_OPERATOR_EQUAL:
+      match = (!strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+      break;
+    case COMPARE_OPERATOR_BIGGER:
+      match = (value > rule_value);
+      break;
+    case COMPARE_OPERATOR_SMALLER:
+      match = (value < rule_value);
+      break;
+    case COMPARE_OPERATOR_NUMBER_EQUAL:
+      match = (value == rule_value);
+      break;
+    case COMPARE_OPERATOR_NOT_EQUAL:
+      match = (value != rule_value);
+      break;
+    case COMPARE_OPERATOR_BIGGER_EQUAL:
+      match = (value >= rule_value);
+      break;
+    case COMPARE_OPERATOR_SMALLER_EQUAL:
+      match = (value <= rule_value);
+      break;
+    case COMPARE_OPERATOR_STRING_ENDS_WITH:
+      match = (str_len >= rule_len) && !strcmp(str_value + str_len - rule_len, rule_svalue);
+      break;
+    case COMPARE_OPERATOR_STRING_STARTS_WITH:
+      match = (str_len >= rule_len) && !strncmp(str_value, rule_svalue, rule_len);
+      break;
+    case COMPARE_OPERATOR_STRING_CONTAINS:
+      match = (strstr(str_value, rule_svalue) != nullptr);
+      break;
+    case  COMPARE_OPERATOR_STRING_NOT_EQUAL:
+      match = (0!=strcasecmp(str_value, rule_svalue));  // Compare strings - this also works for hexadecimals
+      break;
+    case  COMPARE_OPERATOR_STRING_NOT_CONTAINS:
+      match = (strstr(str_value, rule_svalue) == nullptr);
+      break;
+    default:
+      match = true;
+  }
 
   if (stop_all_rules) { match = false; }
 
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM4: Match 1 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
-
   if (bitRead(Settings->rule_once, rule_set)) {
     if (match) {                                       // Only allow match state changes
-      if (!bitRead(Rules.triggers[rule_set], Rules.trigger_count[rule_set])) {
-        bitSet(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+      if (!trigger.once) {
+        trigger.once = true;
       } else {
         match = false;
       }
     } else {
-      bitClear(Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
+      trigger.once = false;
     }
   }
 
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM5: Match 2 %d, Triggers %08X, TriggerCount %d"), match, Rules.triggers[rule_set], Rules.trigger_count[rule_set]);
-
+  if (match) {
+    Rules.event_value = str_value;                     // Prepare %value%
+  }
   return match;
 }
 
@@ -706,57 +975,29 @@ void RulesVarReplace(String &commands, const String &sfind, const String &replac
 
 /*******************************************************************************************/
 
-bool RuleSetProcess(uint8_t rule_set, String &event_saved)
+bool RuleSetProcess(uint8_t rule_set, class JsonParser &parser, uint32_t triggers)
 {
   bool serviced = false;
   char stemp[10];
 
   delay(0);                                               // Prohibit possible loop software watchdog
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event '%s', Rule '%s'"), event_saved.c_str(), Settings->rules[rule_set]);
-#endif
-
-  String rules = GetRule(rule_set);
-
-  Rules.trigger_count[rule_set] = 0;
-  int plen = 0;
-  int plen2 = 0;
+  const RuleSetCompiled &set = Rules.compiled[rule_set];
   bool stop_all_rules = false;
-  while (true) {
-    rules = rules.substring(plen);                        // Select relative to last rule
-    rules.trim();
-    if (!rules.length()) { return serviced; }             // No more rules
-
-    String rule = rules;
-    rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
-    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
+  for (uint32_t index = 0; index < set.count; index++) {
+    if (!bitRead(triggers, tmin(index, RULE_INDEX_OVERFLOW))) { continue; }  // Root key not in event
+    const RuleTrigger &trigger = set.trigger[index];
+    parser.setCurrent();                                  // Commands may have used another JsonParser
 
-    int pevt = rule.indexOf(F(" DO "));
-    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
-    String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
-    event_trigger.trim();
-
-    plen = rule.indexOf(F(" ENDON"));
-    plen2 = rule.indexOf(F(" BREAK"));
-    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
-
-    if (plen == -1) { plen = 9999; }
-    if (plen2 == -1) { plen2 = 9999; }
-    plen = tmin(plen, plen2);
-
-    String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
-    Rules.event_value = "";
-    String event = event_saved;
-
-#ifdef DEBUG_RULES
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event '%s', Rule '%s', Command(s) '%s'"), event.c_str(), event_trigger.c_str(), commands.c_str());
-#endif
-
-    if (!event_trigger.startsWith(F("FILE#")) && RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
+    if (RulesRuleMatch(rule_set, index, parser.getRootObject(), stop_all_rules)) {
       if (Rules.no_execute) return true;
-      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
-      commands.trim();
+      if (trigger.flags & RULE_TRIGGER_BREAK) { stop_all_rules = true; }  // If BREAK was used on a triggered rule, Stop execution of this rule set
+
+      char event_trigger[trigger.trigger_len +1];
+      strlcpy(event_trigger, set.text + trigger.trigger, sizeof(event_trigger));
+      char command_block[trigger.command_len +1];
+      strlcpy(command_block, set.text + trigger.command, sizeof(command_block));
+      String commands = command_block;                    // "Backlog Dimmer 10;Color 100000"
       String ucommand = commands;
       ucommand.toUpperCase();
 
@@ -820,7 +1061,7 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       char command[commands.length() +1];
       strlcpy(command, commands.c_str(), sizeof(command));
 
-      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs '%s'"), event_trigger.c_str(), command);
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs '%s'"), event_trigger, command);
 
 //      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
 //      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
@@ -831,8 +1072,6 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       ExecuteCommand(command, SRC_RULE);
       serviced = true;
     }
-    plen += 6;
-    Rules.trigger_count[rule_set]++;
   }
   return serviced;
 }
@@ -878,6 +1117,8 @@ bool RulesProcessEvent(const char *json_event)
 
   if (Rules.busy) { return false; }
 
+  RulesCompilePending();
+
   Rules.busy = true;
   bool serviced = false;
 
@@ -887,26 +1128,45 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: RulesProcessEvent '%s'"), json_event);
 #endif
 
-  String event_saved = json_event;
   // json_event = {"INA219":{"Voltage":4.494,"Current":0.020,"Power":0.089}}
   // json_event = {"System":{"Boot":1}}
   // json_event = {"SerialReceived":"on"} - invalid but will be expanded to {"SerialReceived":{"Data":"on"}}
-  char *p = strchr(json_event, ':');
-  if ((p != NULL) && !(strchr(++p, ':'))) {  // Find second colon
-    event_saved.replace(F(":"), F(":{\"Data\":"));
-    event_saved += F("}");
-    // event_saved = {"SerialReceived":{"Data":"on"}}
-  }
-  event_saved.toUpperCase();
+  uint32_t rule_sets = 0;
+  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+    if (Rules.compiled[i].count && bitRead(Settings->rule_enabled, i)) { bitSet(rule_sets, i); }
+  }
+  size_t event_len = strlen(json_event);
+  char *event = (rule_sets) ? (char*)malloc(event_len +11) : nullptr;  // Add room for {"Data": .. }
+  if (event) {
+    char *p = strchr(json_event, ':');
+    if ((p != NULL) && !(strchr(++p, ':'))) {  // Find second colon
+      size_t head_len = p - json_event;
+      memcpy(event, json_event, head_len);
+      snprintf_P(event + head_len, event_len +11 - head_len, PSTR("{\"Data\":%s}"), p);
+      // event = {"SerialReceived":{"Data":"on"}}
+    } else {
+      strcpy(event, json_event);
+    }
+    UpperCase(event, event);
 
 #ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event '%s'"), event_saved.c_str());
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event '%s'"), event);
 #endif
 
-  for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
-    if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
-      if (RuleSetProcess(i, event_saved)) { serviced = true; }
+    JsonParser parser(event);                              // Parse event once for all triggers
+    JsonParserObject root = parser.getRootObject();
+    if (root) {
+      uint32_t triggers[MAX_RULE_SETS];
+      RulesIndexLookup(root, triggers);
+      for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
+        if (bitRead(rule_sets, i) && triggers[i]) {
+          if (RuleSetProcess(i, parser, triggers[i])) { serviced = true; }
+        }
+      }
+    } else {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), event);
     }
+    free(event);
   }
 
   Rules.busy = false;
@@ -939,7 +1199,9 @@ void RulesInit(void)
       bitWrite(Settings->rule_enabled, i, 0);
       bitWrite(Settings->rule_once, i, 0);
     }
+    bitSet(Rules.compile_pending, i);
   }
+  RulesCompilePending();
   Rules.teleperiod = false;
 }
 
@@ -2289,8 +2551,9 @@ void CmndRule(void)
         if (res < 0) {
           AddLog(LOG_LEVEL_ERROR, PSTR("RUL: Not enough space"));
         }
+        bitSet(Rules.compile_pending, index -1);  // Compile before next event as rules may be executing
       }
-      Rules.triggers[index -1] = 0;  // Reset once flag
+      RulesResetOnce(index -1);
     }
     String rule = GetRule(index - 1);
     size_t rule_len = rule.length();
@@ -41,6 +41,7 @@ keywords if then else endif, or, and are better readable for beginners (others m
 \*********************************************************************************************/
 
 #define XDRV_10             10
+#define XDRV_10_FUNC        (XFUNC_LOOP | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 
 #ifndef TS_FLOAT
@@ -109,6 +110,8 @@ const uint8_t SCRIPT_VERS[2] = {5, 3};
 #define MAX_SARRAY_NUM 32
 #endif
 
+#define IF_NEST 8
+
 int32_t fast_mux(uint32_t flag, uint32_t time, TS_FLOAT *buf, uint32_t len);
 void Draw_jpeg(uint8_t *mem, uint16_t jpgsize, uint16_t xp, uint16_t yp, uint8_t scale);
 uint32_t EncodeLightId(uint8_t relay_id);
@@ -542,6 +545,20 @@ typedef struct {
 #endif // USE_SCRIPT_ONEWIRE
 
 #define SFS_MAX 4
+
+// token of the script text, resolved by Script_Compile()
+enum SCRIPT_TOK_TYPES {SCRIPT_TOK_NUM, SCRIPT_TOK_VAR, SCRIPT_TOK_JUMP};
+struct SCRIPT_TOK {
+  uint32_t ofs;       // offset of token from tok_base
+  uint8_t type;
+  uint8_t len;        // length of numeric constant
+  union {
+    TS_FLOAT val;     // numeric constant
+    int16_t vindex;   // var index, -1 = not a variable
+    uint32_t target;  // offset of else or endif line to jump to, 0 = none
+  };
+};
+
 // global memory
 typedef struct {
     TS_FLOAT *fvars; // number var pointer
@@ -722,6 +739,18 @@ typedef struct {
 
   uint16_t ufs_script_size;
 
+    // resolved at compile time by Script_Compile()
+    uint16_t *var_slot;   // hash table of variable name => var index + 1
+    uint16_t var_slot_mask;
+    uint32_t *sect_ofs;   // offsets of all '>' and '#' lines from sect_base
+    uint16_t sect_count;
+    char *sect_base;
+    struct SCRIPT_TOK *tok;   // sorted by offset
+    uint32_t tok_count;
+    uint32_t tok_hint;    // index of the next token expected
+    uint32_t tok_size;
+    char *tok_base;
+
 } SCRIPT_MEM;
 
 SCRIPT_MEM glob_script_mem;
@@ -1361,6 +1390,8 @@ char *script;
     glob_script_mem.scriptptr = lp - 1;
     glob_script_mem.scriptptr_bu = glob_script_mem.scriptptr;
 
+    Script_Compile();
+
 #ifdef USE_SCRIPT_GLOBVARS
     if (glob_script_mem.udp_flags.udp_used) {
       Script_Init_UDP();
@@ -1377,6 +1408,367 @@ char *script;
     return err;
 }
 
+/*********************************************************************************************\
+ * Compile step, runs on every (re)init of the script
+ *
+ * Resolves everything that is constant while the script text does not change:
+ * - variable names are hashed to their index, so isvar() does not scan all names
+ * - section and subroutine headers are indexed, so Run_script_sub() does not scan all lines
+ * - every numeric constant and identifier of a line is converted or resolved to its var index,
+ *   isvar() finds them by their offset in the script text
+ * - then and else lines get the offset of their else or endif line, so Run_script_sub()
+ *   jumps over the branch not taken instead of walking its lines
+\*********************************************************************************************/
+
+uint16_t Script_NameHash(const char *name, uint8_t len) {
+  uint16_t hash = len;
+  while (len--) {
+    hash = (hash * 31) + *name++;
+  }
+  return hash;
+}
+
+void Script_FreeCompiled(void) {
+  if (glob_script_mem.var_slot) {
+    free(glob_script_mem.var_slot);
+    glob_script_mem.var_slot = 0;
+  }
+  if (glob_script_mem.sect_ofs) {
+    free(glob_script_mem.sect_ofs);
+    glob_script_mem.sect_ofs = 0;
+  }
+  glob_script_mem.sect_count = 0;
+  glob_script_mem.sect_base = 0;
+  if (glob_script_mem.tok) {
+    free(glob_script_mem.tok);
+    glob_script_mem.tok = 0;
+  }
+  glob_script_mem.tok_count = 0;
+  glob_script_mem.tok_hint = 0;
+  glob_script_mem.tok_base = 0;
+}
+
+// convert numeric constant, returns pointer behind it
+char *Script_ParseNum(char *lp, TS_FLOAT *fp) {
+  if (*lp == '0' && *(lp + 1) == 'x') {
+    lp += 2;
+    *fp = strtoll(lp, &lp, 16);
+  } else {
+    *fp = CharToFloat(lp);
+    if (*lp == '-') lp++;
+    while (isdigit(*lp) || *lp == '.') {
+      if (*lp == 0 || *lp == SCRIPT_EOL) break;
+      lp++;
+    }
+  }
+  return lp;
+}
+
+// chars that continue a name or number, a token can not start behind them
+bool Script_IsNameChar(char c) {
+  return isalnum(c) || c == '_' || c == '.' || c == '#';
+}
+
+// var index of the name at lp, as isvar() resolves it, -2 if it can not be resolved
+int16_t Script_CompileVar(const char *lp) {
+  const char *term = "\n\r ])=+-/*%><!^&|}{";
+  uint8_t olen = 0;
+  for (uint32_t count = 0; count < 64; count++) {
+    char iob = lp[count];
+    if (!iob || strchr(term, iob)) {
+      const char *ja = (const char*)memchr(lp, '[', count);
+      olen = ja ? ja - lp : count;
+      if (olen >= 32) return -2;
+      return Script_FindVar(lp, olen);
+    }
+  }
+  return -2;
+}
+
+// add token at lp, only counted when the table is not allocated yet
+struct SCRIPT_TOK *Script_AddTok(uint32_t *count, char *lp, uint8_t type) {
+  struct SCRIPT_TOK *tok = 0;
+  if (glob_script_mem.tok) {
+    tok = &glob_script_mem.tok[*count];
+    tok->ofs = lp - glob_script_mem.tok_base;
+    tok->type = type;
+    tok->len = 0;
+    tok->target = 0;
+  }
+  (*count)++;
+  return tok;
+}
+
+// resolve tokens and if/else/endif jumps, first pass counts them, second pass fills them
+void Script_CompileTokens(void) {
+  char *base = glob_script_mem.scriptptr;
+  struct {
+    uint32_t tok;     // jump token of the then or else line, -1 if none
+    uint8_t state;    // as if_state in Run_script_sub()
+    bool clean;       // branch can be jumped over
+  } ifs[IF_NEST];
+  glob_script_mem.tok_base = base;
+  glob_script_mem.tok_size = strlen(base);
+  uint32_t count = 0;
+
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    char *lp = base;
+    uint8_t ifstck = 0;
+    bool nojump = false;
+    count = 0;
+    while (*lp) {
+      SCRIPT_SKIP_SPACES
+      if (*lp == SCRIPT_EOL) {
+        lp++;
+        continue;
+      }
+      if (*lp == ';' || *lp == '>' || *lp == '#') {
+        if (*lp != ';') {
+          // new section, blocks left open are never jumped over
+          ifstck = 0;
+          nojump = false;
+        }
+        goto next_line;
+      }
+
+      {
+        // block keywords, same rules as Run_script_sub()
+        char *klp = lp;
+        bool jump = false;
+        if (!strncmp(lp, "if", 2)) {
+          lp += 2;
+          if (ifstck < IF_NEST - 1) {
+            ifstck++;
+            ifs[ifstck].state = 1;
+            ifs[ifstck].tok = (uint32_t)-1;
+            ifs[ifstck].clean = true;
+          } else {
+            // Run_script_sub() reuses the last level, do not jump until the end of section
+            for (uint32_t level = 1; level <= ifstck; level++) {
+              ifs[level].clean = false;
+            }
+            ifs[ifstck].state = 1;
+            nojump = true;
+          }
+        } else if (!strncmp(lp, "then", 4) && ifstck && ifs[ifstck].state == 1) {
+          lp += 4;
+          ifs[ifstck].state = 2;
+          jump = true;
+        } else if (!strncmp(lp, "else", 4) && ifstck && ifs[ifstck].state == 2) {
+          lp += 4;
+          if (pass && ifs[ifstck].clean && ifs[ifstck].tok != (uint32_t)-1) {
+            glob_script_mem.tok[ifs[ifstck].tok].target = klp - base;
+          }
+          ifs[ifstck].state = 3;
+          ifs[ifstck].clean = true;
+          jump = true;
+        } else if (!strncmp(lp, "endif", 5) && ifstck && ifs[ifstck].state >= 2) {
+          if (pass && ifs[ifstck].clean && ifs[ifstck].tok != (uint32_t)-1) {
+            glob_script_mem.tok[ifs[ifstck].tok].target = klp - base;
+          }
+          ifstck--;
+          goto next_line;
+        }
+        SCRIPT_SKIP_SPACES
+
+        if (jump) {
+          ifs[ifstck].tok = (uint32_t)-1;
+          if ((*lp == SCRIPT_EOL || !*lp) && !nojump) {
+            // keyword alone on its line
+            ifs[ifstck].tok = count;
+            Script_AddTok(&count, klp, SCRIPT_TOK_JUMP);
+          }
+        }
+
+        // lines that change state even when not executed, a branch containing them is walked as before
+        bool walk = !strncmp(lp, "for", 3) || !strncmp(lp, "next", 4) || !strncmp(lp, "switch", 6) ||
+                    !strncmp(lp, "case", 4) || !strncmp(lp, "ends", 4);
+        for (char *cp = lp; *cp && *cp != SCRIPT_EOL; cp++) {
+          if (*cp == '{' || *cp == '}') {
+            walk = true;
+            break;
+          }
+        }
+        if (walk) {
+          for (uint32_t level = 1; level <= ifstck; level++) {
+            ifs[level].clean = false;
+          }
+        }
+      }
+
+      // numeric constants and names of the line
+      while (*lp && *lp != SCRIPT_EOL) {
+        char *slp = lp;
+        if (*lp == '"') {
+          lp++;
+          while (*lp && *lp != '"' && *lp != SCRIPT_EOL) {
+            if (*lp == '\\' && *(lp + 1) && *(lp + 1) != SCRIPT_EOL) lp++;
+            lp++;
+          }
+          if (*lp == '"') lp++;
+          continue;
+        }
+        if (lp > base && Script_IsNameChar(*(lp - 1))) {
+          lp++;
+          continue;
+        }
+        if (isdigit(*lp) || (*lp == '-' && isdigit(*(lp + 1))) || *lp == '.') {
+          TS_FLOAT fvar;
+          char *elp = Script_ParseNum(lp, &fvar);
+          if (elp > lp && (elp - lp) < 256) {
+            struct SCRIPT_TOK *tok = Script_AddTok(&count, lp, SCRIPT_TOK_NUM);
+            if (tok) {
+              tok->len = elp - lp;
+              tok->val = fvar;
+            }
+          }
+          // a negative number is also resolved without its sign
+          lp = (*lp == '-' || elp <= lp) ? lp + 1 : elp;
+          continue;
+        }
+        if (isalpha(*lp) || *lp == '_') {
+          int16_t vindex = Script_CompileVar(lp);
+          if (vindex >= -1) {
+            struct SCRIPT_TOK *tok = Script_AddTok(&count, lp, SCRIPT_TOK_VAR);
+            if (tok) {
+              tok->vindex = vindex;
+            }
+          }
+          while (Script_IsNameChar(*lp)) lp++;
+        }
+        if (lp == slp) lp++;
+      }
+
+next_line:
+      lp = strchr(lp, SCRIPT_EOL);
+      if (!lp) break;
+      lp++;
+    }
+
+    if (!pass) {
+      if (!count) return;
+      glob_script_mem.tok = (struct SCRIPT_TOK*)special_malloc(count * sizeof(struct SCRIPT_TOK));
+      if (!glob_script_mem.tok) return;
+    }
+  }
+  glob_script_mem.tok_count = count;
+}
+
+// returns the resolved token at lp, 0 if none
+struct SCRIPT_TOK *Script_FindTok(const char *lp, uint8_t type) {
+  if (!glob_script_mem.tok_count || lp < glob_script_mem.tok_base || lp >= glob_script_mem.tok_base + glob_script_mem.tok_size) return 0;
+  uint32_t ofs = lp - glob_script_mem.tok_base;
+  uint32_t index = glob_script_mem.tok_hint;
+  // tokens are mostly used in the order of the text
+  if (index >= glob_script_mem.tok_count || glob_script_mem.tok[index].ofs != ofs) {
+    uint32_t low = 0, high = glob_script_mem.tok_count;
+    while (low < high) {
+      uint32_t mid = (low + high) / 2;
+      if (glob_script_mem.tok[mid].ofs < ofs) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    if (low >= glob_script_mem.tok_count || glob_script_mem.tok[low].ofs != ofs) return 0;
+    index = low;
+  }
+  glob_script_mem.tok_hint = index + 1;
+  if (glob_script_mem.tok[index].type != type) return 0;
+  return &glob_script_mem.tok[index];
+}
+
+void Script_Compile(void) {
+  Script_FreeCompiled();
+
+  // variable slots, table at least twice the number of vars
+  uint16_t size = 8;
+  while (size < (glob_script_mem.numvars * 2)) {
+    size <<= 1;
+  }
+  glob_script_mem.var_slot = (uint16_t*)calloc(size, sizeof(uint16_t));
+  if (glob_script_mem.var_slot) {
+    glob_script_mem.var_slot_mask = size - 1;
+    for (uint16_t count = 0; count < glob_script_mem.numvars; count++) {
+      char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
+      uint8_t slen = strlen(cp);
+      uint16_t slot = Script_NameHash(cp, slen) & glob_script_mem.var_slot_mask;
+      while (glob_script_mem.var_slot[slot]) {
+        char *sp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[glob_script_mem.var_slot[slot] - 1];
+        if (!strcmp(sp, cp)) break;   // duplicate name, first definition wins as before
+        slot = (slot + 1) & glob_script_mem.var_slot_mask;
+      }
+      if (!glob_script_mem.var_slot[slot]) {
+        glob_script_mem.var_slot[slot] = count + 1;
+      }
+    }
+  }
+
+  Script_CompileTokens();
+
+  // section headers, walk lines exactly like Run_script_sub() does
+  char *base = glob_script_mem.scriptptr;
+  uint16_t count = 0;
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    char *lp = base;
+    count = 0;
+    while (1) {
+      SCRIPT_SKIP_SPACES
+      SCRIPT_SKIP_EOL
+      SCRIPT_SKIP_SPACES
+      if (!*lp) break;
+      if (*lp == '>' || *lp == '#') {
+        if (pass) {
+          glob_script_mem.sect_ofs[count] = lp - base;
+        }
+        count++;
+      }
+      if (*lp == SCRIPT_EOL) {
+        lp++;
+      } else {
+        lp = strchr(lp, SCRIPT_EOL);
+        if (!lp) break;
+        lp++;
+      }
+    }
+    if (!pass) {
+      if (!count) return;
+      glob_script_mem.sect_ofs = (uint32_t*)malloc(count * sizeof(uint32_t));
+      if (!glob_script_mem.sect_ofs) return;
+    }
+  }
+  glob_script_mem.sect_count = count;
+  glob_script_mem.sect_base = base;
+}
+
+// returns var index or -1, -2 when names were not compiled
+int16_t Script_FindVar(const char *name, uint8_t len) {
+  if (!glob_script_mem.var_slot) return -2;
+  uint16_t slot = Script_NameHash(name, len) & glob_script_mem.var_slot_mask;
+  while (glob_script_mem.var_slot[slot]) {
+    uint16_t count = glob_script_mem.var_slot[slot] - 1;
+    char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
+    if (!strncmp(cp, name, len) && !cp[len]) {
+      return count;
+    }
+    slot = (slot + 1) & glob_script_mem.var_slot_mask;
+  }
+  return -1;
+}
+
+// returns first line of the script matching a section or subroutine header, 0 if not compiled
+char *Script_FindSection(const char *type, uint8_t tlen) {
+  if (!glob_script_mem.sect_base || glob_script_mem.scriptptr != glob_script_mem.sect_base) return 0;
+  for (uint16_t count = 0; count < glob_script_mem.sect_count; count++) {
+    char *lp = glob_script_mem.sect_base + glob_script_mem.sect_ofs[count];
+    if (!strncmp(lp, type, tlen)) {
+      return lp;
+    }
+  }
+  // no such section, end of script
+  return glob_script_mem.sect_base + strlen(glob_script_mem.sect_base);
+}
+
 
 int32_t udp_call(char *url, uint32_t port, char *sbuf) {
   WiFiUDP udp;
@@ -2720,17 +3112,13 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, TS_FLOAT *fp, char *
     if (isdigit(*lp) || (*lp == '-' && isdigit(*(lp + 1))) || *lp == '.') {
       // isnumber
         if (fp) {
-          if (*lp == '0' && *(lp + 1) == 'x') {
-
-            lp += 2;
-            *fp = strtoll(lp, &lp, 16);
+          // constant in script text, converted by Script_Compile()
+          struct SCRIPT_TOK *tok = Script_FindTok(lp, SCRIPT_TOK_NUM);
+          if (tok) {
+            *fp = tok->val;
+            lp += tok->len;
           } else {
-            *fp = CharToFloat(lp);
-            if (*lp == '-') lp++;
-            while (isdigit(*lp) || *lp == '.') {
-              if (*lp == 0 || *lp == SCRIPT_EOL) break;
-              lp++;
-            }
+            lp = Script_ParseNum(lp, fp);
           }
         }
         tind->bits.constant = 1;
@@ -2796,7 +3184,20 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, TS_FLOAT *fp, char *
 
 
     glob_script_mem.arres = 0;
-    for (count = 0; count < glob_script_mem.numvars; count++) {
+    int16_t vindex;
+    struct SCRIPT_TOK *tok = Script_FindTok(lp, SCRIPT_TOK_VAR);
+    if (tok) {
+      vindex = tok->vindex;
+    } else {
+      vindex = Script_FindVar(dvnam, olen);
+    }
+    if (vindex == -1) {
+      // not a variable, skip name scan
+      vindex = glob_script_mem.numvars;
+    } else if (vindex < 0) {
+      vindex = 0;
+    }
+    for (count = vindex; count < glob_script_mem.numvars; count++) {
         char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
         uint8_t slen = strlen(cp);
         if (slen == olen && *cp == dvnam[0]) {
@@ -7416,8 +7817,6 @@ char *scripter_sub(char *lp, uint8_t fromscriptcmd) {
 
 int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv);
 
-#define IF_NEST 8
-
 int16_t Run_Scripter1(const char *type, int8_t tlen, const char *js) {
 int16_t retval;
   if (!glob_script_mem.scriptptr) {
@@ -7494,6 +7893,13 @@ int16_t Run_script_sub(const char *type, int8_t tlen, struct GVARS *gv) {
       check = 1;
     }
 
+    if (!section && tlen > 1 && (*type == '>' || *type == '#')) {
+      // jump to first matching header instead of scanning all lines
+      char *slp = Script_FindSection(type, tlen);
+      if (slp) {
+        lp = slp;
+      }
+    }
 
     while (1) {
         // check line
@@ -7545,10 +7951,26 @@ startline:
                 lp += 4;
                 if_state[ifstck] = 2;
                 if (if_exe[ifstck - 1]) if_exe[ifstck] = if_result[ifstck];
+                if (!if_exe[ifstck]) {
+                  // jump to else or endif
+                  struct SCRIPT_TOK *tok = Script_FindTok(lp - 4, SCRIPT_TOK_JUMP);
+                  if (tok && tok->target) {
+                    lp = glob_script_mem.tok_base + tok->target;
+                    goto startline;
+                  }
+                }
             } else if (!strncmp(lp, "else", 4) && if_state[ifstck] == 2) {
                 lp += 4;
                 if_state[ifstck] = 3;
                 if (if_exe[ifstck - 1]) if_exe[ifstck] = !if_result[ifstck];
+                if (!if_exe[ifstck]) {
+                  // jump to endif
+                  struct SCRIPT_TOK *tok = Script_FindTok(lp - 4, SCRIPT_TOK_JUMP);
+                  if (tok && tok->target) {
+                    lp = glob_script_mem.tok_base + tok->target;
+                    goto startline;
+                  }
+                }
             } else if (!strncmp(lp, "endif", 5) && if_state[ifstck] >= 2) {
                 lp += 5;
                 if (ifstck>0) {
@@ -9260,6 +9682,7 @@ void SaveScriptEnd(void) {
     free(glob_script_mem.script_mem);
     glob_script_mem.script_mem = 0;
     glob_script_mem.script_mem_size = 0;
+    Script_FreeCompiled();
  #ifdef USE_SCRIPT_SERIAL
     Script_Close_Serial();
 #endif
@@ -10219,10 +10642,8 @@ bool ScriptMqttData(void) {
         }
 #else
 
-        JsonParser parser((char*)sData.c_str());
-        JsonParserObject obj = parser.getRootObject();
         char sres[64];
-        uint32_t res = JsonParsePath(&obj, event_item.Key.c_str(), '.', NULL, sres, sizeof(sres));
+        uint32_t res = JsonParsePathStr(sData.c_str(), event_item.Key.c_str(), '.', NULL, sres, sizeof(sres));
         if (res) {
           json_valid = 1;
           value = sres;
@@ -43,6 +43,7 @@
 \*********************************************************************************************/
 
 #define XDRV_121              121
+#define XDRV_121_FUNC         (XFUNC_LOOP | XFUNC_EVERY_100_MSECOND)
 
 #define GV_USE_ESPINFO                     // Provide ESP info
 
@@ -31,6 +31,7 @@
 #warning **** USE_DRV_FILE_JSON_DEMO is enabled ****
 
 #define XDRV_122               122
+#define XDRV_122_FUNC          XFUNC_NONE
 
 #define DRV_DEMO_MAX_DRV_TEXT  16
 
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XDRV_127            127
+#define XDRV_127_FUNC       (XFUNC_LOOP)
 
 #ifndef CPU_LOAD_CHECK
 #define CPU_LOAD_CHECK      1                 // Seconds between each CPU_LOAD log
@@ -48,6 +49,7 @@
 #define D_CMND_CFGPOKE   "CfgPoke"
 #define D_CMND_SHOWHEAP  "ShowHeap"
 #define D_CMND_CFGXOR    "CfgXor"
+#define D_CMND_WEBSTATS  "WebStats"
 #define D_CMND_CPUCHECK  "CpuChk"
 #define D_CMND_EXCEPTION "Exception"
 #define D_CMND_FLASHDUMP "FlashDump"
@@ -70,7 +72,7 @@ const char kDebugCommands[] PROGMEM = "|"  // No prefix
 #endif
 #endif
 #ifdef USE_WEBSERVER
-  D_CMND_CFGXOR "|"
+  D_CMND_CFGXOR "|" D_CMND_WEBSTATS "|"
 #endif
   D_CMND_CPUCHECK "|" D_CMND_SERBUFF "|"
 #ifdef DEBUG_THEO
@@ -91,7 +93,7 @@ void (* const DebugCommand[])(void) PROGMEM = {
 #endif
 #endif
 #ifdef USE_WEBSERVER
-  &CmndCfgXor,
+  &CmndCfgXor, &CmndWebStats,
 #endif
   &CmndCpuCheck, &CmndSerBufSize,
 #ifdef DEBUG_THEO
@@ -572,6 +574,19 @@ void CmndCfgXor(void)
   snprintf_P(temp, sizeof(temp), PSTR("0x%02X"), config_xor_on_set);
   ResponseCmndChar(temp);
 }
+
+void CmndWebStats(void)
+{
+  // WebStats    - Show build time, size and peak heap used by the last web page
+  // WebStats 0  - Reset maximums
+  if (0 == XdrvMailbox.payload) {
+    Web.max_time = 0;
+    Web.max_heap_used = 0;
+  }
+  Response_P(PSTR("{\"%s\":{\"Uri\":\"%s\",\"Time\":%d,\"Bytes\":%d,\"Chunks\":%d,\"HeapUsed\":%d,\"MaxTime\":%d,\"MaxHeapUsed\":%d}}"),
+    XdrvMailbox.command, EscapeJSONString(Web.last_page.uri).c_str(), Web.last_page.time, Web.last_page.bytes, Web.last_page.chunks,
+    Web.last_page.heap_used, Web.max_time, Web.max_heap_used);
+}
 #endif  // USE_WEBSERVER
 
 #ifdef DEBUG_THEO
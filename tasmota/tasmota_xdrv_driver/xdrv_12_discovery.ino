@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XDRV_12     12
+#define XDRV_12_FUNC (XFUNC_EVERY_SECOND)
 
 void TasDiscoverMessage(void) {
   uint32_t ip_address = (uint32_t)WiFi.localIP();
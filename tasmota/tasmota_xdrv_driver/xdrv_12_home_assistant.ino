@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_12 12
+#define XDRV_12_FUNC (XFUNC_EVERY_SECOND)
 
 #ifndef HOME_ASSISTANT_DISCOVERY_PREFIX
 #define HOME_ASSISTANT_DISCOVERY_PREFIX   "homeassistant"  // Home Assistant discovery prefix
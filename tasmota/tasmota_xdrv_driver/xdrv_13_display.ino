@@ -20,6 +20,7 @@
 #ifdef USE_DISPLAY
 
 #define XDRV_13       13
+#define XDRV_13_FUNC  (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <renderer.h>
 
@@ -1411,21 +1412,10 @@ void draw_dt_vars(void) {
   }
 }
 
-#define DTV_JSON_SIZE 1024
-
 void DisplayDTVarsTeleperiod(void) {
   ResponseClear();
   MqttShowState();
-  uint32_t jlen = ResponseLength();
-
-  if (jlen < DTV_JSON_SIZE) {
-    char *json = (char*)malloc(jlen + 2);
-    if (json) {
-      strlcpy(json, ResponseData(), jlen + 1);
-      get_dt_vars(json);
-      free(json);
-    }
-  }
+  get_dt_vars(ResponseData());
 }
 
 void get_dt_mqtt(void) {
@@ -1443,29 +1433,43 @@ void get_dt_mqtt(void) {
   get_dt_vars(ResponseData());
 }
 
-void get_dt_vars(char *json) {
-  if (strlen(json)) {
-    JsonParser parser(json);
-    JsonParserObject obj = parser.getRootObject();
-
-    for (uint32_t cnt = 0; cnt < MAX_DT_VARS; cnt++) {
-      if (dt_vars[cnt]) {
-        if (dt_vars[cnt]->jstrbuf && dt_vars[cnt]->jstrbuf[0]!='[') {
-          char sbuf[32];
-          uint32_t res = JsonParsePath(&obj, dt_vars[cnt]->jstrbuf, '#', NULL, sbuf, sizeof(sbuf));
-          if (res) {
-            if (dt_vars[cnt]->dp < 0) {
-              // use string
-              strcpy(dt_vars[cnt]->rstr, sbuf);
-            } else {
-              // convert back and forth
-              dtostrfd(CharToFloat(sbuf), dt_vars[cnt]->dp, dt_vars[cnt]->rstr);
-            }
-          }
-        }
-      }
+typedef struct {
+  uint8_t pending;                   // number of DT variables not found yet
+  bool found[MAX_DT_VARS];
+} DT_VARS_STREAM;
+
+// called for each value of the json, fills every DT variable whose path matches
+void get_dt_vars_cb(void *ctx, JsonStreamParser &parser, JsonStreamEvent event) {
+  DT_VARS_STREAM *dts = (DT_VARS_STREAM*)ctx;
+  if (JSON_STREAM_VALUE != event) { return; }
+  for (uint32_t cnt = 0; cnt < MAX_DT_VARS; cnt++) {
+    if (dts->found[cnt] || !dt_vars[cnt] || !dt_vars[cnt]->jstrbuf || dt_vars[cnt]->jstrbuf[0] == '[') { continue; }
+    if (!JsonParsePathMatch(parser, dt_vars[cnt]->jstrbuf, '#')) { continue; }
+    if (dt_vars[cnt]->dp < 0) {
+      // use string
+      strlcpy(dt_vars[cnt]->rstr, parser.getStr(), sizeof(dt_vars[cnt]->rstr));
+    } else {
+      // convert back and forth
+      dtostrfd(CharToFloat(parser.getStr()), dt_vars[cnt]->dp, dt_vars[cnt]->rstr);
+    }
+    dts->found[cnt] = true;
+    dts->pending--;
+  }
+  if (!dts->pending) { parser.stop(); }
+}
+
+// json is streamed once in place for all DT variables, no copy and no size limit
+void get_dt_vars(const char *json) {
+  if (!strlen(json)) { return; }
+  DT_VARS_STREAM dts = {};
+  for (uint32_t cnt = 0; cnt < MAX_DT_VARS; cnt++) {
+    if (dt_vars[cnt] && dt_vars[cnt]->jstrbuf && dt_vars[cnt]->jstrbuf[0] != '[') {
+      dts.pending++;
     }
   }
+  if (!dts.pending) { return; }
+  JsonStreamParser parser(get_dt_vars_cb, &dts);
+  parser.feed(json);
 }
 
 void free_dt_vars(void) {
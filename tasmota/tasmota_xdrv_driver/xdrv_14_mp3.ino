@@ -105,6 +105,7 @@
 \*********************************************************************************************/
 
 #define XDRV_14             14
+#define XDRV_14_FUNC        (XFUNC_EVERY_SECOND)
 
 #include <TasmotaSerial.h>
 
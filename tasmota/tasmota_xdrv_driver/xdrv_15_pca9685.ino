@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XDRV_15                     15
+#define XDRV_15_FUNC                (XFUNC_EVERY_SECOND)
 #define XI2C_01                     1  // See I2CDEVICES.md
 
 #define PCA9685_REG_MODE1           0x00
@@ -75,6 +75,7 @@
 */
 
 #define XDRV_15 15
+#define XDRV_15_FUNC (XFUNC_EVERY_SECOND)
 #define XI2C_01 1 // See I2CDEVICES.md
 
 /*
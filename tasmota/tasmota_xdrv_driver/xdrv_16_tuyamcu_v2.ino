@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XDRV_16                16
+#define XDRV_16_FUNC           (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 #define XNRG_32                32   // Needs to be the last XNRG_xx
 
 #ifndef TUYA_DIMMER_ID
@@ -22,6 +22,7 @@
 \*********************************************************************************************/
 
 #define XDRV_17             17
+#define XDRV_17_FUNC        (XFUNC_EVERY_50_MSECOND)
 
 #define D_JSON_RF_PROTOCOL "Protocol"
 #define D_JSON_RF_BITS "Bits"
@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XDRV_18                18
+#define XDRV_18_FUNC           (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 #include <TasmotaSerial.h>
 
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XDRV_20           20
+#define XDRV_20_FUNC      XFUNC_NONE
 
 #include "UnishoxStrings.h"
 
@@ -484,6 +485,69 @@ uint16_t prev_ct  = 254;
 char     prev_x_str[24] = "\0"; // store previously set xy by Alexa app
 char     prev_y_str[24] = "\0";
 
+/*********************************************************************************************\
+ * Listing of all lights
+ *
+ * Alexa and Hue apps poll the list of all lights every few seconds. Instead of building it as
+ * a single String, each light is appended to a small buffer which is sent as a chunk when large
+ * enough. The list is first rendered without sending anything to compute its ETag, so that an
+ * unchanged list is answered with 304 Not Modified.
+ * The static part of each light (name, model, manufacturer, uniqueid) is rendered once and
+ * cached, keyed by a hash of its content; entries not used by a listing are released, and
+ * at most HUE_FRAGMENTS_SPARE entries outside of a listing are kept.
+\*********************************************************************************************/
+
+enum HueListModes { HUE_LIST_NONE, HUE_LIST_HASH, HUE_LIST_STREAM };
+
+const uint32_t HUE_HASH_INIT = 2166136261;    // FNV-1a offset basis
+const uint32_t HUE_FRAGMENTS_SPARE = 8;       // max fragments kept that are not part of a listing
+
+typedef struct HueFragment_t {
+  uint32_t key;                       // hash of the content
+  char *   json;                      // HUE_LIGHTS_STATUS_JSON2 rendered
+  bool     used;                      // used by the current listing
+} HueFragment_t;
+
+struct {
+  LList<HueFragment_t> fragments;
+  uint32_t etag = HUE_HASH_INIT;      // hash of the listing
+  uint8_t  mode = HUE_LIST_NONE;
+} HueList;
+
+// FNV-1a, including the terminating zero, works for strings in PROGMEM
+uint32_t HueHash(uint32_t hash, const char * s) {
+  if (s == nullptr) { s = PSTR(""); }
+  uint8_t c;
+  do {
+    c = pgm_read_byte(s++);
+    hash = (hash ^ c) * 16777619;
+  } while (c);
+  return hash;
+}
+
+// Called after each light is appended to `response` while listing all lights
+void HueListFlush(String * response, bool last) {
+  if (HUE_LIST_HASH == HueList.mode) {
+    HueList.etag = HueHash(HueList.etag, response->c_str());
+    *response = "";
+  } else if ((HUE_LIST_STREAM == HueList.mode) && (last || (response->length() >= CHUNKED_BUFFER_SIZE))) {
+    WSContentSend(response->c_str(), response->length());
+    *response = "";
+  }
+}
+
+// Release cached fragments that were not part of the last listing
+void HueListSweep(void) {
+  for (auto & frag : HueList.fragments) {
+    if (frag.used) {
+      frag.used = false;
+    } else {
+      free(frag.json);
+      HueList.fragments.remove(&frag);
+    }
+  }
+}
+
 #ifdef USE_LIGHT
 uint8_t getLocalLightSubtype(uint8_t device) {
   if (TasmotaGlobal.light_type) {
@@ -581,9 +645,9 @@ bool HueActive(uint8_t device) {
  * HueLightStatus2Generic
  * 
  * Adds specific information for a newly discovered device
- * Returns a (char*) pointer that the caller needs to `free()`
+ * Returns a pointer owned by the cache of fragments, valid until the next call; do not free()
 \*********************************************************************************/
-char* HueLightStatus2Generic(const char * name, const char * modelid, const char * manuf, const char * uniqueid) {
+const char* HueLightStatus2Generic(const char * name, const char * modelid, const char * manuf, const char * uniqueid) {
   // //=HUE_LIGHTS_STATUS_JSON2
   // ",\"type\":\"Extended color light\","
   // "\"name\":\"%s\","
@@ -591,8 +655,33 @@ char* HueLightStatus2Generic(const char * name, const char * modelid, const char
   // "\"manufacturername\":\"%s\","
   // "\"uniqueid\":\"%s\"}"
 
+  uint32_t key = HueHash(HueHash(HueHash(HueHash(HUE_HASH_INIT, name), modelid), manuf), uniqueid);
+  bool listing = (HUE_LIST_NONE != HueList.mode);   // single lights and Berry are not part of a listing
+  uint32_t spare = 0;
+  HueFragment_t * oldest = nullptr;
+  for (auto & frag : HueList.fragments) {
+    if (frag.key == key) {
+      frag.used |= listing;
+      return frag.json;
+    }
+    if (!frag.used) {
+      if (nullptr == oldest) { oldest = &frag; }
+      spare++;
+    }
+  }
+  // Bound the cache when no listing ever sweeps it
+  if ((spare >= HUE_FRAGMENTS_SPARE) && oldest) {
+    free(oldest->json);
+    HueList.fragments.remove(oldest);
+  }
+
   UnishoxStrings msg(HUE_LIGHTS);
   char * buf = ext_snprintf_malloc_P(msg[HUE_LIGHTS_STATUS_JSON2], EscapeJSONString(name).c_str(), EscapeJSONString(modelid).c_str(), EscapeJSONString(manuf).c_str(), uniqueid);
+  if (buf == nullptr) { return ""; }
+  HueFragment_t & frag = HueList.fragments.addToLast();
+  frag.key = key;
+  frag.json = buf;
+  frag.used = listing;
   return buf;
 }
 
@@ -615,9 +704,7 @@ void HueLightStatus2(uint8_t device, String *response)
     fname[fname_len] = 0x00;
   }
 
-  char* buf = HueLightStatus2Generic(fname, Settings->user_template_name, PSTR("Tasmota"), GetHueDeviceId(device).c_str());
-  *response += buf;
-  free(buf);
+  *response += HueLightStatus2Generic(fname, Settings->user_template_name, PSTR("Tasmota"), GetHueDeviceId(device).c_str());
 }
 #endif // USE_LIGHT
 
@@ -706,6 +793,8 @@ void HueGlobalConfig(String *path) {
   String response;
 
   path->remove(0,1);                                 // cut leading / to get <id>
+  WSContentBegin(200, CT_APP_JSON);
+  HueList.mode = HUE_LIST_STREAM;
   response = F("{\"lights\":{");
   bool appending = false;                             // do we need to add a comma to append
 #ifdef USE_LIGHT
@@ -717,7 +806,10 @@ void HueGlobalConfig(String *path) {
   response += F("},\"groups\":{},\"schedules\":{},\"config\":");
   HueConfigResponse(&response);
   response += F("}");
-  WSSend(200, CT_APP_JSON, response);
+  HueListFlush(&response, true);
+  HueList.mode = HUE_LIST_NONE;
+  HueListSweep();
+  WSContentEnd();
 }
 
 void HueAuthentication(String *path)
@@ -742,6 +834,7 @@ void CheckHue(String * response, bool &appending) {
       HueLightStatus1(i, response);
       HueLightStatus2(i, response);
       appending = true;
+      HueListFlush(response, false);
     }
   }
 }
@@ -952,6 +1045,58 @@ void HueLightsCommand(uint8_t device, uint32_t device_id, String &response) {
 }
 #endif // USE_LIGHT
 
+// Render the list of all lights, to be hashed or streamed depending on `HueList.mode`
+void HueLightsList(String * response) {
+  *response = F("{");
+  bool appending = false;
+#ifdef USE_LIGHT
+  CheckHue(response, appending);
+#endif // USE_LIGHT
+#ifdef USE_ZIGBEE
+  ZigbeeCheckHue(*response, &appending);
+#endif // USE_ZIGBEE
+#ifdef USE_BERRY
+  be_hue_discovery(response, &appending);
+  HueListFlush(response, false);
+#endif
+#ifdef USE_SCRIPT_HUE
+  Script_Check_Hue(response);
+#endif
+  *response += F("}");
+  HueListFlush(response, true);
+}
+
+// Answer to /lights, with ETag
+void HueLightsAll(void) {
+  String response;
+  HueList.mode = HUE_LIST_HASH;
+  HueList.etag = HUE_HASH_INIT;
+  HueLightsList(&response);
+
+  char etag[12];
+  snprintf_P(etag, sizeof(etag), PSTR("\"%08X\""), HueList.etag);
+  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_HTTP D_HUE " Result ETag %s"), etag);
+
+  Webserver->client().flush();
+  WSHeaderSend();
+  Webserver->sendHeader(F("ETag"), etag);
+  if (Webserver->header(F("If-None-Match")).equals(etag)) {
+    HueList.mode = HUE_LIST_NONE;
+    HueListSweep();
+    WSSend(304, CT_APP_JSON, "");
+    return;
+  }
+  Webserver->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  WSSend(200, CT_APP_JSON, "");                   // Signal start of chunked content
+  _WSContentInit();
+
+  HueList.mode = HUE_LIST_STREAM;
+  HueLightsList(&response);
+  HueList.mode = HUE_LIST_NONE;
+  HueListSweep();
+  WSContentEnd();
+}
+
 void HueLights(String *path_req)
 {
 /*
@@ -966,21 +1111,8 @@ void HueLights(String *path_req)
   String path(*path_req);
 
   if (path.endsWith(F("/lights"))) {                   // Got /lights
-    response = F("{");
-    bool appending = false;
-#ifdef USE_LIGHT
-    CheckHue(&response, appending);
-#endif // USE_LIGHT
-#ifdef USE_ZIGBEE
-    ZigbeeCheckHue(response, &appending);
-#endif // USE_ZIGBEE
-#ifdef USE_BERRY
-    be_hue_discovery(&response, &appending);
-#endif
-#ifdef USE_SCRIPT_HUE
-    Script_Check_Hue(&response);
-#endif
-    response += F("}");
+    HueLightsAll();                                   // streamed
+    return;
   }
   else if (path.endsWith(F("/state"))) {               // Got ID/state
     path.remove(0,8);                               // Remove /lights/
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_21           21
+#define XDRV_21_FUNC      XFUNC_NONE
 
 const char WEMO_MSEARCH[] PROGMEM =
   "HTTP/1.1 200 OK\r\n"
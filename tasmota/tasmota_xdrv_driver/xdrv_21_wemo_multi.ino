@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_21           21
+#define XDRV_21_FUNC      (XFUNC_LOOP)
 
 //#define USE_EMULATION_WEMO_DEBUG
 
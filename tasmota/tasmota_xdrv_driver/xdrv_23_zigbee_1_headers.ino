@@ -75,6 +75,7 @@ public:
   bool state_no_timeout = false;      // the current wait loop does not generate a timeout but only continues running
   bool init_phase = true;             // initialization phase, before accepting zigbee traffic
   bool recv_until = false;            // ignore all messages until the received frame fully matches
+  bool background = false;            // frames sent now are background traffic, i.e. from deferred timers
   bool eeprom_present = false;        // is the ZBBridge EEPROM present?
   bool eeprom_ready = false;          // is the ZBBridge EEPROM formatted and ready?
 #ifdef USE_ZIGBEE_ZNP
@@ -86,6 +87,17 @@ public:
   bool mapping_in_progress = false;   // is there a mapping in progress
   bool mapping_ready = false;         // do we have mapping information ready
   uint32_t mapping_end_time = 0;
+  // Device data journal
+  uint32_t journal_len = 0;           // size of the journal in bytes
+  uint32_t journal_check = 0;         // millis for the next scan of devices with pending data
+  uint32_t data_saved = 0;            // millis of the last full write of device data
+  uint32_t compact_generation = 0;    // zigbee_devices.generation() when the compaction started, restarted if it changes
+  uint16_t compact_index = 0;         // next device written by the compaction
+  uint8_t compact_step = 0;           // Z_COMPACT_IDLE, Z_COMPACT_DEVICES or Z_COMPACT_DATA
+  bool compact_publish = false;       // also publish each ZbData record while compacting
+  bool compact_ok = false;            // no write error so far, the journal is only emptied if true
+  bool journal_compact = false;       // journal is invalid, compact it into device data right away
+  bool journal_devices = false;       // journal contains device configuration records, compaction also writes the devices file
 
   uint8_t on_error_goto = ZIGBEE_LABEL_ABORT;         // on error goto label, 99 default to abort
   uint8_t on_timeout_goto = ZIGBEE_LABEL_ABORT;       // on timeout goto label, 99 default to abort
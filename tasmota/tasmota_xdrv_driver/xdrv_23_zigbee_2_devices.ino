@@ -23,6 +23,17 @@
 #define ZIGBEE_SAVE_DELAY_SECONDS 2               // wait for 2s before saving Zigbee info
 #endif
 const uint16_t kZigbeeSaveDelaySeconds = ZIGBEE_SAVE_DELAY_SECONDS;    // wait for x seconds
+#ifndef ZIGBEE_JOURNAL_DELAY_SECONDS
+#define ZIGBEE_JOURNAL_DELAY_SECONDS 10           // coalesce changes of device data during 10s before appending to journal
+#endif
+const uint16_t kZigbeeJournalDelaySeconds = ZIGBEE_JOURNAL_DELAY_SECONDS;
+#ifndef ZIGBEE_JOURNAL_MAX_DELAY_SECONDS
+#define ZIGBEE_JOURNAL_MAX_DELAY_SECONDS 20       // device data waits at most 20s more when the journal is over its budget
+#endif
+const uint16_t kZigbeeJournalMaxDelaySeconds = ZIGBEE_JOURNAL_MAX_DELAY_SECONDS;
+#ifndef ZIGBEE_JOURNAL_SIZE
+#define ZIGBEE_JOURNAL_SIZE 7680                  // compact the journal into ZbData when it exceeds 7.5KB, at most the 31 blocks of the EEPROM nano-fs
+#endif
 
 // Convert a multiplier or divisor initially on 2 bytes, to a single byte
 // We use a property that values are usually powers of 10 or 2/5/25/50...
@@ -951,6 +962,10 @@ public:
   // _defer_last_time : what was the last time an outgoing message is scheduled
   // this is designed for flow control and avoid messages to be lost or unanswered
   uint32_t              defer_last_message_sent;
+  // millis when pending changes of device data are appended to the journal, 0 if none
+  uint32_t              journal_timer;
+  // same for changes of the device configuration (names, endpoints, config), 0 if none
+  uint32_t              config_timer;
 
   uint8_t               endpoints[endpoints_max];   // static array to limit memory consumption, list of endpoints until 0x00 or end of array
   // List of names for endpoints
@@ -991,6 +1006,8 @@ public:
     modelId(nullptr),
     friendlyName(nullptr),
     defer_last_message_sent(0),
+    journal_timer(0),
+    config_timer(0),
     endpoints{ 0, 0, 0, 0, 0, 0, 0, 0 },
     attr_list(),
     shortaddr(_shortaddr),
@@ -1056,11 +1073,11 @@ public:
 
   inline void setLQI(uint8_t _lqi)            { lqi = _lqi; }
   // set battery percentage to new value - and mark timestamp only if time is valid
-  // trigger an immediate `ZbSave` since it's important information to keep
+  // journal it immediately since it's important information to keep
   void setBatteryPercent(uint8_t bp)   {
     if (batt_percent != bp) {
       batt_percent = bp;
-      Z_Set_Save_Data_Timer_Once(0);
+      dataDirty(true);
     }
     if (Rtc.utc_time >= START_VALID_TIME) {
       batt_last_seen = Rtc.utc_time;
@@ -1084,6 +1101,23 @@ public:
 
   void setLastSeenNow(void);
 
+  // Mark device data as changed, it is appended to the journal after `kZigbeeJournalDelaySeconds`
+  // Further changes during this period are coalesced in the same record, `now` skips the wait
+  void dataDirty(bool now = false) {
+    if (now || (0 == journal_timer)) {
+      journal_timer = millis() + (now ? 0 : kZigbeeJournalDelaySeconds * 1000);
+      if (0 == journal_timer) { journal_timer = 1; }    // 0 means no pending change
+    }
+  }
+
+  // Mark device configuration as changed, it is appended to the journal after `kZigbeeSaveDelaySeconds`
+  void configDirty(void) {
+    if (0 == config_timer) {
+      config_timer = millis() + kZigbeeSaveDelaySeconds * 1000;
+      if (0 == config_timer) { config_timer = 1; }      // 0 means no pending change
+    }
+  }
+
   // multiple function to dump part of the Device state into JSON
   void jsonAddDeviceNamme(Z_attribute_list & attr_list) const;
   void jsonAddEPName(Z_attribute_list & attr_list) const;
@@ -1169,9 +1203,103 @@ typedef struct Z_Deferred {
   uint8_t               endpoint;       // endpoint to use for timer
   uint8_t               category;       // which category of deferred is it
   uint32_t              value;          // any raw value to use for the timer
-  Z_DeviceTimer         func;           // function to call when timer occurs
+  Z_DeviceTimer         func;           // function to call when timer occurs, nullptr if cancelled
+  struct Z_Deferred *   next;           // next timer in the same wheel slot
+  struct Z_Deferred *   next_key;       // next timer in the same category bucket
 } Z_Deferred;
 
+/*********************************************************************************************\
+ * Timer wheel for deferred callbacks
+ *
+ * Timers are hashed by due time in slots of 64ms, each tick only visits the slots elapsed
+ * since last tick. Timers more than one turn away stay in their slot until they are due.
+ * Timers with a category are also hashed by (shortaddr, groupaddr, category) so that
+ * replacing them does not need to scan all timers.
+ * Cancelled timers are only marked and freed when their slot is visited, which makes it
+ * safe to set or cancel timers from within a running callback.
+\*********************************************************************************************/
+const uint32_t Z_WHEEL_TICK_BITS = 6;     // 64ms per slot
+const uint32_t Z_WHEEL_SLOTS = 32;        // a full turn of the wheel is ~2s
+const uint32_t Z_WHEEL_KEYS_BITS = 4;     // 16 buckets for timers with a category
+
+class Z_Deferred_Wheel {
+public:
+  Z_Deferred_Wheel() : _slots{}, _keys{}, _dispatch(nullptr), _tick_time(0) {};
+  ~Z_Deferred_Wheel();
+
+  void add(const Z_Deferred & deferred);
+  // cancel timers of a device, see `resetTimersForDevice()` for the meaning of arguments
+  void cancel(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint);
+  void run(void);
+
+protected:
+  static inline uint32_t slotIdx(uint32_t time_ms) { return (time_ms >> Z_WHEEL_TICK_BITS) & (Z_WHEEL_SLOTS - 1); }
+  static inline uint32_t keyIdx(uint16_t shortaddr, uint16_t groupaddr, uint8_t category) {
+    return ((((uint32_t)shortaddr << 16) | groupaddr) ^ category) * 0x9E3779B1 >> (32 - Z_WHEEL_KEYS_BITS);
+  }
+  static bool match(const Z_Deferred & defer, uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint);
+  void unlinkKey(Z_Deferred * defer);
+  void runSlot(uint32_t idx);
+
+  Z_Deferred *          _slots[Z_WHEEL_SLOTS];
+  Z_Deferred *          _keys[1 << Z_WHEEL_KEYS_BITS];
+  Z_Deferred *          _dispatch;      // remaining timers of the slot being visited, detached from the wheel
+  uint32_t              _tick_time;     // start of the last slot visited (ms)
+};
+
+/*********************************************************************************************\
+ * Device index
+ *
+ * Open addressing hash tables (linear probing) over the devices list, keyed by shortaddr,
+ * longaddr and case-folded friendly name or endpoint name.
+ * Entries are inserted in list order, so along a probe sequence the first matching entry
+ * is also the first in the list, i.e. the same result as a linear scan.
+ * The list remains the owner of devices and the iteration order, the index is rebuilt
+ * lazily after any change of keys.
+\*********************************************************************************************/
+typedef struct Z_Device_Name_Slot {
+  Z_Device *            device;         // nullptr if slot is empty
+  uint32_t              hash;           // case-folded hash of the name
+  uint16_t              pos;            // position in the devices list
+  uint8_t               ep;             // 0 for friendlyName, or endpoint of the endpoint name
+} Z_Device_Name_Slot;
+
+class Z_Device_Index {
+public:
+  Z_Device_Index() :
+    _short(nullptr), _long(nullptr), _names(nullptr),
+    _addr_bits(0), _names_bits(0), _valid(false)
+    {};
+  ~Z_Device_Index() { release(); }
+
+  inline bool valid(void) const { return _valid; }
+  inline void invalidate(void) { _valid = false; }
+
+  bool rebuild(const LList<Z_Device> & devices);    // returns false if memory allocation failed
+
+  Z_Device * findShortAddr(uint16_t shortaddr) const;
+  Z_Device * findLongAddr(uint64_t longaddr) const;
+  // returns the position in the list, or -1 if not found. If `ep` is not null, endpoint names are also matched
+  int32_t findName(const char * name, uint8_t * ep) const;
+
+  static uint32_t hashName(const char * name);
+
+protected:
+  void release(void);
+  static uint32_t tableBits(size_t count);
+  static inline uint32_t hashSlot(uint32_t key, uint32_t bits) { return (key * 0x9E3779B1) >> (32 - bits); }
+  static inline uint32_t hashLong(uint64_t key) { return (uint32_t)key ^ (uint32_t)(key >> 32); }
+  static const char * slotName(const Z_Device_Name_Slot & slot);
+  void insertName(Z_Device * device, uint16_t pos, uint8_t ep, const char * name);
+
+  Z_Device **           _short;         // table of devices by shortaddr
+  Z_Device **           _long;          // table of devices by longaddr
+  Z_Device_Name_Slot *  _names;         // table of friendly names and endpoint names
+  uint8_t               _addr_bits;     // size of _short and _long tables is 1 << _addr_bits
+  uint8_t               _names_bits;    // size of _names table is 1 << _names_bits
+  bool                  _valid;         // index is in sync with the list
+};
+
 /*********************************************************************************************\
  * Singleton for device configuration
 \*********************************************************************************************/
@@ -1257,6 +1385,7 @@ public:
 
   // Iterator
   inline const LList<Z_Device> & getDevices(void) const { return _devices; }
+  inline LList<Z_Device> & getDevices(void) { return _devices; }
   size_t devicesSize(void) const {
     return _devices.length();
   }
@@ -1266,8 +1395,15 @@ public:
   void clearDeviceRouterInfo(void);           // reset all router flags, done just before ZbMap
   bool removeDevice(uint16_t shortaddr);
 
+  // Keys of a device have changed (shortaddr, longaddr, friendly name or endpoint name)
+  inline void invalidateIndex(void) { _index.invalidate(); _generation++; }
+  // Incremented each time devices are added, removed or renamed
+  inline uint32_t generation(void) const { return _generation; }
+
   // Mark data as 'dirty' and requiring to save in Flash
   void dirty(void);
+  // Same for a single device, journaled alone if possible
+  void dirty(Z_Device & device);
   void clean(void);   // avoid writing to flash the last changes
 
   // Find device by name, can be short_addr, long_addr, number_in_array or name
@@ -1277,11 +1413,14 @@ public:
 
 private:
   LList<Z_Device>           _devices;     // list of devices
-  LList<Z_Deferred>         _deferred;    // list of deferred calls
+  Z_Deferred_Wheel          _deferred;    // deferred calls
+  mutable Z_Device_Index    _index;       // hash index over _devices, rebuilt lazily
+  uint32_t                  _generation = 0;
   uint32_t                  _saveTimer = 0;
   uint8_t                   _seqnumber = 0;     // global seqNumber if device is unknown
 
   //int32_t findShortAddrIdx(uint16_t shortaddr) const;
+  bool indexReady(void) const;        // rebuild the index if needed, false if not available
   // Create a new entry in the devices list - must be called if it is sure it does not already exist
   Z_Device & createDeviceEntry(uint16_t shortaddr, uint64_t longaddr = 0);
   void freeDeviceEntry(Z_Device *device);
@@ -32,6 +32,139 @@ Z_Device & Z_Devices::devicesAt(size_t i) const {
   }
 }
 
+/*********************************************************************************************\
+ * Device index
+\*********************************************************************************************/
+
+void Z_Device_Index::release(void) {
+  if (_short) { free(_short); _short = nullptr; }
+  if (_long)  { free(_long);  _long = nullptr; }
+  if (_names) { free(_names); _names = nullptr; }
+  _addr_bits = 0;
+  _names_bits = 0;
+  _valid = false;
+}
+
+// Number of bits for a table holding `count` entries with a load factor of at most 50%
+uint32_t Z_Device_Index::tableBits(size_t count) {
+  uint32_t bits = 3;          // minimum 8 slots
+  while (((size_t)1 << bits) < count * 2) { bits++; }
+  return bits;
+}
+
+// FNV-1a on lower-case characters, consistent with `strcasecmp()`
+uint32_t Z_Device_Index::hashName(const char * name) {
+  uint32_t hash = 2166136261;
+  for (const char * p = name; *p; p++) {
+    hash = (hash ^ (uint8_t)tolower(*p)) * 16777619;
+  }
+  return hash;
+}
+
+const char * Z_Device_Index::slotName(const Z_Device_Name_Slot & slot) {
+  if (0 == slot.ep) { return slot.device->friendlyName; }
+  return slot.device->ep_names.getEPName(slot.ep);
+}
+
+void Z_Device_Index::insertName(Z_Device * device, uint16_t pos, uint8_t ep, const char * name) {
+  if ((nullptr == name) || (0 == name[0])) { return; }
+  uint32_t mask = (1 << _names_bits) - 1;
+  uint32_t hash = hashName(name);
+  uint32_t i = hashSlot(hash, _names_bits);
+  while (_names[i].device) { i = (i + 1) & mask; }
+  _names[i].device = device;
+  _names[i].hash = hash;
+  _names[i].pos = pos;
+  _names[i].ep = ep;
+}
+
+bool Z_Device_Index::rebuild(const LList<Z_Device> & devices) {
+  size_t dev_count = 0;
+  size_t name_count = 0;
+  for (const auto & device : devices) {
+    dev_count++;
+    if (device.friendlyName) { name_count++; }
+    name_count += device.ep_names.length();
+  }
+
+  uint32_t addr_bits = tableBits(dev_count);
+  uint32_t names_bits = tableBits(name_count);
+  if ((addr_bits != _addr_bits) || (names_bits != _names_bits)) {
+    // size changed, reallocate all tables
+    release();
+    _short = (Z_Device**) malloc(sizeof(Z_Device*) << addr_bits);
+    _long = (Z_Device**) malloc(sizeof(Z_Device*) << addr_bits);
+    _names = (Z_Device_Name_Slot*) malloc(sizeof(Z_Device_Name_Slot) << names_bits);
+    if (!_short || !_long || !_names) {
+      release();
+      return false;
+    }
+    _addr_bits = addr_bits;
+    _names_bits = names_bits;
+  }
+  memset(_short, 0, sizeof(Z_Device*) << _addr_bits);
+  memset(_long, 0, sizeof(Z_Device*) << _addr_bits);
+  memset(_names, 0, sizeof(Z_Device_Name_Slot) << _names_bits);
+
+  uint32_t mask = (1 << _addr_bits) - 1;
+  uint16_t pos = 0;
+  for (auto & elem : devices) {
+    Z_Device * device = (Z_Device*) &elem;
+    uint32_t i = hashSlot(device->shortaddr, _addr_bits);
+    while (_short[i]) { i = (i + 1) & mask; }
+    _short[i] = device;
+    if (device->longaddr) {
+      i = hashSlot(hashLong(device->longaddr), _addr_bits);
+      while (_long[i]) { i = (i + 1) & mask; }
+      _long[i] = device;
+    }
+    insertName(device, pos, 0, device->friendlyName);
+    for (const auto & epn : device->ep_names) {
+      insertName(device, pos, epn.endpoint, epn.name);
+    }
+    pos++;
+  }
+  _valid = true;
+  return true;
+}
+
+Z_Device * Z_Device_Index::findShortAddr(uint16_t shortaddr) const {
+  uint32_t mask = (1 << _addr_bits) - 1;
+  for (uint32_t i = hashSlot(shortaddr, _addr_bits); _short[i]; i = (i + 1) & mask) {
+    if (_short[i]->shortaddr == shortaddr) { return _short[i]; }
+  }
+  return nullptr;
+}
+
+Z_Device * Z_Device_Index::findLongAddr(uint64_t longaddr) const {
+  uint32_t mask = (1 << _addr_bits) - 1;
+  for (uint32_t i = hashSlot(hashLong(longaddr), _addr_bits); _long[i]; i = (i + 1) & mask) {
+    if (_long[i]->longaddr == longaddr) { return _long[i]; }
+  }
+  return nullptr;
+}
+
+int32_t Z_Device_Index::findName(const char * name, uint8_t * ep) const {
+  uint32_t mask = (1 << _names_bits) - 1;
+  uint32_t hash = hashName(name);
+  for (uint32_t i = hashSlot(hash, _names_bits); _names[i].device; i = (i + 1) & mask) {
+    const Z_Device_Name_Slot & slot = _names[i];
+    if ((slot.hash != hash) || (slot.ep && !ep)) { continue; }
+    if (strcasecmp(slotName(slot), name) == 0) {
+      if (ep) { *ep = slot.ep; }
+      return slot.pos;
+    }
+  }
+  return -1;
+}
+
+// Make sure the index reflects the current list, returns false if the index could not be allocated
+// in which case the caller falls back to a linear scan
+bool Z_Devices::indexReady(void) const {
+  if (_index.valid()) { return true; }
+  return _index.rebuild(_devices);
+}
+
 //
 // Create a new Z_Device entry in _devices. Only to be called if you are sure that no
 // entry with same shortaddr or longaddr exists.
@@ -42,7 +175,8 @@ Z_Device & Z_Devices::createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
   device.shortaddr = shortaddr;
   device.longaddr = longaddr;
 
-  dirty();
+  invalidateIndex();
+  dirty(device);
   return device;
 }
 
@@ -62,12 +196,20 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
+  if (indexReady()) {
+    Z_Device * device = _index.findShortAddr(shortaddr);
+    return device ? *device : device_unk;
+  }
   for (auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
   return device_unk;
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if (indexReady()) {
+    const Z_Device * device = _index.findShortAddr(shortaddr);
+    return device ? *device : device_unk;
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
@@ -83,6 +225,10 @@ const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
   if (!longaddr) { return device_unk; }
+  if (indexReady()) {
+    Z_Device * device = _index.findLongAddr(longaddr);
+    return device ? *device : device_unk;
+  }
   for (auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
@@ -90,6 +236,10 @@ Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (indexReady()) {
+    const Z_Device * device = _index.findLongAddr(longaddr);
+    return device ? *device : device_unk;
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
@@ -108,6 +258,7 @@ int32_t Z_Devices::findFriendlyName(const char * name) const {
   size_t name_len = strlen(name);
   int32_t found = 0;
   if (name_len) {
+    if (indexReady()) { return _index.findName(name, nullptr); }
     for (auto &elem : _devices) {
       if (elem.friendlyName) {
         if (strcasecmp(elem.friendlyName, name) == 0) { return found; }
@@ -133,6 +284,12 @@ int32_t Z_Devices::findFriendlyNameOrEPName(const char * name, uint8_t * ep) con
   size_t name_len = strlen(name);
   int32_t found = 0;
   if (name_len) {
+    if (indexReady()) {
+      uint8_t ep_found = 0;
+      found = _index.findName(name, &ep_found);
+      if (ep) { *ep = ep_found; }
+      return found;
+    }
     for (auto &elem : _devices) {
       if (elem.friendlyName) {
         if (strcasecmp(elem.friendlyName, name) == 0) { return found; }
@@ -203,8 +360,11 @@ Z_Device & Z_Devices::getLongAddr(uint64_t longaddr) {
 bool Z_Devices::removeDevice(uint16_t shortaddr) {
   Z_Device & device = findShortAddr(shortaddr);
   if (foundDevice(device)) {
+    invalidateIndex();
     _devices.remove(&device);
-    dirty();
+    if (!journalDeviceRemoved(shortaddr)) {
+      dirty();
+    }
     return true;
   }
   return false;
@@ -225,21 +385,24 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
       // the device with longaddr got a new shortaddr
       l_found->shortaddr = shortaddr;      // update the shortaddr corresponding to the longaddr
       // erase the previous shortaddr
+      invalidateIndex();
       freeDeviceEntry(s_found);
       _devices.remove(s_found);
-      dirty();
+      dirty(*l_found);              // replaying its record merges the devices the same way
       return *l_found;
     }
   } else if (foundDevice(*s_found)) {
     // shortaddr already exists but longaddr not
     // add the longaddr to the entry
     s_found->longaddr = longaddr;
-    dirty();
+    invalidateIndex();
+    dirty(*s_found);
     return *s_found;
   } else if (foundDevice(*l_found)) {
     // longaddr entry exists, update shortaddr
     l_found->shortaddr = shortaddr;
-    dirty();
+    invalidateIndex();
+    dirty(*l_found);
     return *l_found;
   } else {
     // neither short/lonf addr are found.
@@ -316,6 +479,7 @@ bool Z_Device::setEPName(uint8_t ep, const char * name) {
   for (uint32_t i = 0; i < endpoints_max; i++) {
     if (ep == endpoints[i]) {
       ep_names.setEPName(ep, name);
+      zigbee_devices.invalidateIndex();
       return true;
     }
   }
@@ -342,7 +506,7 @@ void Z_Device::setStringAttribute(char*& attr, const char * str) {
     attr = (char*) malloc(str_len + 1);
     strlcpy(attr, str, str_len + 1);
   }
-  zigbee_devices.dirty();
+  zigbee_devices.dirty(*this);
 }
 
 //
@@ -364,10 +528,12 @@ void Z_Device::setModelId(const char * str) {
 
 void Z_Device::setFriendlyName(const char * str) {
   setStringAttribute(friendlyName, str);
+  zigbee_devices.invalidateIndex();
 }
 
 void Z_Device::setFriendlyEPName(uint8_t ep, const char * str) {
   ep_names.setEPName(ep, str);
+  zigbee_devices.invalidateIndex();
 }
 
 // needs to push the implementation here to use Z_Device static method
@@ -432,7 +598,7 @@ void Z_Device::setLightChannels(int8_t channels, uint8_t ep) {
     Z_Data_Light & light = data.get<Z_Data_Light>(ep);
     if (channels != light.getConfig()) {
       light.setConfig(channels);
-      zigbee_devices.dirty();
+      zigbee_devices.dirty(*this);
     }
     Z_Data_OnOff & onoff = data.get<Z_Data_OnOff>(ep);
     (void)onoff;
@@ -444,7 +610,7 @@ void Z_Device::setLightChannels(int8_t channels, uint8_t ep) {
         if (ep == 0 || data_elt.getEndpoint() == ep) {    // if remove ep==0 then remove all definitions
           // remove light object
           data.remove(&data_elt);
-          zigbee_devices.dirty();
+          zigbee_devices.dirty(*this);
         }
       }
     }
@@ -460,7 +626,7 @@ void Z_Devices::hideHueBulb(uint16_t shortaddr, bool hidden) {
   Z_Device &device = getShortAddr(shortaddr);
   if (device.hidden != hidden) {
     device.hidden = hidden;
-    dirty();
+    dirty(device);
   }
 }
 // true if device is not knwon or not a bulb - it wouldn't make sense to publish a non-bulb
@@ -472,25 +638,128 @@ bool Z_Devices::isHueBulbHidden(uint16_t shortaddr) const {
   return true;      // Fallback - Device is considered as hidden
 }
 
-// Deferred actions
-// Parse for a specific category, of all deferred for a device if category == 0xFF
-// Only with specific cluster number or for all clusters if cluster == 0xFFFF
-void Z_Devices::resetTimersForDevice(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
-  // iterate the list of deferred, and remove any linked to the shortaddr
-  for (auto & defer : _deferred) {
-    if ((defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr)) {
-      if ((0xFF == category) || (defer.category == category)) {
-        if ((0xFFFF == cluster) || (defer.cluster == cluster)) {
-          if ((0xFF == endpoint) || (defer.endpoint == endpoint)) {
-            _deferred.remove(&defer);
-          }
+/*********************************************************************************************\
+ * Timer wheel
+\*********************************************************************************************/
+
+Z_Deferred_Wheel::~Z_Deferred_Wheel() {
+  for (uint32_t i = 0; i < Z_WHEEL_SLOTS; i++) {
+    while (_slots[i]) {
+      Z_Deferred * next = _slots[i]->next;
+      delete _slots[i];
+      _slots[i] = next;
+    }
+  }
+}
+
+bool Z_Deferred_Wheel::match(const Z_Deferred & defer, uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
+  return (defer.shortaddr == shortaddr) && (defer.groupaddr == groupaddr) &&
+         ((0xFF == category) || (defer.category == category)) &&
+         ((0xFFFF == cluster) || (defer.cluster == cluster)) &&
+         ((0xFF == endpoint) || (defer.endpoint == endpoint));
+}
+
+void Z_Deferred_Wheel::add(const Z_Deferred & deferred) {
+  Z_Deferred * defer = new Z_Deferred(deferred);
+  // a timer already due goes in the current slot, it is visited again at next tick
+  uint32_t slot_time = TimeReached(defer->timer) ? millis() : defer->timer;
+  Z_Deferred ** slot = &_slots[slotIdx(slot_time)];
+  defer->next = *slot;
+  *slot = defer;
+  defer->next_key = nullptr;
+  if (defer->category >= Z_CLEAR_DEVICE) {
+    Z_Deferred ** key = &_keys[keyIdx(defer->shortaddr, defer->groupaddr, defer->category)];
+    defer->next_key = *key;
+    *key = defer;
+  }
+}
+
+void Z_Deferred_Wheel::unlinkKey(Z_Deferred * defer) {
+  if (defer->category < Z_CLEAR_DEVICE) { return; }
+  for (Z_Deferred ** prev = &_keys[keyIdx(defer->shortaddr, defer->groupaddr, defer->category)]; *prev; prev = &(*prev)->next_key) {
+    if (*prev == defer) {
+      *prev = defer->next_key;
+      return;
+    }
+  }
+}
+
+void Z_Deferred_Wheel::cancel(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
+  if ((category >= Z_CLEAR_DEVICE) && (0xFF != category)) {
+    // only look in the bucket of the category
+    Z_Deferred ** prev = &_keys[keyIdx(shortaddr, groupaddr, category)];
+    while (*prev) {
+      Z_Deferred * defer = *prev;
+      if (match(*defer, shortaddr, groupaddr, category, cluster, endpoint)) {
+        *prev = defer->next_key;
+        defer->func = nullptr;        // freed when its slot is visited
+      } else {
+        prev = &defer->next_key;
+      }
+    }
+  } else {
+    // timers without category are not indexed, visit them all
+    for (uint32_t i = 0; i <= Z_WHEEL_SLOTS; i++) {
+      for (Z_Deferred * defer = (i < Z_WHEEL_SLOTS) ? _slots[i] : _dispatch; defer; defer = defer->next) {
+        if (defer->func && match(*defer, shortaddr, groupaddr, category, cluster, endpoint)) {
+          unlinkKey(defer);
+          defer->func = nullptr;
         }
       }
     }
   }
 }
 
+// Visit a single slot, fire the timers that are due and keep the others for a next turn
+// Callbacks may add or cancel timers: the slot is detached while visited, and new timers
+// due now go in the slot of the current time which is visited last or at next tick
+void Z_Deferred_Wheel::runSlot(uint32_t idx) {
+  Z_Deferred *  kept = nullptr;
+  Z_Deferred ** kept_tail = &kept;
+  _dispatch = _slots[idx];
+  _slots[idx] = nullptr;
+  while (_dispatch) {
+    Z_Deferred * defer = _dispatch;
+    _dispatch = defer->next;
+    if (defer->func && !TimeReached(defer->timer)) {
+      *kept_tail = defer;
+      kept_tail = &defer->next;
+      continue;
+    }
+    if (defer->func) {
+      unlinkKey(defer);               // the callback may set a new timer in the same category
+      (*defer->func)(defer->shortaddr, defer->groupaddr, defer->cluster, defer->endpoint, defer->value);
+    }
+    delete defer;
+  }
+  *kept_tail = _slots[idx];           // timers added during the visit
+  _slots[idx] = kept;
+}
+
+void Z_Deferred_Wheel::run(void) {
+  const uint32_t tick = 1 << Z_WHEEL_TICK_BITS;
+  uint32_t now_tick = millis() & ~(tick - 1);
+  // if we are late by more than a full turn, visiting each slot once is enough
+  if (now_tick - _tick_time >= Z_WHEEL_SLOTS * tick) {
+    _tick_time = now_tick - (Z_WHEEL_SLOTS - 1) * tick;
+  }
+  // the last slot visited is visited again, it may contain timers due later in its tick
+  while (true) {
+    runSlot(slotIdx(_tick_time));
+    if (_tick_time == now_tick) { break; }
+    _tick_time += tick;
+  }
+}
+
+// Deferred actions
+// Parse for a specific category, of all deferred for a device if category == 0xFF
+// Only with specific cluster number or for all clusters if cluster == 0xFFFF
+void Z_Devices::resetTimersForDevice(uint16_t shortaddr, uint16_t groupaddr, uint8_t category, uint16_t cluster, uint8_t endpoint) {
+  _deferred.cancel(shortaddr, groupaddr, category, cluster, endpoint);
+}
+
 // Set timer for a specific device
+// Can be called from within a timer callback
 void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_ms, uint16_t cluster, uint8_t endpoint, uint8_t category, uint32_t value, Z_DeviceTimer func) {
   // First we remove any existing timer for same device in same category, except for category=0x00 (they need to happen anyway)
   if (category >= Z_CLEAR_DEVICE) {     // if category == 0, we leave all previous timers
@@ -498,8 +767,7 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
   }
 
   // Now create the new timer
-  Z_Deferred & deferred = _deferred.addHead();
-  deferred = { wait_ms + millis(),   // timer
+  Z_Deferred deferred = { wait_ms + millis(),   // timer
                           shortaddr,
                           groupaddr,
                           cluster,
@@ -507,6 +775,7 @@ void Z_Devices::setTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait_m
                           category,
                           value,
                           func };
+  _deferred.add(deferred);
 }
 
 // Set timer after the already queued events
@@ -525,22 +794,19 @@ void Z_Devices::queueTimer(uint16_t shortaddr, uint16_t groupaddr, uint32_t wait
 }
 
 // Run timer at each tick
-// WARNING: don't set a new timer within a running timer, this causes memory corruption
 void Z_Devices::runTimer(void) {
-  // visit all timers
-  for (auto & defer : _deferred) {
-    uint32_t timer = defer.timer;
-    if (TimeReached(timer)) {
-      (*defer.func)(defer.shortaddr, defer.groupaddr, defer.cluster, defer.endpoint, defer.value);
-      _deferred.remove(&defer);
-    }
-  }
+  zigbee.background = true;       // let user commands overtake frames sent by timers
+  _deferred.run();
+  zigbee.background = false;
 
   // check if we need to save to Flash
   if ((_saveTimer) && TimeReached(_saveTimer)) {
     saveZigbeeDevices();
     _saveTimer = 0;
   }
+
+  // append changed device data to the journal
+  journalDevicesData();
 }
 
 // does the new payload conflicts with the existing payload, i.e. values would be overwritten
@@ -705,8 +971,19 @@ void Z_Devices::jsonPublishNow(uint16_t shortaddr, Z_attribute_list &attr_list)
 void Z_Devices::dirty(void) {
   _saveTimer = kZigbeeSaveDelaySeconds * 1000 + millis();
 }
+// With a journal only the record of the device is appended, otherwise all devices are saved
+void Z_Devices::dirty(Z_Device & device) {
+  if (journalAvailable()) {
+    device.configDirty();
+  } else {
+    dirty();
+  }
+}
 void Z_Devices::clean(void) {
   _saveTimer = 0;
+  for (auto & device : _devices) {
+    device.config_timer = 0;
+  }
 }
 
 // Parse the command parameters for either:
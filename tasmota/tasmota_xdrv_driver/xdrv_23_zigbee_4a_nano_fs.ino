@@ -26,6 +26,7 @@
 const static uint32_t ZIGB_NAME2 = 0x3267697A; // 'zig2' little endian, v2
 const static uint32_t ZIGB_NAME4 = 0x3467697A; // 'zig4' little endian, v2
 const static uint32_t ZIGB_DATA2 = 0x32746164; // 'dat2' little endian, v2
+const static uint32_t ZIGB_JRNL2 = 0x326E726A; // 'jrn2' little endian, journal of 'dat2'
 extern FS *dfsp;
 extern "C" uint32_t _FS_end;
 // Is it ok to write to bank 0x402FF000
@@ -98,13 +99,17 @@ void hydrateSingleDevice(const SBuffer & buf_d, uint32_t version);
 // Version 0:
 // Many features are not yet implemented.
 // We start with hardcoded values:
-//  - the two entries for files 'zig2' and 'dat2' are predefined
+//  - the three entries for files 'zig2', 'dat2' and 'jrn2' are predefined
 //  - the starting block for each file is fixed.
-//    'Zig2' uses 32 blocks (8kb max) - starting at block 32
-//    'Dat2' uses 32 blocks (8kb max) - starting at block 64
+//    'Zig2' uses 31 blocks (8kb max) - starting at block 2
+//    'Dat2' uses 31 blocks (8kb max) - starting at block 33
+//    'Jrn2' uses 31 blocks (8kb max) - starting at block 64, added to existing EEPROMs at boot
 //  - the bitmap marks those blocks as used
 //  - version number only uses first entry that doesn't get re-written
 //  - only file size actually changes
+//  - 'Jrn2' is a file of records, its size in the directory is not used: records are prefixed
+//    by their length and the last one is followed by a zero byte, so that appending a record
+//    does not rewrite the directory block
 
 /*********************************************************************************************\
  *
@@ -218,6 +223,10 @@ void ZFS_Dir_Block::format(void) {
   e[1].name = ZIGB_DATA2;
   e[1].length = 0;
   e[1].blk_start = 2 + 31;        // start at block 33 to 63
+  // entry 2 - 'jrn2'
+  e[2].name = ZIGB_JRNL2;
+  e[2].length = 0;
+  e[2].blk_start = 2 + 31*2;      // start at block 64 to 94
 }
 
 void ZFS_Bitmap::format(void) {
@@ -229,8 +238,8 @@ void ZFS_Bitmap::format(void) {
   // block[0x00] = val_used;    // already in loop
   // block[0x01] = val_used;
   block[0xFF] = val_used;
-  // reserve block 32->63 for file 0 and 64->95 for file 1
-  for (uint32_t i = 0; i < 64; i++) {
+  // reserve block 2->32 for file 0, 33->63 for file 1 and 64->94 for file 2
+  for (uint32_t i = 0; i < 2 + ZFS_FILE_BLOCKS*3; i++) {
     block[i] = val_used;
   }
 }
@@ -292,6 +301,11 @@ public:
 
   // read file
   static int32_t readBytes(uint32_t name, void* buffer, size_t buffer_len, uint16_t start, uint16_t len);
+
+  // file of records ending with a zero byte
+  static int32_t readRecords(uint32_t name, void* buffer, size_t buffer_len, uint16_t start);
+  static bool appendRecord(uint32_t name, uint16_t offset, const uint8_t* buffer, size_t len);
+  static void clearRecords(uint32_t name);
 };
 
 /*********************************************************************************************\
@@ -366,6 +380,50 @@ int32_t ZFS::readBytes(uint32_t name, void* buffer, size_t buffer_len, uint16_t
   return read_len;
 }
 
+/*********************************************************************************************\
+ *
+ * File of records
+ *
+\*********************************************************************************************/
+// Read without checking the length in the directory, the caller stops at the zero byte
+int32_t ZFS::readRecords(uint32_t name, void* buffer, size_t buffer_len, uint16_t read_start) {
+  if (!zigbee.eeprom_ready) { return -1; }
+  ZFS_File_Entry entry;
+  if (!findFileEntry(name, entry, nullptr)) { return -1; }   // file not found
+
+  const uint16_t max_len = ZFS_FILE_BLOCKS * ZFS_BLOCK_SIZE;
+  if (read_start >= max_len) { return 0; }
+  if (buffer_len > max_len - read_start) { buffer_len = max_len - read_start; }
+  zigbee.eeprom.readBytes((entry.blk_start << 8) + read_start, buffer_len, (byte*) buffer);
+  return buffer_len;
+}
+
+// Write the record at `offset`, `buffer[0]` being its length
+// The new end marker is written first and the length byte last, so that a power loss
+// in between leaves the previous end marker in place
+bool ZFS::appendRecord(uint32_t name, uint16_t offset, const uint8_t* buffer, size_t len) {
+  if (!zigbee.eeprom_ready) { return false; }
+  if ((buffer == nullptr) || (len < 2)) { return false; }
+  if (offset + len + 1 > ZFS_FILE_BLOCKS * ZFS_BLOCK_SIZE) { return false; }   // exceeded max size
+  ZFS_File_Entry entry;
+  if (!findFileEntry(name, entry, nullptr)) { return false; }   // file not found
+
+  uint16_t address = (entry.blk_start << 8) + offset;
+  uint8_t zero = 0;
+  zigbee.eeprom.writeBytes(address + 1, len - 1, (byte*) buffer + 1);
+  zigbee.eeprom.writeBytes(address + len, 1, &zero);
+  zigbee.eeprom.writeBytes(address, 1, (byte*) buffer);
+  return true;
+}
+
+void ZFS::clearRecords(uint32_t name) {
+  if (!zigbee.eeprom_ready) { return; }
+  ZFS_File_Entry entry;
+  if (!findFileEntry(name, entry, nullptr)) { return; }   // file not found
+  uint8_t zero = 0;
+  zigbee.eeprom.writeBytes(entry.blk_start << 8, 1, &zero);
+}
+
 /*********************************************************************************************\
  *
  * Check that the EEPROM is formatted
@@ -399,6 +457,15 @@ void ZFS::initOrFormat(void) {
   if (dir->b0.signature == ZFS_SIGNATURE) {
     // Good
     AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "EEPROM signature 0x%08X is correct"), dir->b0.signature);
+    // EEPROM formatted before the journal existed, its blocks were never used so just add the entry
+    if (0 == dir->e[2].name) {
+      dir->e[2].name = ZIGB_JRNL2;
+      dir->e[2].length = 0;
+      dir->e[2].blk_start = 2 + 31*2;
+      dir->e[2].write(2);
+      uint8_t zero = 0;
+      zigbee.eeprom.writeBytes(dir->e[2].blk_start << 8, 1, &zero);    // empty, end marker at its start
+    }
   } else {
     AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "EEPROM signature 0x%08X is incorrect, formatting"), dir->b0.signature);
     format();
@@ -430,6 +497,9 @@ void ZFS::format(void) {
   ZFS_Dir_Block * dir = new ZFS_Dir_Block();
   dir->format();
   zigbee.eeprom.writeBytes(0x0000, 256, (byte*) dir);
+  // empty 'jrn2', end marker at its start
+  uint8_t zero = 0;
+  zigbee.eeprom.writeBytes(dir->e[2].blk_start << 8, 1, &zero);
   delete dir;
 }
 
@@ -442,6 +512,11 @@ void ZFS_File_Entry::read(uint8_t entry_idx) {
   zigbee.eeprom.readBytes(getAddress(entry_idx), sizeof(ZFS_File_Entry), (byte*)this);
 }
 
+void ZFS_File_Entry::write(uint8_t entry_idx) const {
+  if (!zigbee.eeprom_present) { return; }
+  zigbee.eeprom.writeBytes(getAddress(entry_idx), sizeof(ZFS_File_Entry), (byte*)this);
+}
+
 void ZFS_Write_File::findOrCreate(void) {
   ZFS_File_Entry entry;
 
@@ -501,11 +576,13 @@ public:
   // uint16_t  length;
   // uint8_t   blk_start;      // if 0x00 then file does not exist
   uint8_t   entry_idx;      // entry number in the directory
+  bool      records = false;  // file of records ending with a zero byte, length is the max size
 
-  void init(uint32_t _name) {
+  void init(uint32_t _name, bool _records = false) {
     eeprom_name = _name;
+    records = _records;
     if (ZFS::findFileEntry(eeprom_name, entry, &entry_idx)) {
-      len = ZFS::getLength(eeprom_name);
+      len = records ? ZFS_FILE_BLOCKS * ZFS_BLOCK_SIZE : ZFS::getLength(eeprom_name);
       is_valid = (len > 0);
     }
   }
@@ -559,7 +636,7 @@ int32_t Univ_Read_File::readBytes(uint8_t* buf, size_t btr) {
 #endif // USE_UFILESYS
 #ifdef USE_ZIGBEE_EEPROM
   if (eeprom_name != 0) {
-    int32_t bytes_read = ZFS::readBytes(eeprom_name, buf, btr, cursor, btr);
+    int32_t bytes_read = records ? ZFS::readRecords(eeprom_name, buf, btr, cursor) : ZFS::readBytes(eeprom_name, buf, btr, cursor, btr);
     if (bytes_read < 0) { return -1; }
     cursor += bytes_read;
     return bytes_read;
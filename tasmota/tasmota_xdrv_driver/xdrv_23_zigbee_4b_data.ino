@@ -36,6 +36,32 @@
 // uint8  - length of structure
 // uint8[] - list of data
 //
+// =======================
+// ZbData journal
+// Same records as above, appended each time the data of a single device changes.
+// Changes of the device configuration (names, endpoints...) are journaled too, in records
+// where the short address is replaced by a tag:
+// uint8  - length of record (excluding the length byte)
+// uint16 - 0xFFFE, followed by the device record of the devices file v4 without its length
+// uint16 - 0xFFFD, followed by the uint16 short address of a device that was removed
+//
+// At boot the journal is replayed after the devices file and ZbData, in order, so the last record of a device wins.
+// When the journal is full, the devices file (if needed) and ZbData are rewritten one device per tick,
+// then the journal is emptied. Appends are suspended meanwhile, changed devices stay pending.
+// On EEPROM the last record is followed by a zero byte, see 'jrn2' in the nano-fs.
+//
+// Device configuration is appended `kZigbeeSaveDelaySeconds` after the change.
+// Device data is appended `kZigbeeJournalDelaySeconds` after the change, and paced by a budget so that
+// the journal does not fill up in less than Z_SAVE_DATA_TIMER. Devices reporting more often than
+// the budget are coalesced in fewer records, but no change waits more than `kZigbeeJournalMaxDelaySeconds`
+// over its delay.
+//
+
+const uint32_t Z_SAVE_DATA_TIMER = 60 * 60 * 1000;       // save data every 60 minutes (in ms)
+const uint16_t Z_JOURNAL_DEVICE  = 0xFFFE;               // journal record of a device configuration
+const uint16_t Z_JOURNAL_REMOVED = 0xFFFD;               // journal record of a removed device
+
+enum Z_Compact_Step { Z_COMPACT_IDLE, Z_COMPACT_DEVICES, Z_COMPACT_DATA };
 
 // returns the lenght of consumed buffer, or -1 if error
 int32_t hydrateDeviceWideData(class Z_Device & device, const SBuffer & buf, size_t start, size_t len) {
@@ -88,6 +114,16 @@ int32_t hydrateSingleDeviceData(const SBuffer & buf) {
   }
   // read shortaddr
   uint16_t shortaddr = buf.get16(0);
+  if (Z_JOURNAL_DEVICE == shortaddr) {
+    hydrateSingleDevice(buf.subBuffer(2, segment_len - 2), 4);
+    zigbee.journal_devices = true;
+    return segment_len;
+  }
+  if (Z_JOURNAL_REMOVED == shortaddr) {
+    zigbee_devices.removeDevice(buf.get16(2));
+    zigbee.journal_devices = true;
+    return segment_len;
+  }
   if (shortaddr >= 0xFFF0) {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "invalid shortaddr=0x%04X"), shortaddr);
     return -1;
@@ -111,7 +147,8 @@ int32_t hydrateSingleDeviceData(const SBuffer & buf) {
   return segment_len;
 }
 
-SBuffer hibernateDeviceData(const struct Z_Device & device) {
+// publish - send the record as `ZbData` over MQTT
+SBuffer hibernateDeviceData(const struct Z_Device & device, bool publish) {
   SBuffer buf(192);
 
   // If we have zero information about the device, just skip ir
@@ -142,7 +179,7 @@ SBuffer hibernateDeviceData(const struct Z_Device & device) {
     // update overall length
     buf.set8(0, buf.len() - 1);
 
-    {
+    if (publish) {
       // skip first 3 bytes
       size_t buf_len = buf.len() - 3;
       Response_P(PSTR("{\"" D_PRFX_ZB D_CMND_ZIGBEE_DATA "\":\"ZbData 0x%04X,%*_H\"}"), device.shortaddr, buf_len, buf.buf(3));
@@ -181,46 +218,83 @@ bool hydrateDevicesData(void) {
   }
 #endif // USE_UFILESYS
 
+  bool ok = false;
   if (!f.valid() || f.len <= 0) {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "No Zigbee device data"));
-    return false;
-  }
-
-  uint32_t file_len = f.len;
-
-  if (file_len > 0) {
-    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee device data in %s (%d bytes)"), storage_class, file_len);
   } else {
-    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "No Zigbee device data in %s"), storage_class);
-    f.close();
-    return false;
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee device data in %s (%d bytes)"), storage_class, f.len);
+    ok = (hydrateDevicesRecords(f) >= 0);
+    if (!ok) {
+      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Invalid device data information, aborting"));
+    }
   }
+  f.close();
+
+  hydrateDevicesJournal();
+  return ok;
+}
 
+// Read consecutive device records until the end of file
+// Returns the number of bytes of valid records, or -1 if a record is truncated or invalid
+int32_t hydrateDevicesRecords(class Univ_Read_File & f) {
+  int32_t records_len = 0;
   while (1) {
     uint8_t dev_record_len = 0;
     int32_t ret = f.readBytes(&dev_record_len, sizeof(dev_record_len));
-    if (ret <= 0) {
-      break;    // finished
+    if ((ret <= 0) || (0 == dev_record_len)) {
+      break;    // finished, or end marker of a file of records
     }
 
     SBuffer buf(dev_record_len);
     buf.setLen(dev_record_len);
-    
+
     ret = f.readBytes(buf.getBuffer(), dev_record_len);
-    if (ret != dev_record_len) {
-      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Invalid device data information, aborting"));
-      f.close();
-      return false;
-    }
+    if (ret != dev_record_len) { return -1; }
     int32_t segment_len = hydrateSingleDeviceData(buf);
-    if (segment_len <= 0) {
-      AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Invalid device data information, aborting"));
-      f.close();
-      return false;
+    if (segment_len <= 0) { return -1; }
+    records_len += dev_record_len + 1;
+  }
+  return records_len;
+}
+
+// Replay the journal on top of the data just loaded
+void hydrateDevicesJournal(void) {
+  Univ_Read_File f;   // universal reader
+#ifdef USE_ZIGBEE_EEPROM
+  if (zigbee.eeprom_ready) {
+    f.init(ZIGB_JRNL2, true);
+  }
+#endif // USE_ZIGBEE_EEPROM
+
+#ifdef USE_UFILESYS
+  File file;
+  if (!f.valid() && dfsp) {
+    file = dfsp->open(TASM_FILE_ZIGBEE_JOURNAL, "r");
+    if (file) {
+      f.init(&file);
     }
   }
+#endif // USE_UFILESYS
+
+  zigbee.journal_len = 0;
+  zigbee.journal_compact = false;
+  zigbee.journal_devices = false;
+  zigbee.data_saved = millis();
+  if (!f.valid() || f.len <= 0) { return; }
+
+  int32_t records_len = hydrateDevicesRecords(f);
+  if (records_len < 0) {
+    // probably a record cut by a power loss, force a compaction at next change
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbData journal truncated, keeping valid records"));
+    zigbee.journal_compact = true;
+  } else {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbData journal replayed (%d bytes)"), records_len);
+    zigbee.journal_len = records_len;
+    // pace the next appends as if the journal had been filled at the budgeted rate
+    zigbee.data_saved -= (uint64_t)Z_SAVE_DATA_TIMER * records_len / ZIGBEE_JOURNAL_SIZE;
+  }
   f.close();
-  return true;
+  zigbee_devices.clean();   // don't journal again what we just replayed
 }
 
 /*********************************************************************************************\
@@ -228,9 +302,13 @@ bool hydrateDevicesData(void) {
  * Hibernate data to the EEPROM
  *
 \*********************************************************************************************/
-void hibernateAllData(void) {
-  if (Rtc.utc_time < START_VALID_TIME) { return; }
-  if (zigbee_devices.devicesSize() == 0) { return; }    // safe-guard, if data is empty, don't save anything
+// Write the data of all devices and empty the journal
+// publish - also send each record as `ZbData` over MQTT
+// return true if data was written
+bool hibernateAllData(bool publish) {
+  if (Rtc.utc_time < START_VALID_TIME) { return false; }
+  if (zigbee_devices.devicesSize() == 0) { return false; }    // safe-guard, if data is empty, don't save anything
+  compactDevicesAbort();
   Univ_Write_File f;
   const char * storage_class = PSTR("");
 
@@ -252,25 +330,306 @@ void hibernateAllData(void) {
   }
 #endif
 
-  if (f.valid()) {
-    for (const auto & device : zigbee_devices.getDevices()) {
-      // allocte a buffer for a single device
-      SBuffer buf = hibernateDeviceData(device);
-      if (buf.len() > 0) {
-        f.writeBytes(buf.getBuffer(), buf.len());
+  if (!f.valid()) { return false; }
+
+  // also on error, so that a failing storage is not rewritten at each change
+  zigbee.data_saved = millis();
+  zigbee.journal_compact = false;
+  bool written = true;
+  bool devices_saved = zigbee.journal_devices;
+  if (devices_saved) {
+    written = saveZigbeeDevices();        // configuration records are dropped with the journal
+  }
+  for (auto & device : zigbee_devices.getDevices()) {
+    // allocte a buffer for a single device
+    SBuffer buf = hibernateDeviceData(device, publish);
+    if (buf.len() > 0) {
+      if (f.writeBytes(buf.getBuffer(), buf.len()) != buf.len()) { written = false; }
+    }
+    device.journal_timer = 0;       // pending changes are now saved
+    if (devices_saved) { device.config_timer = 0; }
+  }
+  size_t buf_len = f.getCursor();
+  f.close();
+
+  AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbData - %d bytes written to %s"), buf_len, storage_class);
+
+  // Only empty the journal once all data is safe, a power loss in between
+  // replays records that were just written, which does no harm
+  if (written) {
+    truncateDevicesJournal();
+  }
+  return written;
+}
+
+/*********************************************************************************************\
+ * Compaction of the journal, one device per call
+\*********************************************************************************************/
+Univ_Write_File z_compact_file;
+#ifdef USE_UFILESYS
+File z_compact_fs_file;
+#endif // USE_UFILESYS
+
+// Open the file written by the current compaction step, EEPROM first as in saveZigbeeDevices()
+bool compactDevicesOpen(void) {
+  bool devices = (Z_COMPACT_DEVICES == zigbee.compact_step);
+  z_compact_file = Univ_Write_File();
+#ifdef USE_ZIGBEE_EEPROM
+  if (zigbee.eeprom_ready) {
+    z_compact_file.init(devices ? ZIGB_NAME4 : ZIGB_DATA2);
+  }
+#endif // USE_ZIGBEE_EEPROM
+#ifdef USE_UFILESYS
+  if (!z_compact_file.valid() && dfsp) {
+    z_compact_fs_file = dfsp->open(devices ? TASM_FILE_ZIGBEE : TASM_FILE_ZIGBEE_DATA, "w");
+    if (z_compact_fs_file) {
+      z_compact_file.init(&z_compact_fs_file);
+    }
+  }
+#endif // USE_UFILESYS
+  if (!z_compact_file.valid()) { return false; }
+  if (devices) {
+    size_t devices_size = zigbee_devices.devicesSize();
+    uint8_t devices_size8 = (devices_size > 250) ? 250 : devices_size;    // same limit as hibernateDevices()
+    z_compact_file.writeBytes(&devices_size8, sizeof(devices_size8));
+  }
+  return true;
+}
+
+void compactDevicesAbort(void) {
+  if (Z_COMPACT_IDLE == zigbee.compact_step) { return; }
+  if (zigbee.compact_index > 0) {
+    z_compact_file.close();
+  }
+  zigbee.compact_step = Z_COMPACT_IDLE;
+}
+
+// Start rewriting the devices file (if the journal holds configuration records) and ZbData
+// publish - also send each record as `ZbData` over MQTT
+// return false if it can not start now
+bool compactDevicesStart(bool publish) {
+  if (Rtc.utc_time < START_VALID_TIME) { return false; }         // same as hibernateAllData()
+  if (zigbee_devices.devicesSize() == 0) { return false; }
+  compactDevicesAbort();
+  zigbee.compact_step = zigbee.journal_devices ? Z_COMPACT_DEVICES : Z_COMPACT_DATA;
+  zigbee.compact_index = 0;
+  zigbee.compact_generation = zigbee_devices.generation();
+  zigbee.compact_publish = publish;
+  zigbee.compact_ok = true;
+  zigbee.data_saved = millis();      // also on error, so that a failing storage is not rewritten at each change
+  return true;
+}
+
+// Write the record of a single device, or finish the current step
+void compactDevicesStep(void) {
+  if (zigbee.compact_generation != zigbee_devices.generation()) {
+    // devices were added, removed or renamed, the device count and positions are stale
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "ZbData compaction restarted"));
+    compactDevicesStart(zigbee.compact_publish);
+    return;
+  }
+  bool devices = (Z_COMPACT_DEVICES == zigbee.compact_step);
+  if (0 == zigbee.compact_index) {
+    if (!compactDevicesOpen()) {
+      zigbee.compact_step = Z_COMPACT_IDLE;
+      return;
+    }
+  }
+  size_t devices_size = zigbee_devices.devicesSize();
+  if (devices && (devices_size > 250)) { devices_size = 250; }
+  if (zigbee.compact_index < devices_size) {
+    Z_Device & device = zigbee_devices.devicesAt(zigbee.compact_index++);
+    SBuffer buf = devices ? hibernateDevice(device) : hibernateDeviceData(device, zigbee.compact_publish);
+    if (buf.len() > 0) {
+      if (z_compact_file.writeBytes(buf.getBuffer(), buf.len()) != buf.len()) { zigbee.compact_ok = false; }
+    }
+    if (devices) {
+      device.config_timer = 0;      // changes from now on are journaled after the compaction
+    } else {
+      device.journal_timer = 0;
+    }
+    return;
+  }
+
+  size_t buf_len = z_compact_file.getCursor();
+  z_compact_file.close();
+  AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "%s - %d bytes written"), devices ? PSTR("Zigbee Devices Data") : PSTR("ZbData"), buf_len);
+  if (devices) {
+    zigbee.compact_step = Z_COMPACT_DATA;
+    zigbee.compact_index = 0;
+    return;
+  }
+  zigbee.compact_step = Z_COMPACT_IDLE;
+  zigbee.journal_compact = false;
+  if (zigbee.compact_ok) {
+    truncateDevicesJournal();
+  }
+}
+
+/*********************************************************************************************\
+ * Journal of device data
+\*********************************************************************************************/
+void truncateDevicesJournal(void) {
+#ifdef USE_ZIGBEE_EEPROM
+  if (zigbee.eeprom_ready) {
+    ZFS::clearRecords(ZIGB_JRNL2);
+  }
+#endif // USE_ZIGBEE_EEPROM
+
+#ifdef USE_UFILESYS
+  if (dfsp && dfsp->exists(TASM_FILE_ZIGBEE_JOURNAL)) {
+    dfsp->remove(TASM_FILE_ZIGBEE_JOURNAL);
+  }
+#endif // USE_UFILESYS
+  zigbee.journal_len = 0;
+  zigbee.journal_devices = false;
+}
+
+// Is there a storage for the journal
+bool journalAvailable(void) {
+#ifdef USE_ZIGBEE_EEPROM
+  if (zigbee.eeprom_ready) { return true; }
+#endif // USE_ZIGBEE_EEPROM
+#ifdef USE_UFILESYS
+  if (dfsp) { return true; }
+#endif // USE_UFILESYS
+  return false;
+}
+
+// Bytes the journal may contain since the last full write of ZbData
+// 1/8 is available right away for bursts, the rest over Z_SAVE_DATA_TIMER
+uint32_t journalBudget(void) {
+  uint32_t elapsed = millis() - zigbee.data_saved;
+  if (elapsed >= Z_SAVE_DATA_TIMER) { return ZIGBEE_JOURNAL_SIZE; }
+  const uint32_t burst = ZIGBEE_JOURNAL_SIZE / 8;
+  return burst + (uint64_t)(ZIGBEE_JOURNAL_SIZE - burst) * elapsed / Z_SAVE_DATA_TIMER;
+}
+
+// Append a record to the journal
+// return false if it could not be written, a compaction is then needed
+bool journalAppend(uint16_t shortaddr, SBuffer & buf) {
+  bool ok = false;
+#ifdef USE_ZIGBEE_EEPROM
+  if (zigbee.eeprom_ready) {
+    ok = ZFS::appendRecord(ZIGB_JRNL2, zigbee.journal_len, buf.getBuffer(), buf.len());
+  } else
+#endif // USE_ZIGBEE_EEPROM
+  {
+#ifdef USE_UFILESYS
+    if (dfsp) {
+      File file = dfsp->open(TASM_FILE_ZIGBEE_JOURNAL, "a");
+      if (file) {
+        ok = (file.write(buf.getBuffer(), buf.len()) == buf.len());   // a partial record is discarded by the compaction
+        file.close();
       }
     }
-    size_t buf_len = f.getCursor();
-    f.close();
-    
-    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbData - %d bytes written to %s"), buf_len, storage_class);
+#endif // USE_UFILESYS
+  }
+  if (!ok) { return false; }
+  zigbee.journal_len += buf.len();
+  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "ZbData journal 0x%04X - %d bytes (total %d)"), shortaddr, buf.len(), zigbee.journal_len);
+  return true;
+}
+
+// Journal record of the device configuration, empty if too long for a record
+SBuffer journalDeviceConfig(const class Z_Device & device) {
+  SBuffer dev = hibernateDevice(device);
+  SBuffer buf(dev.len() + 1);
+  if (dev.len() > 255) { return buf; }
+  buf.add8(dev.len());          // 2 bytes of tag replace the 2 bytes of length
+  buf.add16(Z_JOURNAL_DEVICE);
+  buf.addBuffer(dev.buf(2), dev.len() - 2);
+  return buf;
+}
+
+// Called by `removeDevice()`, return false if there is no journal
+bool journalDeviceRemoved(uint16_t shortaddr) {
+  if (!journalAvailable()) { return false; }
+  if (zigbee.init_phase) { return true; }                         // replaying the journal
+  if (Z_COMPACT_IDLE != zigbee.compact_step) {
+    zigbee.journal_devices = true;                                // the compaction restarts and writes the devices file
+    return true;
+  }
+  SBuffer buf(5);
+  buf.add8(4);
+  buf.add16(Z_JOURNAL_REMOVED);
+  buf.add16(shortaddr);
+  if ((zigbee.journal_len + buf.len() + 1 > ZIGBEE_JOURNAL_SIZE) || !journalAppend(shortaddr, buf)) {
+    bool journal_devices = zigbee.journal_devices;
+    zigbee.journal_devices = true;
+    if (!compactDevicesStart(false)) {
+      zigbee.journal_devices = journal_devices;
+      return false;                                               // save all devices instead
+    }
+    return true;
+  }
+  zigbee.journal_devices = true;
+  return true;
+}
+
+// Called at each tick, runs a step of the compaction or appends the record of a single device
+// Configuration changes go first, then the device whose data waits for the longest time.
+// Data stays pending, and further changes coalesced, while the journal is over its budget
+// but at most `kZigbeeJournalMaxDelaySeconds`
+void journalDevicesData(void) {
+  if (Z_COMPACT_IDLE != zigbee.compact_step) {
+    compactDevicesStep();
+    return;
+  }
+  if (!TimeReached(zigbee.journal_check)) { return; }
+  SetNextTimeInterval(zigbee.journal_check, 1000);
+  bool time_valid = (Rtc.utc_time >= START_VALID_TIME);     // same as hibernateAllData()
+
+  Z_Device * pending = nullptr;
+  bool config = false;
+  for (auto & device : zigbee_devices.getDevices()) {
+    if (device.config_timer && TimeReached(device.config_timer)) {
+      pending = &device;
+      config = true;
+      break;
+    }
+    if (time_valid && device.journal_timer && TimeReached(device.journal_timer)) {
+      if ((nullptr == pending) || (TimePassedSince(device.journal_timer) > TimePassedSince(pending->journal_timer))) {
+        pending = &device;
+      }
+    }
+  }
+  if (nullptr == pending) { return; }
+
+  SBuffer buf = config ? journalDeviceConfig(*pending) : hibernateDeviceData(*pending, false);
+  if (buf.len() == 0) {
+    if (config) {
+      zigbee.journal_devices = true;                // too long for a record, write the devices file
+      compactDevicesStart(false);
+    } else {
+      pending->journal_timer = 0;                   // nothing to save
+    }
+    return;
+  }
+  // journal full, +1 for the end marker on EEPROM
+  if (zigbee.journal_compact || (zigbee.journal_len + buf.len() + 1 > ZIGBEE_JOURNAL_SIZE)) {
+    compactDevicesStart(false);                     // pending devices are saved by the compaction
+    return;
+  }
+  if (!config && (zigbee.journal_len + buf.len() > journalBudget()) &&
+      (TimePassedSince(pending->journal_timer) < kZigbeeJournalMaxDelaySeconds * 1000)) { return; }    // wait
+
+  if (journalAppend(pending->shortaddr, buf)) {
+    if (config) {
+      pending->config_timer = 0;
+      zigbee.journal_devices = true;
+    } else {
+      pending->journal_timer = 0;
+    }
+    zigbee.journal_check = millis();                // look for the next pending device at next tick
+  } else {
+    zigbee.journal_compact = true;
   }
 }
 
 /*********************************************************************************************\
  * Timer to save every 60 minutes
 \*********************************************************************************************/
-const uint32_t Z_SAVE_DATA_TIMER = 60 * 60 * 1000;       // save data every 60 minutes (in ms)
 
 //
 // Callback for setting the timer to save Zigbee Data in x seconds
@@ -281,22 +640,16 @@ int32_t Z_Set_Save_Data_Timer(uint8_t value) {
 }
 
 void Z_SaveDataTimer(uint16_t shortaddr, uint16_t groupaddr, uint16_t cluster, uint8_t endpoint, uint32_t value) {
-  hibernateAllData();
+  uint32_t since = millis() - zigbee.data_saved;
+  if (since < Z_SAVE_DATA_TIMER) {
+    // ZbData was written meanwhile when compacting the journal, wait a full period since then
+    zigbee_devices.setTimer(0x0000, 0, Z_SAVE_DATA_TIMER - since, 0, 0, Z_CAT_ALWAYS, 0 /* value */, &Z_SaveDataTimer);
+    return;
+  }
+  compactDevicesStart(true);    // one device per tick
   Z_Set_Save_Data_Timer(0);     // set a new timer
 }
 
-//
-// Callback for saving all data once, used after receiving important events
-//
-int32_t Z_Set_Save_Data_Timer_Once(uint8_t value) {
-  zigbee_devices.setTimer(0x0000, 0, 0 /* now */, 0, 0, Z_CAT_ALWAYS, 0 /* value */, &Z_SaveDataTimerOnce);
-  return 0;                              // continue
-}
-
-void Z_SaveDataTimerOnce(uint16_t shortaddr, uint16_t groupaddr, uint16_t cluster, uint8_t endpoint, uint32_t value) {
-  hibernateAllData();
-}
-
 
 #ifdef USE_ZIGBEE_EEPROM
 void ZFS_Erase(void) {
@@ -450,8 +450,9 @@ bool loadZigbeeDevices(void) {
  *
  * Save device configuration from storage.
  * Order of storage for saving is: 1/ EEPROM 2/ File system 3/ Flash (ESP8266 only)
+ * Returns true if written
 \*********************************************************************************************/
-void saveZigbeeDevices(void) {
+bool saveZigbeeDevices(void) {
   Univ_Write_File f;
   const char * storage_class = PSTR("");
 
@@ -501,7 +502,7 @@ void saveZigbeeDevices(void) {
     if (!spi_buffer) {
       AddLog(LOG_LEVEL_ERROR, PSTR(D_LOG_ZIGBEE "Cannot allocate 4KB buffer"));
       free(sbuffer);
-      return;
+      return false;
     }
     ESP.flashRead(z_spi_start_sector * SPI_FLASH_SEC_SIZE, (uint32_t*) spi_buffer, SPI_FLASH_SEC_SIZE);
 
@@ -521,7 +522,7 @@ void saveZigbeeDevices(void) {
     free(sbuffer);
   }
 #endif // defined(ESP8266)
-
+  return written;
 }
 
 
@@ -533,6 +534,7 @@ void saveZigbeeDevices(void) {
 // Erase the flash area containing the ZigbeeData
 void eraseZigbeeDevices(void) {
   zigbee_devices.clean();     // avoid writing data to flash after erase
+  compactDevicesAbort();
 #ifdef USE_ZIGBEE_EEPROM
   ZFS_Erase();
 #endif // USE_ZIGBEE_EEPROM
@@ -563,6 +565,7 @@ void eraseZigbeeDevices(void) {
   if (TfsDeleteFile(TASM_FILE_ZIGBEE)) {
     AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Zigbee Devices Data erased"));
   }
+  truncateDevicesJournal();     // records would be replayed on devices reusing the same short address
 #endif  // USE_UFILESYS
 }
 
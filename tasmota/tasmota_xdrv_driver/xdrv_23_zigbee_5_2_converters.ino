@@ -1514,6 +1514,9 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
         uint8_t * attr_address = ((uint8_t*)&data) + sizeof(Z_Data) + matched_attr.map_offset;
         uint32_t uval32 = attr.getUInt();     // call converter to uint only once
         int32_t  ival32 = attr.getInt();     // call converter to int only once
+        uint32_t attr_len = Z_getDatatypeLen(matched_attr.zigbee_type);
+        uint32_t prev_val32 = 0;              // previous value, to journal only actual changes
+        if (attr_len <= 4) { memcpy(&prev_val32, attr_address, attr_len); }
         // AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_LOG_ZIGBEE "Mapping type=%d offset=%d zigbee_type=%02X value=%d\n"), (uint8_t) matched_attr.matched_attr, matched_attr.map_offset, matched_attr.zigbee_type, ival32);
         switch (ccccaaaa) {
           case 0xEF000202:
@@ -1535,8 +1538,13 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
           case Zint16:  *(int16_t*)attr_address  = ival32;           break;
           case Zint32:  *(int32_t*)attr_address  = ival32;           break;
         }
+        if (attr_len <= 4) {
+          uint32_t new_val32 = 0;
+          memcpy(&new_val32, attr_address, attr_len);
+          if (new_val32 != prev_val32) { device.dataDirty(); }
+        }
         if (Z_Data_Set::updateData(data)) {
-          zigbee_devices.dirty();
+          zigbee_devices.dirty(device);
         }
       }
 
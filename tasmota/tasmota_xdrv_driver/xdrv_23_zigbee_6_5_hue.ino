@@ -114,12 +114,10 @@ void HueLightStatus2Zigbee(uint16_t shortaddr, uint8_t ep, String *response)
     }
   }
   
-  char* buf = HueLightStatus2Generic(name,
+  *response += HueLightStatus2Generic(name,
               (modelId) ? modelId : PSTR("Unknown"),
               (manufacturerId) ? manufacturerId : PSTR("Tasmota"),
               GetHueDeviceId(shortaddr, ep).c_str());
-  *response += buf;
-  free(buf);
 }
 
 int32_t ZigbeeHueStatus(String * response, uint16_t shortaddr, uint8_t ep) {
@@ -153,6 +151,7 @@ void ZigbeeCheckHue(String & response, bool * appending) {
         HueLightStatus1Zigbee(shortaddr, ep, bulbtype, &response);
         HueLightStatus2Zigbee(shortaddr, (i == 0) ? 0 : ep, &response); // if first endpoint ,announce as `0`
         *appending = true;
+        HueListFlush(&response, false);
       }
     }
   }
@@ -19,129 +19,500 @@
 
 #ifdef USE_ZIGBEE
 
+// number of Mgmt_Lqi_req kept in flight while mapping
+#ifndef ZIGBEE_MAP_CONCURRENT
+#define ZIGBEE_MAP_CONCURRENT   4
+#endif
+// maximum size of the rendered map kept in memory between web requests, larger maps are streamed
+#ifndef ZIGBEE_MAP_CACHE_MAX
+#ifdef ESP8266
+#define ZIGBEE_MAP_CACHE_MAX    8192
+#else
+#define ZIGBEE_MAP_CACHE_MAX    32768
+#endif
+#endif
+
+const uint32_t Z_MAP_RTT_INIT = 2000;       // ms, initial estimate of the round-trip time of a Mgmt_Lqi_req
+const uint32_t Z_MAP_TIMEOUT_MIN = 1000;    // ms
+const uint32_t Z_MAP_TIMEOUT_MAX = 8000;    // ms
+const uint8_t  Z_MAP_RETRIES = 2;           // number of retries before giving up on a router
+
+//
+// Link between two nodes, as reported in the neighbour table of one or both nodes
+//
+// We always orientate the edge with shortaddresses in ascending order
+// invariant: node_1 < node_2
+//
 class Z_Mapper_Edge {
 public:
+  enum : uint8_t {
+    From_1  = 0x01,         // reported by node_1
+    From_2  = 0x02,         // reported by node_2
+    Stale_1 = 0x04,         // reported by node_1 during a previous mapping, being refreshed
+    Stale_2 = 0x08,         // reported by node_2 during a previous mapping, being refreshed
+  };
 
-  // enum Edge_Type : uint8_t {
-  //   Unknown = 0x00,
-  //   Parent = 0x01,          // node_1 is parent of node_2
-  //   Child = 0x02,           // node_1 is child of node_2
-  //   Sibling = 0x03,         // both nodes are siblings
-  // };
-
-  Z_Mapper_Edge(void) :
-    node_1(BAD_SHORTADDR),
-    node_2(BAD_SHORTADDR),
-    lqi(0x00)
-    // edge_type(Unknown)
-    {}
+  inline uint32_t key(void) const { return (node_1 << 16) | node_2; }
+  static inline uint32_t key(uint16_t node_a, uint16_t node_b) {
+    return (node_a < node_b) ? ((node_a << 16) | node_b) : ((node_b << 16) | node_a);
+  }
+  inline uint8_t lqi(void) const { return (lqi_1 > lqi_2) ? lqi_1 : lqi_2; }
 
-  // Z_Mapper_Edge(uint16_t node_a, uint16_t node_b, uint8_t _lqi, Edge_Type _type) :
-  Z_Mapper_Edge(uint16_t node_a, uint16_t node_b, uint8_t _lqi) :
-    node_1(BAD_SHORTADDR),
-    node_2(BAD_SHORTADDR),
-    lqi(_lqi)
-    // edge_type(_type)
-    {
-      setEdges(node_a, node_b);
-    }
+  uint16_t    node_1;
+  uint16_t    node_2;
+  uint8_t     lqi_1;        // link quality as seen by node_1
+  uint8_t     lqi_2;        // link quality as seen by node_2
+  uint8_t     flags;
+};
 
-  void setEdges(uint16_t node_a, uint16_t node_b);
+//
+// Compact adjacency table, edges are kept sorted by key in a single array
+//
+class Z_Mapper_Edges {
+public:
+  Z_Mapper_Edges(void) : _edges(nullptr), _len(0), _alloc(0) {}
+  ~Z_Mapper_Edges(void) { reset(); }
 
-  bool sameEdge(const Z_Mapper_Edge & edge2) const;
+  void reset(void) { free(_edges); _edges = nullptr; _len = 0; _alloc = 0; }
 
-  // Edge_Type Z_Mapper_Edge_Type_Reverse(Edge_Type _type) {
-  //   switch (_type) {
-  //     case Parent:  return Child;
-  //     case Child:   return Parent;
-  //     default: return _type;
-  //   }
-  // }
+  // add or update the edge as reported by `reporter`
+  bool report(uint16_t reporter, uint16_t neighbour, uint8_t lqi);
+  // move all reports from `reporter` to stale
+  void markStale(uint16_t reporter);
+  // `reporter` confirmed its previous neighbour table, stale reports are valid again
+  void restoreStale(uint16_t reporter);
+  // drop stale reports from `reporter` and remove edges not reported anymore
+  void purgeStale(uint16_t reporter);
+  // is the node part of any edge
+  bool hasNode(uint16_t shortaddr) const;
 
-  // we always orientate the edge from with shortaddresses in ascending order
-  // invariant: node_1 < node_2
-  uint16_t    node_1;
-  uint16_t    node_2;
+  inline size_t length(void) const { return _len; }
+  inline const Z_Mapper_Edge * begin(void) const { return _edges; }
+  inline const Z_Mapper_Edge * end(void) const { return _edges + _len; }
 
-  uint8_t     lqi;
-  // Edge_Type   edge_type;
+protected:
+  size_t lowerBound(uint32_t key) const;
+
+  Z_Mapper_Edge * _edges;
+  uint16_t        _len;
+  uint16_t        _alloc;
+};
+
+//
+// State of the collection of the neighbour table of a router
+//
+class Z_Mapper_Node {
+public:
+  enum : uint8_t {
+    Idle = 0,               // known from a previous mapping
+    Queued,                 // waiting for a slot to send the request
+    InFlight,               // request sent, waiting for response
+    Done,                   // collected or failed in this mapping
+  };
+
+  uint16_t    shortaddr;
+  uint8_t     state;
+  uint8_t     retries;      // number of retries for the current page
+  uint8_t     start;        // index of the page requested
+  uint8_t     total;        // size of the neighbour table at last complete collection
+  bool        collected;    // `total` and `sig` are valid
+  uint16_t    sig;          // signature of the first page of the neighbour table
+  uint32_t    sent_time;    // millis() when the current page was requested
 };
 
 //
 // Handles the mapping of Zigbee devices
 //
+// Routers are discovered breadth-first from the coordinator, and up to ZIGBEE_MAP_CONCURRENT
+// Mgmt_Lqi_req are in flight at the same time with a timeout adapted to the measured round-trip time.
+// When a previous map exists, a router whose first page of neighbour table is unchanged
+// is not collected further and keeps its previous edges.
+//
 class Z_Mapper {
 public:
   Z_Mapper(void) :
-    edges()
+    _edges(), _nodes(), _rtt(Z_MAP_RTT_INIT),
+    _sig_node(BAD_SHORTADDR), _sig(0), _swept(false),
+    _gen(0), _cache(), _cache_gen(0), _cache_dev_gen(0)
     {}
 
-  void reset(void) { edges.reset(); zigbee_devices.clearDeviceRouterInfo(); }
+  void reset(void);
+  // start a new mapping, incremental if a previous map is available
+  void start(void);
+  // called every 50ms while mapping is in progress
+  void run(void);
 
-  Z_Mapper_Edge & findEdge(const Z_Mapper_Edge & edge2);
-  bool addEdge(const Z_Mapper_Edge & edge2);
+  // called by the Mgmt_Lqi_rsp parser
+  void lqiPageStart(uint16_t shortaddr, uint8_t start);
+  void addNeighbour(uint16_t shortaddr, uint16_t neighbour, uint8_t dev_type, uint8_t lqi);
+  bool lqiPageEnd(uint16_t shortaddr, uint8_t status, uint8_t total, uint8_t start, uint8_t len);   // returns true if the mapper handles the follow-up
 
-  void dumpInternals(void) const;
+  void dumpInternals(void);
 
-  LList<Z_Mapper_Edge>    edges;
+protected:
+  Z_Mapper_Node * findNode(uint16_t shortaddr);
+  void queueNode(uint16_t shortaddr);
+  void sendRequest(Z_Mapper_Node & node);
+  void finishNode(Z_Mapper_Node & node, bool ok);
+  uint32_t timeout(const Z_Mapper_Node & node) const;
+  void renderMap(String & out, bool stream) const;
 
+  Z_Mapper_Edges          _edges;
+  LList<Z_Mapper_Node>    _nodes;
+  uint32_t                _rtt;         // smoothed round-trip time in ms
+  uint16_t                _sig_node;    // node whose first page is being parsed
+  uint16_t                _sig;
+  bool                    _swept;       // devices not seen in any neighbour table were queued
+  uint32_t                _gen;         // incremented each time the map changes
+  String                  _cache;       // rendered map
+  uint32_t                _cache_gen;
+  uint32_t                _cache_dev_gen;
 };
 
 // global
 Z_Mapper zigbee_mapper;
 
 /*********************************************************************************************\
- * Implementation for Z_Mapper_Edge
+ * Implementation for Z_Mapper_Edges
 \*********************************************************************************************/
-void Z_Mapper_Edge::setEdges(uint16_t node_a, uint16_t node_b) {
-  if (node_a < node_b) {
-    node_1 = node_a;
-    node_2 = node_b;
-  } else if (node_a > node_b) {
-    node_1 = node_b;
-    node_2 = node_a;
+// index of the first edge with key not lower than `key`
+size_t Z_Mapper_Edges::lowerBound(uint32_t key) const {
+  size_t lo = 0;
+  size_t hi = _len;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (_edges[mid].key() < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+bool Z_Mapper_Edges::report(uint16_t reporter, uint16_t neighbour, uint8_t lqi) {
+  if ((reporter == neighbour) || (BAD_SHORTADDR == reporter) || (BAD_SHORTADDR == neighbour)) { return false; }
+  uint32_t key = Z_Mapper_Edge::key(reporter, neighbour);
+  size_t pos = lowerBound(key);
+  if ((pos >= _len) || (_edges[pos].key() != key)) {
+    // insert new edge
+    if (_len >= _alloc) {
+      uint16_t new_alloc = _alloc + 16;
+      Z_Mapper_Edge * new_edges = (Z_Mapper_Edge*) realloc(_edges, new_alloc * sizeof(Z_Mapper_Edge));
+      if (new_edges == nullptr) { return false; }
+      _edges = new_edges;
+      _alloc = new_alloc;
+    }
+    memmove(&_edges[pos + 1], &_edges[pos], (_len - pos) * sizeof(Z_Mapper_Edge));
+    _len++;
+    Z_Mapper_Edge & edge = _edges[pos];
+    edge.node_1 = key >> 16;
+    edge.node_2 = key & 0xFFFF;
+    edge.lqi_1 = 0;
+    edge.lqi_2 = 0;
+    edge.flags = 0;
+  }
+  Z_Mapper_Edge & edge = _edges[pos];
+  if (edge.node_1 == reporter) {
+    edge.lqi_1 = lqi;
+    edge.flags = (edge.flags | Z_Mapper_Edge::From_1) & ~Z_Mapper_Edge::Stale_1;
   } else {
-    // do nothing
+    edge.lqi_2 = lqi;
+    edge.flags = (edge.flags | Z_Mapper_Edge::From_2) & ~Z_Mapper_Edge::Stale_2;
+  }
+  return true;
+}
+
+void Z_Mapper_Edges::markStale(uint16_t reporter) {
+  for (uint32_t i = 0; i < _len; i++) {
+    Z_Mapper_Edge & edge = _edges[i];
+    if ((edge.node_1 == reporter) && (edge.flags & Z_Mapper_Edge::From_1)) {
+      edge.flags = (edge.flags & ~Z_Mapper_Edge::From_1) | Z_Mapper_Edge::Stale_1;
+    } else if ((edge.node_2 == reporter) && (edge.flags & Z_Mapper_Edge::From_2)) {
+      edge.flags = (edge.flags & ~Z_Mapper_Edge::From_2) | Z_Mapper_Edge::Stale_2;
+    }
   }
 }
 
-bool Z_Mapper_Edge::sameEdge(const Z_Mapper_Edge & edge2) const {
-  return (node_1 == edge2.node_1) && (node_2 == edge2.node_2);
+void Z_Mapper_Edges::restoreStale(uint16_t reporter) {
+  for (uint32_t i = 0; i < _len; i++) {
+    Z_Mapper_Edge & edge = _edges[i];
+    if ((edge.node_1 == reporter) && (edge.flags & Z_Mapper_Edge::Stale_1)) {
+      edge.flags = (edge.flags & ~Z_Mapper_Edge::Stale_1) | Z_Mapper_Edge::From_1;
+    } else if ((edge.node_2 == reporter) && (edge.flags & Z_Mapper_Edge::Stale_2)) {
+      edge.flags = (edge.flags & ~Z_Mapper_Edge::Stale_2) | Z_Mapper_Edge::From_2;
+    }
+  }
+}
+
+void Z_Mapper_Edges::purgeStale(uint16_t reporter) {
+  uint32_t out = 0;
+  for (uint32_t i = 0; i < _len; i++) {
+    Z_Mapper_Edge & edge = _edges[i];
+    if (edge.node_1 == reporter) {
+      edge.flags &= ~Z_Mapper_Edge::Stale_1;
+    } else if (edge.node_2 == reporter) {
+      edge.flags &= ~Z_Mapper_Edge::Stale_2;
+    }
+    if (edge.flags) {
+      if (out != i) { _edges[out] = edge; }
+      out++;
+    }
+  }
+  _len = out;
+}
+
+bool Z_Mapper_Edges::hasNode(uint16_t shortaddr) const {
+  for (const Z_Mapper_Edge & edge : *this) {
+    if ((edge.node_1 == shortaddr) || (edge.node_2 == shortaddr)) { return true; }
+  }
+  return false;
 }
 
 /*********************************************************************************************\
  * Implementation for Z_Mapper
 \*********************************************************************************************/
-Z_Mapper_Edge & Z_Mapper::findEdge(const Z_Mapper_Edge & edge2) {
-  if ((edge2.node_1 == BAD_SHORTADDR) || (edge2.node_2 == BAD_SHORTADDR)) { return *(Z_Mapper_Edge*)nullptr; }
-  for (auto & edge : edges) {
-    if (edge2.sameEdge(edge)) {
-      return edge;
+void Z_Mapper::reset(void) {
+  _edges.reset();
+  _nodes.reset();
+  _rtt = Z_MAP_RTT_INIT;
+  _gen++;
+  zigbee_devices.clearDeviceRouterInfo();
+}
+
+Z_Mapper_Node * Z_Mapper::findNode(uint16_t shortaddr) {
+  for (auto & node : _nodes) {
+    if (node.shortaddr == shortaddr) { return &node; }
+  }
+  return nullptr;
+}
+
+void Z_Mapper::queueNode(uint16_t shortaddr) {
+  if (BAD_SHORTADDR == shortaddr) { return; }
+  Z_Mapper_Node * node = findNode(shortaddr);
+  if (node == nullptr) {
+    node = &_nodes.addToLast();
+    node->shortaddr = shortaddr;
+    node->total = 0;
+    node->collected = false;
+    node->sig = 0;
+  } else if (node->state != Z_Mapper_Node::Idle) {
+    return;     // already queued or handled in this mapping
+  }
+  node->state = Z_Mapper_Node::Queued;
+  node->retries = 0;
+  node->start = 0;
+}
+
+void Z_Mapper::start(void) {
+  // we can't abort a mapping in progress
+  if (zigbee.mapping_in_progress) { return; }
+  if (!zigbee.mapping_ready) {
+    reset();                  // no previous map, full mapping
+  }
+  zigbee.mapping_in_progress = true;
+  _swept = false;
+  _sig_node = BAD_SHORTADDR;
+
+  for (auto & node : _nodes) {
+    node.state = Z_Mapper_Node::Idle;
+  }
+  // start from coordinator, then routers known from previous mapping in the same order
+  queueNode(0x0000);
+  for (auto & node : _nodes) {
+    queueNode(node.shortaddr);
+  }
+  run();
+}
+
+uint32_t Z_Mapper::timeout(const Z_Mapper_Node & node) const {
+  uint32_t t = _rtt * 3;
+  if (t < Z_MAP_TIMEOUT_MIN) { t = Z_MAP_TIMEOUT_MIN; }
+  if (t > Z_MAP_TIMEOUT_MAX) { t = Z_MAP_TIMEOUT_MAX; }
+  return t << node.retries;     // back-off on retries
+}
+
+void Z_Mapper::sendRequest(Z_Mapper_Node & node) {
+  if ((0 == node.start) && (0 == node.retries)) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "sending `ZbMap 0x%04X`"), node.shortaddr);
+  }
+  node.state = Z_Mapper_Node::InFlight;
+  node.sent_time = millis();
+  zigbee.background = true;       // let user commands overtake the mapping
+#ifdef USE_ZIGBEE_ZNP
+  Z_Send_State_or_Map(node.shortaddr, node.start, ZDO_MGMT_LQI_REQ);
+#endif // USE_ZIGBEE_ZNP
+#ifdef USE_ZIGBEE_EZSP
+  Z_Send_State_or_Map(node.shortaddr, node.start, ZDO_Mgmt_Lqi_req);
+#endif // USE_ZIGBEE_EZSP
+  zigbee.background = false;
+}
+
+void Z_Mapper::finishNode(Z_Mapper_Node & node, bool ok) {
+  node.state = Z_Mapper_Node::Done;
+  if (!ok) {
+    node.collected = false;       // force full collection next time
+    if (0 == node.start) {
+      _edges.markStale(node.shortaddr);   // no neighbour table at all, forget previous reports
     }
   }
-  return *(Z_Mapper_Edge*)nullptr;
+  // edges not reported again are removed
+  _edges.purgeStale(node.shortaddr);
 }
 
-bool Z_Mapper::addEdge(const Z_Mapper_Edge & edge2) {
-  if ((edge2.node_1 == BAD_SHORTADDR) || (edge2.node_2 == BAD_SHORTADDR)) { return false; }
-  Z_Mapper_Edge & cur_edge = findEdge(edge2);
-  if (&cur_edge == nullptr) {
-    edges.addHead(edge2);
-  } else {
-    //upgrade fields
-    if (edge2.lqi > cur_edge.lqi) {
-      cur_edge.lqi = edge2.lqi;
+void Z_Mapper::run(void) {
+  if (!zigbee.mapping_in_progress) { return; }
+
+  uint32_t in_flight = 0;
+  uint32_t queued = 0;
+  for (auto & node : _nodes) {
+    if (Z_Mapper_Node::InFlight == node.state) {
+      if (TimePassedSince(node.sent_time) >= (int32_t) timeout(node)) {
+        if (node.retries < Z_MAP_RETRIES) {
+          node.retries++;
+          sendRequest(node);
+        } else {
+          AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_ZIGBEE "ZbMap no response from 0x%04X"), node.shortaddr);
+          finishNode(node, false);
+          if ((node.shortaddr != 0x0000) && !zigbee_devices.findShortAddr(node.shortaddr).valid()) {
+            _nodes.remove(&node);     // forget routers that are gone
+          }
+          continue;
+        }
+      }
+      in_flight++;
+    } else if (Z_Mapper_Node::Queued == node.state) {
+      if (in_flight < ZIGBEE_MAP_CONCURRENT) {
+        sendRequest(node);
+        in_flight++;
+      } else {
+        queued++;
+      }
+    }
+  }
+
+  if (0 == in_flight) {
+    if (!_swept) {
+      // query devices not seen in any neighbour table, they may be isolated routers
+      _swept = true;
+      for (const auto & device : zigbee_devices.getDevices()) {
+        if (!_edges.hasNode(device.shortaddr)) {
+          queueNode(device.shortaddr);
+        }
+      }
+      run();
+      return;
+    }
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbMap done"));
+    zigbee.mapping_in_progress = false;
+    zigbee.mapping_ready = true;
+    _gen++;
+    return;
+  }
+  // estimate remaining time for the web UI
+  zigbee.mapping_end_time = millis() + (queued / ZIGBEE_MAP_CONCURRENT + 1) * _rtt * 2;
+}
+
+void Z_Mapper::lqiPageStart(uint16_t shortaddr, uint8_t start) {
+  _sig_node = BAD_SHORTADDR;
+  Z_Mapper_Node * node = findNode(shortaddr);
+  if (node && (Z_Mapper_Node::InFlight == node->state) && (0 == start) && (node->start == start)) {
+    _sig_node = shortaddr;
+    _sig = 0;
+    _edges.markStale(shortaddr);
+  }
+}
+
+void Z_Mapper::addNeighbour(uint16_t shortaddr, uint16_t neighbour, uint8_t dev_type, uint8_t lqi) {
+  if (_edges.report(shortaddr, neighbour, lqi)) { _gen++; }
+  if (shortaddr == _sig_node) {
+    _sig = (_sig * 31) ^ neighbour ^ ((dev_type & 0x73) << 8);
+  }
+  // discover routers
+  if (zigbee.mapping_in_progress && ((dev_type & 0x03) <= 1)) {
+    queueNode(neighbour);
+  }
+}
+
+bool Z_Mapper::lqiPageEnd(uint16_t shortaddr, uint8_t status, uint8_t total, uint8_t start, uint8_t len) {
+  if (!zigbee.mapping_in_progress) { return false; }
+  Z_Mapper_Node * node = findNode(shortaddr);
+  if (node == nullptr) { return false; }
+  bool first_page = (shortaddr == _sig_node);
+  _sig_node = BAD_SHORTADDR;
+  if ((Z_Mapper_Node::InFlight != node->state) || (node->start != start)) { return true; }   // late or duplicate response
+
+  if (0 == node->retries) {     // Karn's rule: don't measure retransmitted requests
+    uint32_t rtt = TimePassedSince(node->sent_time);
+    _rtt = (_rtt * 7 + rtt) / 8;
+  }
+  if (status) {
+    finishNode(*node, false);
+    return true;
+  }
+
+  if (first_page) {
+    if (node->collected && (node->total == total) && (node->sig == _sig)) {
+      // neighbour table unchanged, keep the edges from the other pages
+      _edges.restoreStale(shortaddr);
+      finishNode(*node, true);
+      return true;
     }
-    // if (cur_edge.edge_type == Z_Mapper_Edge::Unknown) {
-    //   cur_edge.edge_type = edge2.edge_type;
-    // } else if ((edge2.edge_type == Z_Mapper_Edge::Parent) || (edge2.edge_type == Z_Mapper_Edge::Child)) {
-    //   // Parent or Child always has priority over Sibling
-    //   cur_edge.edge_type = edge2.edge_type;
-    // }
+    node->total = total;
+    node->sig = _sig;
+  }
+  if ((len > 0) && (start + len < total)) {
+    // there are more values to read, keep the slot
+    node->start = start + len;
+    node->retries = 0;
+    sendRequest(*node);
+  } else {
+    node->collected = true;
+    finishNode(*node, true);
   }
   return true;
 }
 
+void Z_Mapper::renderMap(String & out, bool stream) const {
+  char buf[96];
+  out += F("nodes:[" "{id:\"0x0000\",label:\"Coordinator\",group:\"o\",title:\"0x0000\"}");
+  for (const auto & device : zigbee_devices.getDevices()) {
+    snprintf_P(buf, sizeof(buf), PSTR(",{id:\"0x%04X\",group:\"%c\",title:\"0x%04X\",label:\""),
+               device.shortaddr, device.isRouter() ? 'r' : 'e', device.shortaddr);
+    out += buf;
+    const char *fname = device.friendlyName;
+    if (fname != nullptr) {
+      out += EscapeJSONString(fname);
+    } else {
+      snprintf_P(buf, sizeof(buf), PSTR("0x%04X"), device.shortaddr);
+      out += buf;
+    }
+    out += F("\"}");
+    if (stream && (out.length() >= CHUNKED_BUFFER_SIZE)) {
+      WSContentSend(out.c_str(), out.length());
+      out = "";
+    }
+  }
+  out += F("],");
+
+  out += F("edges:[");
+  for (const Z_Mapper_Edge & edge : _edges) {
+    uint32_t lqi_color = 0x000;
+    char lqi[8] = "";
+    if (edge.lqi() > 0) {
+      snprintf_P(lqi, sizeof(lqi), PSTR("%d"), edge.lqi());
+    }
+    snprintf_P(buf, sizeof(buf), PSTR("{from:\"0x%04X\",to:\"0x%04X\",label:\"%s\",color:\"#%03X\"},"),
+               edge.node_1, edge.node_2, lqi, lqi_color);
+    out += buf;
+    if (stream && (out.length() >= CHUNKED_BUFFER_SIZE)) {
+      WSContentSend(out.c_str(), out.length());
+      out = "";
+    }
+  }
+  out += F("],");
+}
+
 String EscapeHTMLString(const char *s_P) {
   String s((const __FlashStringHelper*) s_P);
   s.replace(F("&"), F("&amp;"));
@@ -151,39 +522,25 @@ String EscapeHTMLString(const char *s_P) {
   return s;
 }
 
-void Z_Mapper::dumpInternals(void) const {
-  WSContentSend_P(PSTR("nodes:[" "{id:\"0x0000\",label:\"Coordinator\",group:\"o\",title:\"0x0000\"}"));
-  for (const auto & device : zigbee_devices.getDevices()) {
-    WSContentSend_P(PSTR(",{id:\"0x%04X\",group:\"%c\",title:\"0x%04X\",label:\""),
-                    device.shortaddr, device.isRouter() ? 'r' : 'e', device.shortaddr);
-
-    const char *fname = device.friendlyName;
-    if (fname != nullptr) {
-      WSContentSend_P(PSTR("%s"), EscapeJSONString(fname).c_str());
-    } else {
-      WSContentSend_P(PSTR("0x%04X"), device.shortaddr);
+// Send the map to the web client, rendered once per generation of the map and of the devices list
+void Z_Mapper::dumpInternals(void) {
+  uint32_t dev_gen = zigbee_devices.generation();
+  if ((_cache.length() == 0) || (_cache_gen != _gen) || (_cache_dev_gen != dev_gen)) {
+    _cache = String();
+    size_t estimate = (zigbee_devices.devicesSize() + 1) * 96 + _edges.length() * 56;
+    if (estimate > ZIGBEE_MAP_CACHE_MAX) {
+      // too big to be kept in memory
+      String out;
+      renderMap(out, true);
+      WSContentSend(out.c_str(), out.length());
+      return;
     }
-    WSContentSend_P("\"}");
+    _cache.reserve(estimate);
+    renderMap(_cache, false);
+    _cache_gen = _gen;
+    _cache_dev_gen = dev_gen;
   }
-  WSContentSend_P(PSTR("],"));
-
-  WSContentSend_P(PSTR("edges:["));
-  for (auto & edge : edges) {
-    uint32_t lqi_color = 0x000;
-    // if (edge.lqi >= 192) {
-    //   lqi_color = 0x364;
-    // } else if (edge.lqi >= 128) {
-    //   lqi_color = 0x346;
-    // } else if (edge.lqi > 0) {
-    //   lqi_color = 0xd56;
-    // }
-    char hex[8];
-    snprintf(hex, sizeof(hex), PSTR("%d"), edge.lqi);
-
-    WSContentSend_P(PSTR("{from:\"0x%04X\",to:\"0x%04X\",label:\"%s\",color:\"#%03X\"},"),
-                edge.node_1, edge.node_2, (edge.lqi > 0) ? hex : "", lqi_color);
-  }
-  WSContentSend_P(PSTR("],"));
+  WSContentSend(_cache.c_str(), _cache.length());
 }
 
 #endif // USE_ZIGBEE
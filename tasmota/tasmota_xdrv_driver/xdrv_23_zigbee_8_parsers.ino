@@ -276,23 +276,6 @@ void Z_Send_State_or_Map(uint16_t shortaddr, uint8_t index, uint16_t zdo_cmd) {
   EZ_SendZDO(shortaddr, zdo_cmd, buf, sizeof(buf), false);
 #endif // USE_ZIGBEE_EZSP
 }
-
-// This callback is registered to send ZbMap(s) to each device one at a time
-void Z_Map(uint16_t shortaddr, uint16_t groupaddr, uint16_t cluster, uint8_t endpoint, uint32_t value) {
-  if (BAD_SHORTADDR != shortaddr) {
-    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "sending `ZbMap 0x%04X`"), shortaddr);
-#ifdef USE_ZIGBEE_ZNP
-    Z_Send_State_or_Map(shortaddr, value, ZDO_MGMT_LQI_REQ);
-#endif // USE_ZIGBEE_ZNP
-#ifdef USE_ZIGBEE_EZSP
-    Z_Send_State_or_Map(shortaddr, value, ZDO_Mgmt_Lqi_req);
-#endif // USE_ZIGBEE_EZSP
-  } else {
-    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "ZbMap done"));
-    zigbee.mapping_in_progress = false;
-    zigbee.mapping_ready = true;
-  }
-}
 /*********************************************************************************************\
  * Parsers for incoming EZSP messages
 \*********************************************************************************************/
@@ -803,7 +786,7 @@ int32_t Z_ReceiveSimpleDesc(int32_t res, const SBuffer &buf) {
     Z_Device & device = zigbee_devices.getShortAddr(nwkAddr);
     device.addEndpoint(endpoint);
     device.data.get<Z_Data_Mode>(endpoint).setConfig(ZM_Tuya);
-    zigbee_devices.dirty();
+    zigbee_devices.dirty(device);
   }
 
   return -1;
@@ -1152,6 +1135,7 @@ int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBuffer &buf, boolean lqi) {
                            lqi ? PSTR("Map") : PSTR("Bindings"));
 
   if (lqi) {
+    zigbee_mapper.lqiPageStart(shortaddr, start);
     uint32_t idx = prefix_len;
     for (uint32_t i = 0; i < len; i++) {
       if (idx + 22 > buf.len()) { break; }   // size 22 for EZSP
@@ -1199,17 +1183,7 @@ int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBuffer &buf, boolean lqi) {
       }
 
       // Add information to zigbee mapper
-      // Z_Mapper_Edge::Edge_Type edge_type;
-      // switch ((m_dev_type & 0x70) >> 4) {
-      //   case 0: edge_type = Z_Mapper_Edge::Parent;       break;
-      //   case 1: edge_type = Z_Mapper_Edge::Child;        break;
-      //   case 2: edge_type = Z_Mapper_Edge::Sibling;      break;
-      //   default: edge_type = Z_Mapper_Edge::Unknown;     break;
-
-      // }
-      // Z_Mapper_Edge edge(m_shortaddr, shortaddr, m_lqi, edge_type);
-      Z_Mapper_Edge edge(m_shortaddr, shortaddr, m_lqi);
-      zigbee_mapper.addEdge(edge);
+      zigbee_mapper.addNeighbour(shortaddr, m_shortaddr, m_dev_type, m_lqi);
     }
 
     ResponseAppend_P(PSTR("]}}"));
@@ -1255,6 +1229,11 @@ int32_t Z_Mgmt_Lqi_Bind_Rsp(int32_t res, const SBuffer &buf, boolean lqi) {
 
   MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_TELE, PSTR(D_JSON_ZIGBEE_MAP));
 
+  // When mapping all devices, the mapper sends the follow-up requests itself
+  if (lqi && zigbee_mapper.lqiPageEnd(shortaddr, status, total, start, len)) {
+    return -1;
+  }
+
   // Check if there are more values waiting, if so re-send a new request to get other values
   // Only send a new request if the current was non-empty. This avoids an infinite loop if the device announces more slots that it actually has.
   if ((non_empty) && (start + len < total)) {
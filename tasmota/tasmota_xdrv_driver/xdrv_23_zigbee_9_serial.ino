@@ -33,6 +33,17 @@ const uint8_t  ZIGBEE_EZSP_CANCEL = 0x1A;  // cancel byte
 const uint8_t  ZIGBEE_EZSP_EOF = 0x7E;     // end of frame
 const uint8_t  ZIGBEE_EZSP_ESCAPE = 0x7D;  // escape byte
 
+// ASH sliding window: number of DATA frames sent without waiting for their ACK, 1..7
+#ifndef USE_ZIGBEE_EZSP_WINDOW
+#define USE_ZIGBEE_EZSP_WINDOW 3
+#endif
+const uint8_t  EZSP_ASH_WINDOW = (USE_ZIGBEE_EZSP_WINDOW < 1) ? 1 : (USE_ZIGBEE_EZSP_WINDOW > 7) ? 7 : USE_ZIGBEE_EZSP_WINDOW;
+// ACK timeout, adapted to measured round-trip time as per ASH specification
+const uint32_t EZSP_ASH_T_RX_ACK_INIT = 1600;   // ms
+const uint32_t EZSP_ASH_T_RX_ACK_MIN = 400;     // ms
+const uint32_t EZSP_ASH_T_RX_ACK_MAX = 3200;    // ms
+const uint8_t  EZSP_ASH_ACK_TIMEOUTS = 4;       // consecutive timeouts before declaring the link failed
+
 class EZSP_Serial_t {
 public:
   uint8_t  to_send = 0;     // 0..7, frame number of next packet to send, nothing to send if equal to to_end
@@ -40,9 +51,44 @@ public:
   uint8_t  to_ack = 0;      // 0..7, frame number of last packet acknowledged + 1
   uint8_t  from_ack = 0;    // 0..7, frame to ack
   uint8_t  ezsp_seq = 0;    // 0..255, EZSP sequence number
+  bool     ack_pending = false;   // a DATA frame was received and is not acknowledged yet
+  bool     rejecting = false;     // a NAK was sent for an out of sequence frame, until the expected one is received
+  uint8_t  sent_mask = 0;   // bit per frame number, set if the frame was already sent once (next sends are retransmissions)
+  uint8_t  retx_mask = 0;   // bit per frame number, set if the frame was retransmitted
+  uint8_t  timeouts = 0;    // consecutive ACK timeouts
+  uint32_t t_rx_ack = EZSP_ASH_T_RX_ACK_INIT;   // current ACK timeout
   SBuffer *to_packets[8] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+  uint32_t sent_time[8] = { 0 };      // millis() when each frame was last sent
+  // frames waiting for room in the window, user commands overtake background traffic
+  LList<SBuffer*> queue_high;
+  LList<SBuffer*> queue_low;
+
+  inline uint8_t inFlight(void) const { return (to_end - to_ack) & 0x07; }
+  inline bool idle(void) const { return (to_send == to_end) && queue_high.isEmpty() && queue_low.isEmpty(); }
+  void reset(void);
 };
 
+void EZSP_Serial_t::reset(void) {
+  for (uint32_t i = 0; i < 8; i++) {
+    if (to_packets[i]) {
+      delete to_packets[i];
+      to_packets[i] = nullptr;
+    }
+  }
+  LList<SBuffer*> * queues[2] = { &queue_high, &queue_low };
+  for (auto queue : queues) {
+    for (auto & buf : *queue) { delete buf; }
+    queue->reset();
+  }
+  to_send = to_end = to_ack = from_ack = 0;
+  ack_pending = false;
+  rejecting = false;
+  sent_mask = 0;
+  retx_mask = 0;
+  timeouts = 0;
+  t_rx_ack = EZSP_ASH_T_RX_ACK_INIT;
+}
+
 
 EZSP_Serial_t EZSP_Serial;
 
@@ -507,41 +553,39 @@ void ZigbeeEZSPSendCmd(const uint8_t *msg, size_t len) {
 }
 
 // Send an EZSP DATA frame, automatically calculating the correct frame numbers
+// The pending ACK is piggy-backed, and the reTx flag is set if the frame was already sent
 void ZigbeeEZSPSendDATA_frm(bool send_cancel, uint8_t to_frm, uint8_t from_ack) {
   SBuffer *buf = EZSP_Serial.to_packets[to_frm];
   if (!buf) {
-    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: Buffer for packet %d is not allocated"), EZSP_Serial.to_send);
+    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: Buffer for packet %d is not allocated"), to_frm);
     return;
   }
 
   uint8_t control_byte = ((to_frm & 0x07) << 4) + (from_ack & 0x07);
+  if (EZSP_Serial.sent_mask & (1 << to_frm)) {
+    control_byte |= 0x08;         // reTx
+    EZSP_Serial.retx_mask |= (1 << to_frm);
+  }
   buf->set8(0, control_byte);      // change control_byte
   // send
   ZigbeeEZSPSendRaw(buf->getBuffer(), buf->len(), send_cancel);
+  EZSP_Serial.sent_mask |= (1 << to_frm);
+  EZSP_Serial.sent_time[to_frm] = millis();
+  EZSP_Serial.ack_pending = false;
 }
 
-// Send an EZSP DATA frame, automatically calculating the correct frame numbers
+// Send an EZSP DATA frame, frame numbers are allocated when there is room in the window
+// Frames sent from deferred timers are background traffic and yield to other frames
 void ZigbeeEZSPSendDATA(const uint8_t *msg, size_t len) {
   // prepare buffer by adding 1 byte prefix
   SBuffer *buf = new SBuffer(len+1);    // prepare for control_byte prefix
   buf->add8(0x00);                       // placeholder for control_byte
   buf->addBuffer(msg, len);
-  //
-  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: adding packet to_send, to_ack:%d, to_send:%d, to_end:%d"),
-                                  EZSP_Serial.to_ack, EZSP_Serial.to_send, EZSP_Serial.to_end);
-  uint8_t to_frm = EZSP_Serial.to_end;
-  if (EZSP_Serial.to_packets[to_frm]) {
-    delete EZSP_Serial.to_packets[to_frm];
-    EZSP_Serial.to_packets[to_frm] = nullptr;
-  }
-  EZSP_Serial.to_packets[to_frm] = buf;
-  EZSP_Serial.to_end = (to_frm + 1) & 0x07;   // move cursor
 
-  // ZigbeeEZSPSendDATA_frm(send_cancel, to_frm, EZSP_Serial.from_ack);
-
-  // increment to_frame
-  //EZSP_Serial.to_ack = (EZSP_Serial.to_ack + 1) & 0x07;
-  //EZSP_Serial.to_frm = (EZSP_Serial.to_frm + 1) & 0x07;
+  LList<SBuffer*> & queue = zigbee.background ? EZSP_Serial.queue_low : EZSP_Serial.queue_high;
+  queue.addToLast() = buf;
+  AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: adding packet to %s queue, to_ack:%d, to_send:%d, to_end:%d"),
+                                  zigbee.background ? PSTR("low") : PSTR("high"), EZSP_Serial.to_ack, EZSP_Serial.to_send, EZSP_Serial.to_end);
 }
 
 // Receive a high-level EZSP command/response, starting with 16-bits frame ID
@@ -610,17 +654,40 @@ void ZigbeeProcessInputEZSP(SBuffer &buf) {
 // Check if we advanced in the ACKed frames, and free from memory packets acknowledged
 void EZSP_HandleAck(uint8_t new_ack) {
   if (EZSP_Serial.to_ack != new_ack) {      // new ack receveid
+    // ignore an ACK for frames that were never sent, it would free frames in flight
+    if (((new_ack - EZSP_Serial.to_ack) & 0x07) > EZSP_Serial.inFlight()) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: ignoring ack %d, to_ack:%d, to_end:%d"), new_ack, EZSP_Serial.to_ack, EZSP_Serial.to_end);
+      return;
+    }
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: new ack/data received, was %d now %d"), EZSP_Serial.to_ack, new_ack);
+    int32_t rtt = -1;
     uint32_t i = EZSP_Serial.to_ack;
     do {
       if (EZSP_Serial.to_packets[i]) {
         delete EZSP_Serial.to_packets[i];
         EZSP_Serial.to_packets[i] = nullptr;
       }
-      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: freeing packet %d from memory"), i);
+      uint8_t frm_bit = 1 << i;
+      // only frames sent once give a reliable round-trip time
+      if ((EZSP_Serial.sent_mask & frm_bit) && !(EZSP_Serial.retx_mask & frm_bit)) {
+        rtt = TimePassedSince(EZSP_Serial.sent_time[i]);
+      }
+      EZSP_Serial.sent_mask &= ~frm_bit;
+      EZSP_Serial.retx_mask &= ~frm_bit;
       i = (i + 1) & 0x07;
     } while (i != new_ack);
     EZSP_Serial.to_ack = new_ack;
+    // a frame may have been acked while being resent after a NAK or a timeout
+    if (((EZSP_Serial.to_send - EZSP_Serial.to_ack) & 0x07) > EZSP_Serial.inFlight()) {
+      EZSP_Serial.to_send = EZSP_Serial.to_ack;
+    }
+    EZSP_Serial.timeouts = 0;
+
+    if (rtt >= 0) {
+      // t_rx_ack = 7/8 * t_rx_ack + 1/2 * rtt, as per ASH specification
+      uint32_t t_rx_ack = (EZSP_Serial.t_rx_ack * 7) / 8 + rtt / 2;
+      EZSP_Serial.t_rx_ack = tmin(tmax(t_rx_ack, EZSP_ASH_T_RX_ACK_MIN), EZSP_ASH_T_RX_ACK_MAX);
+    }
   }
 }
 
@@ -640,17 +707,15 @@ void ZigbeeProcessInputRaw(SBuffer &buf) {
       // NAK
       AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: Received NAK %d, to_ack:%d, to_send:%d, to_end:%d"),
                                   ack_num, EZSP_Serial.to_ack, EZSP_Serial.to_send, EZSP_Serial.to_end);
-      EZSP_Serial.to_send = ack_num;
-      AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: NAK, resending packet %d"), ack_num);
+      EZSP_HandleAck(ack_num);        // frames before ack_num were received
+      EZSP_Serial.to_send = EZSP_Serial.to_ack;
+      AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: NAK, resending packet %d"), EZSP_Serial.to_send);
     } else if (control_byte == 0xC1) {
 
       // RSTACK
       // received just after boot, either because of Power up, hardware reset or RST
       EZ_RSTACK(buf.get8(2));
-      EZSP_Serial.from_ack = 0;
-      EZSP_Serial.to_ack = 0;
-      EZSP_Serial.to_end = 0;
-      EZSP_Serial.to_send = 0;
+      EZSP_Serial.reset();        // frames sent or queued before reset are lost
 
       // pass it to state machine with a special 0xFFFE frame code (EZSP_RSTACK_ID)
       buf.set8(0, Z_B0(EZSP_rstAck));
@@ -675,11 +740,27 @@ void ZigbeeProcessInputRaw(SBuffer &buf) {
     uint8_t new_ack = control_byte & 0x07;
     EZSP_HandleAck(new_ack);
 
+    uint8_t frm_num = (control_byte >> 4) & 0x07;
+    if (frm_num != EZSP_Serial.from_ack) {
+      if (control_byte & 0x08) {
+        // retransmission of a frame already received, probably our ACK was lost
+        AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: ignoring duplicate frame %d"), frm_num);
+        EZSP_Serial.ack_pending = true;
+      } else if (!EZSP_Serial.rejecting) {
+        // a frame was lost, ask once for retransmission
+        AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: out of sequence frame %d, expected %d"), frm_num, EZSP_Serial.from_ack);
+        uint8_t nak_byte = 0xA0 | EZSP_Serial.from_ack;
+        ZigbeeEZSPSendRaw(&nak_byte, 1, false);
+        EZSP_Serial.rejecting = true;
+      }
+      return;
+    }
+    EZSP_Serial.rejecting = false;
+
     // MCU acknowledged the correct frame
-    // we acknowledge the frame too
-    EZSP_Serial.from_ack = ((control_byte >> 4) + 1) & 0x07;
-    uint8_t ack_byte = 0x80 | EZSP_Serial.from_ack;
-    ZigbeeEZSPSendRaw(&ack_byte, 1, false);   // send a 1-byte ACK
+    // we acknowledge the frame too, at next output loop either piggy-backed on a DATA frame or with an ACK frame
+    EZSP_Serial.from_ack = (frm_num + 1) & 0x07;
+    EZSP_Serial.ack_pending = true;
 
     // build the EZSP frame
     // remove first byte
@@ -870,15 +951,52 @@ void ZigbeeZCLSend_Raw(const ZCLFrame &zcl) {
 // Used only with EZSP, as there is no replay of procotol control with ZNP
 void ZigbeeOutputLoop(void) {
 #ifdef USE_ZIGBEE_EZSP
-  // while (EZSP_Serial.to_send != EZSP_Serial.to_end) {
-  if (EZSP_Serial.to_send != EZSP_Serial.to_end) {   // we send only one packet per tick to lower the chance of NAK
+  // if the oldest frame in flight was not acked in time, resend all frames in flight (go-back-N)
+  if ((EZSP_Serial.to_send != EZSP_Serial.to_ack) &&
+      (TimePassedSince(EZSP_Serial.sent_time[EZSP_Serial.to_ack]) >= (int32_t)EZSP_Serial.t_rx_ack)) {
+    EZSP_Serial.timeouts++;
+    if (EZSP_Serial.timeouts >= EZSP_ASH_ACK_TIMEOUTS) {
+      // link failed, as per ASH specification the NCP must be reset, and EZSP configured again from scratch
+      AddLog(LOG_LEVEL_ERROR, PSTR("ZIG: no ack after %d timeouts, restarting"), EZSP_Serial.timeouts);
+      EZ_ERROR(0x51);                  // ACK timeout
+      EZSP_Serial.reset();
+      zigbee.active = false;           // stop all zigbee activities
+      TasmotaGlobal.restart_flag = 2;  // same recovery as an ERROR frame received from the NCP
+      return;
+    }
+    AddLog(LOG_LEVEL_DEBUG, PSTR("ZIG: no ack after %d ms (%d), resending packet %d"), EZSP_Serial.t_rx_ack, EZSP_Serial.timeouts, EZSP_Serial.to_ack);
+    EZSP_Serial.t_rx_ack = tmin(EZSP_Serial.t_rx_ack * 2, EZSP_ASH_T_RX_ACK_MAX);
+    EZSP_Serial.to_send = EZSP_Serial.to_ack;
+  }
+
+  // allocate frame numbers to queued frames while there is room in the window
+  while (EZSP_Serial.inFlight() < EZSP_ASH_WINDOW) {
+    LList<SBuffer*> & queue = EZSP_Serial.queue_high.isEmpty() ? EZSP_Serial.queue_low : EZSP_Serial.queue_high;
+    if (queue.isEmpty()) { break; }
+    uint8_t to_frm = EZSP_Serial.to_end;
+    if (EZSP_Serial.to_packets[to_frm]) { delete EZSP_Serial.to_packets[to_frm]; }
+    EZSP_Serial.to_packets[to_frm] = *queue.head();
+    queue.remove(queue.head());
+    EZSP_Serial.sent_mask &= ~(1 << to_frm);
+    EZSP_Serial.retx_mask &= ~(1 << to_frm);
+    EZSP_Serial.to_end = (to_frm + 1) & 0x07;   // move cursor
+  }
+
+  // send all frames of the window not sent yet, each one carries the latest ACK
+  while (EZSP_Serial.to_send != EZSP_Serial.to_end) {
     AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("ZIG: Something to_send, to_ack:%d, to_send:%d, to_end:%d"),
                                   EZSP_Serial.to_ack, EZSP_Serial.to_send, EZSP_Serial.to_end);
-    // we have a frame waiting to be sent
     ZigbeeEZSPSendDATA_frm(true, EZSP_Serial.to_send, EZSP_Serial.from_ack);
     // increment sent counter
     EZSP_Serial.to_send = (EZSP_Serial.to_send + 1) & 0x07;
   }
+
+  // nothing to piggy-back the ACK on, send a 1-byte ACK
+  if (EZSP_Serial.ack_pending) {
+    uint8_t ack_byte = 0x80 | EZSP_Serial.from_ack;
+    ZigbeeEZSPSendRaw(&ack_byte, 1, false);
+    EZSP_Serial.ack_pending = false;
+  }
 #endif // USE_ZIGBEE_EZSP
 }
 
@@ -302,7 +302,7 @@ bool ZigbeeUploadXmodem(void) {
         ZbUpload.ota_step = ZBU_HARDWARE_RESET;
         return true;
       }
-      if (EZSP_Serial.to_send == EZSP_Serial.to_end) {
+      if (EZSP_Serial.idle()) {
         ZbUpload.bootloader = ZBU_SOFTWARE_RESET;
         XModem.timeout = millis() + (10 * 1000);  // Allow 10 seconds to receive EBL prompt
         XModem.delay = millis() + (2 * XMODEM_FLUSH_DELAY);
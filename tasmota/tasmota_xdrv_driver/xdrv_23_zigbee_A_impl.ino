@@ -20,6 +20,7 @@
 #ifdef USE_ZIGBEE
 
 #define XDRV_23                    23
+#define XDRV_23_FUNC               (XFUNC_LOOP | XFUNC_EVERY_50_MSECOND)
 
 // #define ZIGBEE_DOC    // enable special functions used for Zigbee documentation generation - generally not useful
 
@@ -1084,23 +1085,8 @@ void CmndZbBindState(void) {
 }
 
 void ZigbeeMapAllDevices(void) {
-  // we can't abort a mapping in progress
-  if (zigbee.mapping_in_progress) { return; }
-  // defer sending ZbMap to each device
-  zigbee_mapper.reset();    // clear all data in Zigbee mapper
-
-  const static uint32_t DELAY_ZBMAP = 2000;   // wait for 1s between commands
-  uint32_t wait_ms = DELAY_ZBMAP;
-  zigbee.mapping_in_progress = true;          // mark mapping in progress
-
-  zigbee_devices.setTimer(0x0000, 0, 0 /*wait_ms*/, 0, 0, Z_CAT_ALWAYS, 0 /* value = index */, &Z_Map);
-  for (const auto & device : zigbee_devices.getDevices()) {
-    zigbee_devices.setTimer(device.shortaddr, 0, wait_ms, 0, 0, Z_CAT_ALWAYS, 0 /* value = index */, &Z_Map);
-    wait_ms += DELAY_ZBMAP;
-  }
-  wait_ms += DELAY_ZBMAP*2;
-  zigbee_devices.setTimer(BAD_SHORTADDR, 0, wait_ms, 0, 0, Z_CAT_ALWAYS, 0 /* value = index */, &Z_Map);
-  zigbee.mapping_end_time = wait_ms + millis();
+  // routers are queried concurrently, only changed neighbour tables are collected if a map already exists
+  zigbee_mapper.start();
 }
 
 //
@@ -1302,7 +1288,7 @@ void CmndZbOccupancy(void) {
     Z_Data_PIR & pir = (Z_Data_PIR&) device.data.getByType(Z_Data_Type::Z_PIR);
     occupancy_time = strtol(p, nullptr, 10);
     pir.setTimeoutSeconds(occupancy_time);
-    zigbee_devices.dirty();
+    zigbee_devices.dirty(device);
   } else {
     const Z_Data_PIR & pir_found = (const Z_Data_PIR&) device.data.find(Z_Data_Type::Z_PIR);
     if (&pir_found != &z_data_unk) {
@@ -1372,7 +1358,7 @@ void CmndZbSave(void) {
   if (zigbee.init_phase) { ResponseCmndChar_P(PSTR(D_ZIGBEE_NOT_STARTED)); return; }
   switch (XdrvMailbox.payload) {
     case 2:       // save only data
-      hibernateAllData();
+      hibernateAllData(true);
       break;
 #ifdef Z_EEPROM_DEBUG
     case -10:
@@ -1828,7 +1814,7 @@ void CmndZbData(void) {
   if (strlen(XdrvMailbox.data) == 0) {
     // if empty, log values for all devices
     for (const auto & device : zigbee_devices.getDevices()) {
-      hibernateDeviceData(device);
+      hibernateDeviceData(device, true);
     }
   } else {
     // check if parameters contain a comma ','
@@ -1843,11 +1829,12 @@ void CmndZbData(void) {
       // set ZbData
       const SBuffer buf = SBuffer::SBufferFromHex(p, strlen(p));
       hydrateDeviceData(device, buf, 0, buf.len());
+      device.dataDirty();
     } else {
       // non-JSON, export current data
       // ZbData 0x1234
       // ZbData Device_Name
-      hibernateDeviceData(device);
+      hibernateDeviceData(device, true);
     }
   }
 
@@ -2491,6 +2478,7 @@ bool Xdrv23(uint32_t function) {
       case FUNC_EVERY_50_MSECOND:
         if (!zigbee.init_phase) {
           zigbee_devices.runTimer();
+          zigbee_mapper.run();
         }
         break;
       case FUNC_LOOP:
@@ -2529,7 +2517,7 @@ bool Xdrv23(uint32_t function) {
         break;
       case FUNC_SAVE_BEFORE_RESTART:
         if (!zigbee.init_phase) {
-          hibernateAllData();
+          hibernateAllData(true);
           restoreDumpAllDevices();
         }
         break;
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_24                    24
+#define XDRV_24_FUNC               (XFUNC_EVERY_100_MSECOND)
 
 struct BUZZER {
   uint32_t tune = 0;
@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_25                    25
+#define XDRV_25_FUNC               XFUNC_NONE
 
 #include <A4988_Stepper.h>
 
@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_26              26
+#define XDRV_26_FUNC         (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 
 const uint32_t ARILUX_RF_TIME_AVOID_DUPLICATE = 1000;  // Milliseconds
 
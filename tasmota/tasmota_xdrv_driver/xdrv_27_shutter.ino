@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_27            27
+#define XDRV_27_FUNC       (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 #ifndef SHUTTER_STEPPER
   #define SHUTTER_STEPPER
 #endif
@@ -75,6 +75,7 @@
 \*********************************************************************************************/
 
 #define XDRV_28              28
+#define XDRV_28_FUNC         (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_100_MSECOND)
 #define XI2C_02              2      // See I2CDEVICES.md
 
 // PCF8574 address range from 0x20 to 0x26
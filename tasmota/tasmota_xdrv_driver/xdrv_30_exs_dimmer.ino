@@ -27,6 +27,7 @@
 //#define EXS_DEBUG
 
 #define XDRV_30 30
+#define XDRV_30_FUNC (XFUNC_LOOP)
 
 #define EXS_GATE_1_ON 0x20
 #define EXS_GATE_1_OFF 0x21
@@ -38,6 +38,7 @@
 \*********************************************************************************************/
 
 #define XDRV_33             33
+#define XDRV_33_FUNC        XFUNC_NONE
 
 #include <RF24.h>
 
@@ -45,6 +45,7 @@
 \*********************************************************************************************/
 
 #define XDRV_34              34
+#define XDRV_34_FUNC         XFUNC_NONE
 #define XI2C_44              44          // See I2CDEVICES.md
 
 #ifndef WEMOS_MOTOR_V1_ADDR
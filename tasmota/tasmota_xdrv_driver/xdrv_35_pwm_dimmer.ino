@@ -35,6 +35,7 @@
 \*********************************************************************************************/
 
 #define XDRV_35             35
+#define XDRV_35_FUNC        (XFUNC_EVERY_SECOND)
 #define MAX_PWM_DIMMER_KEYS 3
 
 const char kPWMDimmerCommands[] PROGMEM = "|"  // No prefix
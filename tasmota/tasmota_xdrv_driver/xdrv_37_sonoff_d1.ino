@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XDRV_37                   37
+#define XDRV_37_FUNC              XFUNC_NONE
 
 struct SONOFFD1 {
   uint8_t receive_len = 0;
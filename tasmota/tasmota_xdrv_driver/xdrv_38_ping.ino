@@ -20,6 +20,7 @@
 #ifdef USE_PING
 
 #define XDRV_38                    38
+#define XDRV_38_FUNC               (XFUNC_EVERY_250_MSECOND)
 
 #include "lwip/icmp.h"
 #include "lwip/inet_chksum.h"
@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XDRV_40                    40
+#define XDRV_40_FUNC               (XFUNC_EVERY_SECOND)
 
 #ifndef TELEGRAM_LOOP_WAIT
 #define TELEGRAM_LOOP_WAIT         10   // Seconds
@@ -35,6 +35,7 @@
 #include <layer3.h>
 
 #define XDRV_42           42
+#define XDRV_42_FUNC      (XFUNC_LOOP)
 
 #define USE_I2S_SAY
 #define USE_I2S_SAY_TIME
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_44			44
+#define XDRV_44_FUNC (XFUNC_LOOP | XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_200_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #ifndef nitems
 #define nitems(_a)		(sizeof((_a)) / sizeof((_a)[0]))
@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XDRV_45                     45
+#define XDRV_45_FUNC                (XFUNC_EVERY_SECOND)
 #define XNRG_31                     31
 
 // #define SHELLY_DIMMER_DEBUG
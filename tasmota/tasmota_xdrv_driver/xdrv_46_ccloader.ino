@@ -41,6 +41,7 @@
 \*********************************************************************************************/
 
 #define XDRV_46             46
+#define XDRV_46_FUNC        (XFUNC_EVERY_100_MSECOND)
 
 // Start addresses on DUP (Increased buffer size improves performance)
 #define CCL_ADDR_BUF0                   0x0000 // Buffer (512 bytes)
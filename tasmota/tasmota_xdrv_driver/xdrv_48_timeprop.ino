@@ -325,6 +325,7 @@ void ShowValues(void) {
 \*********************************************************************************************/
 
 #define XDRV_48       48
+#define XDRV_48_FUNC  (XFUNC_EVERY_SECOND)
 
 bool Xdrv48(uint32_t function) {
   bool result = false;
@@ -515,6 +515,7 @@ void PIDRun(void) {
 \*********************************************************************************************/
 
 #define XDRV_49       49
+#define XDRV_49_FUNC  (XFUNC_EVERY_SECOND)
 
 bool Xdrv49(uint32_t function) {
   bool result = false;
@@ -58,6 +58,7 @@ ftp       start stop ftp server: 0 = OFF, 1 = SDC, 2 = FlashFile
 \*********************************************************************************************/
 
 #define XDRV_50           50
+#define XDRV_50_FUNC      (XFUNC_LOOP)
 
 #define UFS_TNONE         0
 #define UFS_TSDC          1
@@ -61,6 +61,7 @@
 \*********************************************************************************************/
 
 #define XDRV_51                   51
+#define XDRV_51_FUNC              (XFUNC_EVERY_50_MSECOND)
 
 #define BS814_KEYS_MAX            4         // no. of keys supported
 
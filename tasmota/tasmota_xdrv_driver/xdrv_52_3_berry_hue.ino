@@ -205,10 +205,9 @@ char* be_hue_light_full_state(int32_t id, class LightStateClass* l, const char*
   static const char FULL_STATE[] = "{\"state\":%s%s";
 
   char* buf_state = be_hue_light_state(l);
-  char* buf_suffix = HueLightStatus2Generic(name, model, manuf, GetHueDeviceId(id).c_str());
+  const char* buf_suffix = HueLightStatus2Generic(name, model, manuf, GetHueDeviceId(id).c_str());
   char* buf = ext_snprintf_malloc_P(FULL_STATE, buf_state, buf_suffix);
   free(buf_state);
-  free(buf_suffix);
   return buf;   // caller will call `free()` on it
 }
 
@@ -188,7 +188,7 @@ extern "C" {
       WSHeaderSend();
       Webserver->setContentLength(CONTENT_LENGTH_UNKNOWN);
       Webserver->send(httpcode, mimetype, "");
-      Web.chunk_buffer = "";
+      _WSContentInit();
       be_return_nil(vm);
     }
     be_raise(vm, kTypeError, nullptr);
@@ -21,6 +21,7 @@
 #ifdef USE_BERRY
 
 #define XDRV_52             52
+#define XDRV_52_FUNC        (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <berry.h>
 extern "C" {
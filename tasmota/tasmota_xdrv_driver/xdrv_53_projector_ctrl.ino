@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XDRV_53			53
+#define XDRV_53_FUNC (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 #if !defined(USE_PROJECTOR_CTRL_NEC) && !defined(USE_PROJECTOR_CTRL_OPTOMA) && !defined(USE_PROJECTOR_CTRL_ACER)
 #define USE_PROJECTOR_CTRL_NEC                 // Use at least one projector
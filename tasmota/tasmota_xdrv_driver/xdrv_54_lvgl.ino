@@ -25,6 +25,7 @@
 #include "tasmota_lvgl_assets.h"    // force compilation of assets
 
 #define XDRV_54             54
+#define XDRV_54_FUNC        (XFUNC_LOOP)
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
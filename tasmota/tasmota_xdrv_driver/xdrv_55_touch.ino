@@ -41,6 +41,7 @@
 #include <renderer.h>
 
 #define XDRV_55             55
+#define XDRV_55_FUNC        (XFUNC_EVERY_100_MSECOND)
 
 // Codes for gestures, when supported by the Touch Screen controller
 enum TS_Gesture {
@@ -13,6 +13,7 @@
 \*********************************************************************************************/
 
 #define XDRV_56             56
+#define XDRV_56_FUNC        (XFUNC_EVERY_SECOND)
 
 #ifdef USE_GPS                     // GPS driver has it's own NTP server
 #undef RTC_NTP_SERVER              // Disable NTP server (+0k8 code)
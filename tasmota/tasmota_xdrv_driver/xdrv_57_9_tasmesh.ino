@@ -37,6 +37,7 @@
 \*********************************************************************************************/
 
 #define XDRV_57             57
+#define XDRV_57_FUNC        (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 /*********************************************************************************************\
  * Callbacks
@@ -56,6 +56,7 @@ Backlog RgxSSID rangeextender ; RgxPassword securepassword ; RgxAddress 192.168.
 \*********************************************************************************************/
 
 #define XDRV_58 58
+#define XDRV_58_FUNC (XFUNC_EVERY_SECOND)
 
 // Memory usage at 512: Heap from 30136 to 17632: 12504
 // Memory usage at 128: Heap from 30136 to 26848: 3288
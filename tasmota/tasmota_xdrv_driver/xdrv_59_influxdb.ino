@@ -41,16 +41,57 @@
  * IfxSensor   - Set Influxdb sensor logging off (0) or on (1)
  * IfxRP       - Set Influxdb retention policy
  * IfxLog      - Set Influxdb logging level (4 = default)
+ * IfxBatch    - Set Influxdb batch flush time in seconds (0 = send on next tick)
  *
- * The following triggers result in automatic influxdb numeric feeds without appended time:
+ * The following triggers result in automatic influxdb numeric feeds with appended time (if time is synced):
  * - this driver initiated state message
  * - this driver initiated teleperiod data
  * - power commands
+ *
+ * Points are collected in a batch which is sent when it reaches INFLUXDB_BATCH_SIZE bytes or
+ * when it is older than IfxBatch seconds. Only one request is in flight at a time.
+ * On ESP32 the request is made by a worker task so an unreachable server does not stall the
+ * main loop, and with PSRAM the batch is sent gzip compressed (deflate from the ROM miniz).
+ * On ESP8266 the request blocks the loop for at most INFLUXDB_TIMEOUT ms.
+ * With USE_UFILESYS batches that could not be delivered are spooled to a two segment ring
+ * file on the flash filesystem (oldest segment dropped when full) and replayed once the
+ * server accepts data again.
 \*********************************************************************************************/
 
 #define XDRV_59            59
+#define XDRV_59_FUNC       (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #define INFLUXDB_INITIAL   7             // Initial number of seconds after wifi connect keeping in mind sensor initialization
+#define INFLUXDB_RETRY_MAX 128           // Max number of seconds between retries after failed requests
+
+#ifndef INFLUXDB_BATCH_TIME
+#define INFLUXDB_BATCH_TIME 10           // [IfxBatch] Max number of seconds a point is kept in the batch before sending
+#endif
+#ifndef INFLUXDB_BATCH_SIZE
+#ifdef ESP8266
+#define INFLUXDB_BATCH_SIZE 1024         // Batch is sent when it reaches this number of bytes
+#else
+#define INFLUXDB_BATCH_SIZE 4096         // Batch is sent when it reaches this number of bytes
+#endif
+#endif
+#ifndef INFLUXDB_SPOOL_SIZE
+#ifdef ESP8266
+#define INFLUXDB_SPOOL_SIZE 16384        // Max size of each of the two spool segments in bytes
+#else
+#define INFLUXDB_SPOOL_SIZE 65536        // Max size of each of the two spool segments in bytes
+#endif
+#endif
+#define INFLUXDB_SPOOL_FILE "/influxdb%d.spl"
+#ifndef INFLUXDB_TIMEOUT
+#define INFLUXDB_TIMEOUT   2000          // Max number of ms to wait for connect and each reply read
+#endif
+#ifdef ESP32
+#ifndef INFLUXDB_GZIP
+#define INFLUXDB_GZIP      1             // Gzip batches if PSRAM is available for the deflate state (0 = off)
+#endif
+#define INFLUXDB_GZIP_PROBES 16          // Deflate match search effort, low values are faster
+#define INFLUXDB_TASK_STACK 10240        // Worker task stack, enough for a TLS handshake
+#endif
 
 #ifndef INFLUXDB_STATE
 #define INFLUXDB_STATE     0             // [Ifx] Influxdb initially Off (0) or On (1)
@@ -82,6 +123,13 @@ static const char UninitializedMessage[] PROGMEM = "Unconfigured instance";
 static const char RetryAfter[] = "Retry-After";
 static const char TransferEncoding[] = "Transfer-Encoding";
 
+#if defined(ESP32) && INFLUXDB_GZIP
+#include "rom/miniz.h"                  // Deflate from ROM, as lib/libesp32_eink/epdiy
+#endif
+
+enum InfluxDbSources { INFLUXDB_FROM_BATCH, INFLUXDB_FROM_SPOOL, INFLUXDB_FROM_DROPPED };
+enum InfluxDbPostStates { INFLUXDB_POST_IDLE, INFLUXDB_POST_BUSY, INFLUXDB_POST_DONE };
+
 #if defined(ESP32) && defined(USE_WEBCLIENT_HTTPS)
   HTTPClientLight *IFDBhttpClient = nullptr;
 #else
@@ -93,12 +141,25 @@ struct {
   String _serverUrl;                     // Connection info
   String _writeUrl;                      // Cached full write url
   String _lastErrorResponse;             // Server reponse or library error message for last failed request
+  String batch;                          // Line protocol points waiting to be sent
+  String sending;                        // Points in flight, not touched by the loop until the request is done
   uint32_t _lastRequestTime = 0;         // Last time in ms we made a request to server
+  uint32_t batch_time = 0;               // Time in ms the first point was added to the batch
+  uint32_t retry_time = 0;               // Time in ms before which no new request is made after a failure
+  uint32_t spool_pos = 0;                // Replay position in the oldest spool segment
+  uint32_t dropped = 0;                  // Number of points lost due to overflow or rejected by the server
   int interval = 0;
   int _lastStatusCode = 0;               // HTTP status code of last request to server
   int _lastRetryAfter = 0;               // Store retry timeout suggested by server after last request
   uint8_t log_level = LOG_LEVEL_DEBUG_MORE;
+  uint8_t retry_delay = 0;               // Seconds to wait after the next failure, doubles up to INFLUXDB_RETRY_MAX
+  uint8_t spool_write = 0;               // Spool segment being appended to, the other one is the oldest
+  uint8_t sending_from = INFLUXDB_FROM_BATCH;  // Origin of the points in flight
+  volatile uint8_t post_state = INFLUXDB_POST_IDLE;  // Set to INFLUXDB_POST_DONE by the ESP32 worker task
   bool _connectionReuse;                 // true if HTTP connection should be kept open. Usable for frequent writes. Default false
+  bool batch_untimed = false;            // Batch contains points without timestamp which can not be spooled
+  bool sending_untimed = false;
+  bool spool_init = false;
   bool init = false;
 } IFDB;
 
@@ -145,6 +206,7 @@ bool InfluxDbParameterInit(void) {
     IFDB._writeUrl += UrlEncode(SettingsText(SET_INFLUXDB_ORG));
     IFDB._writeUrl += "&bucket=";
     IFDB._writeUrl += UrlEncode(SettingsText(SET_INFLUXDB_BUCKET));
+    IFDB._writeUrl += "&precision=s";
   } else {
     IFDB._writeUrl += "/write?db=";
     IFDB._writeUrl += UrlEncode(SettingsText(SET_INFLUXDB_BUCKET));
@@ -153,6 +215,7 @@ bool InfluxDbParameterInit(void) {
       IFDB._writeUrl += "&rp=";
       IFDB._writeUrl += UrlEncode(SettingsText(SET_INFLUXDB_RP));
     }
+    IFDB._writeUrl += "&precision=s";
   }
   AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Url %s"), IFDB._writeUrl.c_str());
 
@@ -171,6 +234,12 @@ bool InfluxDbInit(void) {
   }
 #endif
   IFDBhttpClient->setReuse(IFDB._connectionReuse);
+  IFDBhttpClient->setTimeout(INFLUXDB_TIMEOUT);
+#ifdef ESP32
+  IFDBhttpClient->setConnectTimeout(INFLUXDB_TIMEOUT);
+#else
+  IFDBwifiClient->setTimeout(INFLUXDB_TIMEOUT);       // Also bounds the connect
+#endif
   char server[32];
   snprintf_P(server, sizeof(server), PSTR("Tasmota/%s (%s)"), TasmotaGlobal.version, GetDeviceHardware().c_str());
   IFDBhttpClient->setUserAgent(server);
@@ -249,7 +318,49 @@ bool InfluxDbValidateConnection(void) {
   return IFDB._lastStatusCode == 200;
 }
 
-int InfluxDbPostData(const char *data) {
+#if defined(ESP32) && INFLUXDB_GZIP
+uint32_t InfluxDbCrc32(const uint8_t *data, uint32_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (len--) {
+    crc ^= *data++;
+    for (uint32_t i = 0; i < 8; i++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+uint8_t *InfluxDbGzip(const char *data, uint32_t len, uint32_t *gzip_len) {
+  // Return a malloced gzip member (RFC 1952) or nullptr if it would not be smaller than the text
+  if (!UsePSRAM() || (len < 64)) { return nullptr; }  // The deflate state alone is over 100k
+  tdefl_compressor *deflate = (tdefl_compressor*)special_malloc(sizeof(tdefl_compressor));
+  if (!deflate) { return nullptr; }
+  uint8_t *gzip = (uint8_t*)special_malloc(len);
+  if (gzip) {
+    size_t in_size = len;
+    size_t out_size = len - 18;          // Room left after header and trailer
+    tdefl_init(deflate, nullptr, nullptr, INFLUXDB_GZIP_PROBES);  // Raw deflate, no zlib header
+    if ((TDEFL_STATUS_DONE == tdefl_compress(deflate, data, &in_size, gzip +10, &out_size, TDEFL_FINISH)) && (in_size == len)) {
+      static const uint8_t header[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 3 };  // Deflate, no name, no time, Unix
+      memcpy(gzip, header, sizeof(header));
+      uint32_t crc = InfluxDbCrc32((const uint8_t*)data, len);
+      uint8_t *trailer = gzip +10 + out_size;
+      for (uint32_t i = 0; i < 4; i++) {
+        trailer[i] = crc >> (i * 8);
+        trailer[i +4] = len >> (i * 8);
+      }
+      *gzip_len = out_size + 18;
+    } else {
+      free(gzip);
+      gzip = nullptr;
+    }
+  }
+  free(deflate);
+  return gzip;
+}
+#endif  // ESP32 && INFLUXDB_GZIP
+
+int InfluxDbPostData(const char *data, uint32_t len) {
 #if defined(ESP32) && defined(USE_WEBCLIENT_HTTPS)
   if (!InfluxDbInit()) {
 #else
@@ -266,14 +377,25 @@ int InfluxDbPostData(const char *data) {
     if (!IFDBhttpClient->begin(*IFDBwifiClient, IFDB._writeUrl)) {
 #endif
       AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Begin failed"));
-      return false;
+      IFDB._lastStatusCode = 0;
+      return 0;
     }
 
-    Trim((char*)data);  // Remove trailing \n
-    AddLog(IFDB.log_level, PSTR("IFX: Sending\n%s"), data);
+    while (len && ('\n' == data[len -1])) { len--; }  // Remove trailing \n without touching data
+    AddLog(IFDB.log_level, PSTR("IFX: Sending %d bytes\n%.*s"), len, len, data);
     IFDBhttpClient->addHeader(F("Content-Type"), F("text/plain"));
     InfluxDbBeforeRequest();
-    IFDB._lastStatusCode = IFDBhttpClient->POST((uint8_t*)data, strlen(data));
+#if defined(ESP32) && INFLUXDB_GZIP
+    uint32_t gzip_len;
+    uint8_t *gzip = InfluxDbGzip(data, len, &gzip_len);
+    if (gzip) {
+      AddLog(IFDB.log_level, PSTR("IFX: Gzipped to %d bytes"), gzip_len);
+      IFDBhttpClient->addHeader(F("Content-Encoding"), F("gzip"));
+      IFDB._lastStatusCode = IFDBhttpClient->POST(gzip, gzip_len);
+      free(gzip);
+    } else
+#endif  // ESP32 && INFLUXDB_GZIP
+    IFDB._lastStatusCode = IFDBhttpClient->POST((uint8_t*)data, len);
     AddLog(IFDB.log_level, PSTR("IFX: POST statusCode %d"), IFDB._lastStatusCode);
     InfluxDbAfterRequest(204, true);
     IFDBhttpClient->end();
@@ -281,6 +403,268 @@ int InfluxDbPostData(const char *data) {
   return IFDB._lastStatusCode;
 }
 
+/*********************************************************************************************\
+ * Batching and spooling
+\*********************************************************************************************/
+
+bool InfluxDbRetryable(int status_code) {
+  // Connection errors, rate limiting and server errors are worth retrying, other errors are final
+  return (status_code <= 0) || (429 == status_code) || (status_code >= 500);
+}
+
+void InfluxDbRequestDone(bool success) {
+  if (success) {
+    IFDB.retry_delay = 0;
+    IFDB.retry_time = 0;
+  } else {
+    uint32_t delay_sec = (IFDB._lastRetryAfter > 0) ? IFDB._lastRetryAfter : IFDB.retry_delay;
+    if (delay_sec > INFLUXDB_RETRY_MAX) { delay_sec = INFLUXDB_RETRY_MAX; }
+    IFDB.retry_time = millis() + (delay_sec * 1000);
+    IFDB.retry_delay = (IFDB.retry_delay) ? tmin(IFDB.retry_delay * 2, INFLUXDB_RETRY_MAX) : 1;
+  }
+}
+
+#ifdef USE_UFILESYS
+void InfluxDbSpoolName(char *fname, uint32_t segment) {
+  snprintf_P(fname, 16, PSTR(INFLUXDB_SPOOL_FILE), segment);
+}
+
+uint32_t InfluxDbSpoolFileSize(const char *fname) {
+  return (ffsp->exists(fname)) ? TfsFileSize(fname) : 0;
+}
+
+void InfluxDbSpoolInit(void) {
+  // After restart continue appending to the smallest segment, replay starts at the beginning
+  char fname0[16];
+  char fname1[16];
+  InfluxDbSpoolName(fname0, 0);
+  InfluxDbSpoolName(fname1, 1);
+  IFDB.spool_write = (InfluxDbSpoolFileSize(fname1) < InfluxDbSpoolFileSize(fname0)) ? 1 : 0;
+  IFDB.spool_pos = 0;
+  IFDB.spool_init = true;
+}
+
+uint32_t InfluxDbSpoolSize(void) {
+  if (!ffs_type) { return 0; }
+  char fname[16];
+  InfluxDbSpoolName(fname, 0);
+  uint32_t size = InfluxDbSpoolFileSize(fname);
+  InfluxDbSpoolName(fname, 1);
+  size += InfluxDbSpoolFileSize(fname);
+  return (size > IFDB.spool_pos) ? size - IFDB.spool_pos : 0;
+}
+
+bool InfluxDbSpoolWrite(const char *data, uint32_t len) {
+  if (!ffs_type) { return false; }
+  if (!IFDB.spool_init) { InfluxDbSpoolInit(); }
+
+  char fname[16];
+  InfluxDbSpoolName(fname, IFDB.spool_write);
+  if (InfluxDbSpoolFileSize(fname) + len > INFLUXDB_SPOOL_SIZE) {
+    // Segment full, switch to the other one dropping its (oldest) content
+    IFDB.spool_write ^= 1;
+    InfluxDbSpoolName(fname, IFDB.spool_write);
+    if (ffsp->exists(fname)) {
+      AddLog(LOG_LEVEL_INFO, PSTR("IFX: Spool full, oldest points dropped"));
+      ffsp->remove(fname);
+      IFDB.spool_pos = 0;                // Replay was reading the dropped segment
+      if (INFLUXDB_FROM_SPOOL == IFDB.sending_from) {
+        IFDB.sending_from = INFLUXDB_FROM_DROPPED;  // Do not advance into the next segment when done
+      }
+    }
+  }
+  File file = ffsp->open(fname, FS_FILE_APPEND);
+  if (!file) { return false; }
+  bool result = (file.write((const uint8_t*)data, len) == len);
+  file.close();
+  AddLog(IFDB.log_level, PSTR("IFX: Spooled %d bytes"), len);
+  return result;
+}
+
+uint32_t InfluxDbSpoolOldest(char *fname) {
+  uint32_t segment = IFDB.spool_write ^ 1;
+  InfluxDbSpoolName(fname, segment);
+  if (!ffsp->exists(fname)) {
+    segment = IFDB.spool_write;
+    InfluxDbSpoolName(fname, segment);
+  }
+  return segment;
+}
+
+bool InfluxDbSpoolReplay(void) {
+  // Load one chunk of complete lines from the oldest segment into IFDB.sending
+  if (!ffs_type) { return false; }
+  if (!IFDB.spool_init) { InfluxDbSpoolInit(); }
+
+  char fname[16];
+  InfluxDbSpoolOldest(fname);
+  File file = ffsp->open(fname, "r");
+  if (!file) { return false; }
+  uint32_t size = file.size();
+  if (IFDB.spool_pos >= size) {
+    file.close();
+    ffsp->remove(fname);
+    IFDB.spool_pos = 0;
+    return false;
+  }
+  uint32_t len = tmin(size - IFDB.spool_pos, INFLUXDB_BATCH_SIZE);
+  char *data = (char*)malloc(len +1);
+  if (!data) {
+    file.close();
+    return false;
+  }
+  file.seek(IFDB.spool_pos);
+  len = file.read((uint8_t*)data, len);
+  file.close();
+  while (len && (data[len -1] != '\n')) { len--; }  // Only complete lines
+  data[len] = '\0';
+  if (0 == len) {
+    // Corrupt segment without line ends
+    ffsp->remove(fname);
+    IFDB.spool_pos = 0;
+  } else {
+    IFDB.sending = data;
+  }
+  free(data);
+  return (len > 0);
+}
+
+void InfluxDbSpoolSent(uint32_t len) {
+  // Chunk accepted or rejected for good, move past it
+  char fname[16];
+  InfluxDbSpoolOldest(fname);
+  IFDB.spool_pos += len;
+  if (IFDB.spool_pos >= InfluxDbSpoolFileSize(fname)) {
+    ffsp->remove(fname);
+    IFDB.spool_pos = 0;
+  }
+}
+#endif  // USE_UFILESYS
+
+void InfluxDbDrop(const String &lines) {
+  uint32_t points = 0;
+  for (uint32_t i = 0; i < lines.length(); i++) {
+    if ('\n' == lines[i]) { points++; }
+  }
+  IFDB.dropped += points;
+  AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Dropped %d points"), points);
+}
+
+void InfluxDbBatchClear(bool spool) {
+  // Keep unsent points with a timestamp for later if possible
+  if (!IFDB.batch.length()) { return; }
+  bool spooled = false;
+#ifdef USE_UFILESYS
+  if (spool && !IFDB.batch_untimed) {
+    spooled = InfluxDbSpoolWrite(IFDB.batch.c_str(), IFDB.batch.length());
+  }
+#endif  // USE_UFILESYS
+  if (!spooled) {
+    InfluxDbDrop(IFDB.batch);
+  }
+  IFDB.batch = "";
+  IFDB.batch_untimed = false;
+}
+
+void InfluxDbAddPoint(const char *line) {
+  // temperature,device=demo,sensor=ds18b20 value=22.63 1697040000
+  if (IFDB.batch.length() >= INFLUXDB_BATCH_SIZE) {
+    InfluxDbBatchClear(true);  // Not sent in time (network down or server failing)
+  }
+  if (!IFDB.batch.length()) {
+    IFDB.batch_time = millis();
+  }
+  IFDB.batch += line;
+  if (RtcTime.valid) {
+    IFDB.batch += ' ';
+    IFDB.batch += UtcTime();
+  } else {
+    IFDB.batch_untimed = true;
+  }
+  IFDB.batch += '\n';
+}
+
+void InfluxDbSendDone(int status_code) {
+  // Account for the points in flight once the server answered or the request failed
+  bool success = (204 == status_code);
+  bool final = success || !InfluxDbRetryable(status_code);
+  InfluxDbRequestDone(success);
+  if (INFLUXDB_FROM_BATCH == IFDB.sending_from) {
+    if (!final) {
+      // Retryable failures go back in front of the batch until it overflows to the spool
+      IFDB.sending += IFDB.batch;
+      IFDB.batch = IFDB.sending;
+      IFDB.batch_untimed |= IFDB.sending_untimed;
+    } else if (!success) {
+      InfluxDbDrop(IFDB.sending);        // Rejected by server, retrying will not help
+    }
+  }
+#ifdef USE_UFILESYS
+  else if ((INFLUXDB_FROM_SPOOL == IFDB.sending_from) && final) {
+    InfluxDbSpoolSent(IFDB.sending.length());
+  }
+#endif  // USE_UFILESYS
+  IFDB.sending = "";
+}
+
+#ifdef ESP32
+void InfluxDbPostTask(void *arg) {
+  // Only this task uses the http client and IFDB.sending until post_state is INFLUXDB_POST_DONE
+  InfluxDbPostData(IFDB.sending.c_str(), IFDB.sending.length());
+  IFDB.post_state = INFLUXDB_POST_DONE;
+  vTaskDelete(nullptr);
+}
+#endif  // ESP32
+
+void InfluxDbSend(uint32_t source) {
+  IFDB.sending_from = source;
+#ifdef ESP32
+  IFDB.post_state = INFLUXDB_POST_BUSY;
+  if (xTaskCreate(InfluxDbPostTask, "IFX", INFLUXDB_TASK_STACK, nullptr, 1, nullptr) != pdPASS) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Task failed"));
+    IFDB.post_state = INFLUXDB_POST_IDLE;
+    InfluxDbSendDone(0);
+  }
+#else
+  InfluxDbSendDone(InfluxDbPostData(IFDB.sending.c_str(), IFDB.sending.length()));
+#endif  // ESP32
+}
+
+bool InfluxDbPostBusy(void) {
+#ifdef ESP32
+  if (INFLUXDB_POST_BUSY == IFDB.post_state) { return true; }
+  if (INFLUXDB_POST_DONE == IFDB.post_state) {
+    IFDB.post_state = INFLUXDB_POST_IDLE;
+    InfluxDbSendDone(IFDB._lastStatusCode);
+  }
+#endif  // ESP32
+  return false;
+}
+
+void InfluxDbFlush(void) {
+  // Start at most one request per call, on ESP32 it runs in a worker task
+  if (InfluxDbPostBusy()) { return; }
+  if (!IFDB.init || TasmotaGlobal.global_state.network_down) { return; }
+  if (IFDB.retry_time && !TimeReached(IFDB.retry_time)) { return; }
+
+  if (IFDB.batch.length()) {
+    if ((IFDB.batch.length() >= INFLUXDB_BATCH_SIZE) ||
+        (TimePassedSince(IFDB.batch_time) >= (Settings->influxdb_batch * 1000))) {
+      IFDB.sending = IFDB.batch;         // New points go to a fresh batch while these are in flight
+      IFDB.sending_untimed = IFDB.batch_untimed;
+      IFDB.batch = "";
+      IFDB.batch_untimed = false;
+      InfluxDbSend(INFLUXDB_FROM_BATCH);
+    }
+    return;
+  }
+#ifdef USE_UFILESYS
+  if ((0 == IFDB.retry_delay) && InfluxDbSpoolReplay()) {  // Only replay while the server accepts data
+    InfluxDbSend(INFLUXDB_FROM_SPOOL);
+  }
+#endif  // USE_UFILESYS
+}
+
 /*********************************************************************************************\
  * Data preparation
 \*********************************************************************************************/
@@ -322,14 +706,12 @@ void InfluxDbProcessJson(bool use_copy = false) {
   JsonParserObject root = parser.getRootObject();
   if (root) {
     char number[12];     // '1' to '255'
-    char linebuf[128];   // 'temperature,device=demo,sensor=ds18b20,id=01144A0CB2AA value=26.44\n'
+    char linebuf[128];   // 'temperature,device=demo,sensor=ds18b20,id=01144A0CB2AA value=26.44'
     char sensor[64];     // 'ds18b20'
     char type[64];       // 'temperature'
     char sensor_id[32];  // ',id=01144A0CB2AA'
     sensor_id[0] = '\0';
 
-    String data = "";    // Multiple linebufs
-
     for (auto key1 : root) {
       JsonParserToken value1 = key1.getValue();
       if (value1.isObject()) {
@@ -345,9 +727,9 @@ void InfluxDbProcessJson(bool use_copy = false) {
                 LowerCase(sensor, key2.getStr());
                 LowerCase(type, key3.getStr());
                 // temperature,device=tasmota1,sensor=DS18B20 value=24.44
-                snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=%s value=%s\n"),
+                snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=%s value=%s"),
                   type, TasmotaGlobal.mqtt_topic, sensor, value);
-                data += linebuf;
+                InfluxDbAddPoint(linebuf);
               }
             }
           } else {
@@ -375,15 +757,15 @@ void InfluxDbProcessJson(bool use_copy = false) {
                   i++;
                   // power1,device=shelly25,sensor=energy value=0.00
                   // power2,device=shelly25,sensor=energy value=4.12
-                  snprintf_P(linebuf, sizeof(linebuf), PSTR("%s%d,device=%s,sensor=%s%s value=%s\n"),
+                  snprintf_P(linebuf, sizeof(linebuf), PSTR("%s%d,device=%s,sensor=%s%s value=%s"),
                     type, i, TasmotaGlobal.mqtt_topic, sensor, sensor_id, val.getStr());
-                  data += linebuf;
+                  InfluxDbAddPoint(linebuf);
                 }
               } else {
                 // temperature,device=demo,sensor=ds18b20,id=01144A0CB2AA value=22.63
-                snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=%s%s value=%s\n"),
+                snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=%s%s value=%s"),
                   type, TasmotaGlobal.mqtt_topic, sensor, sensor_id, value);
-                data += linebuf;
+                InfluxDbAddPoint(linebuf);
               }
               sensor_id[0] = '\0';
             }
@@ -397,16 +779,12 @@ void InfluxDbProcessJson(bool use_copy = false) {
           LowerCase(type, key1.getStr());
           // switch1,device=demo,sensor=device value=0
           // power1,device=demo,sensor=device value=1
-          snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=device value=%s\n"),
+          snprintf_P(linebuf, sizeof(linebuf), PSTR("%s,device=%s,sensor=device value=%s"),
             type, TasmotaGlobal.mqtt_topic, value);
-          data += linebuf;
+          InfluxDbAddPoint(linebuf);
         }
       }
     }
-    if (data.length() > 0 ) {
-//      AddLog(LOG_LEVEL_DEBUG, PSTR("IFX: Sensor data:\n%s"), data.c_str());
-      InfluxDbPostData(data.c_str());
-    }
   }
 
   if (use_copy) {
@@ -432,7 +810,7 @@ void InfluxDbLoop(void) {
     if (IFDB.interval <= 0 || IFDB.interval > period) {
       IFDB.interval = period;
       if (!IFDB.init) {
-        if (InfluxDbParameterInit()) {
+        if (!InfluxDbPostBusy() && InfluxDbParameterInit()) {
           IFDB.init = InfluxDbValidateConnection();
           if (IFDB.init) {
             IFDB.interval = INFLUXDB_INITIAL;
@@ -476,6 +854,7 @@ void InfluxDbLoop(void) {
 #define D_CMND_INFLUXDBPERIOD   "Period"
 #define D_CMND_INFLUXDBSENSOR   "Sensor"
 #define D_CMND_INFLUXDBRP       "RP"
+#define D_CMND_INFLUXDBBATCH    "Batch"
 
 const char kInfluxDbCommands[] PROGMEM = D_PRFX_INFLUXDB "|"  // Prefix
   "|" D_CMND_INFLUXDBLOG "|"
@@ -483,7 +862,8 @@ const char kInfluxDbCommands[] PROGMEM = D_PRFX_INFLUXDB "|"  // Prefix
   D_CMND_INFLUXDBUSER "|" D_CMND_INFLUXDBORG "|"
   D_CMND_INFLUXDBPASSWORD "|" D_CMND_INFLUXDBTOKEN "|"
   D_CMND_INFLUXDBDATABASE "|" D_CMND_INFLUXDBBUCKET "|"
-  D_CMND_INFLUXDBPERIOD "|" D_CMND_INFLUXDBSENSOR "|" D_CMND_INFLUXDBRP;
+  D_CMND_INFLUXDBPERIOD "|" D_CMND_INFLUXDBSENSOR "|" D_CMND_INFLUXDBRP "|"
+  D_CMND_INFLUXDBBATCH;
 
 void (* const InfluxCommand[])(void) PROGMEM = {
   &CmndInfluxDbState, &CmndInfluxDbLog,
@@ -491,7 +871,8 @@ void (* const InfluxCommand[])(void) PROGMEM = {
   &CmndInfluxDbUser, &CmndInfluxDbUser,
   &CmndInfluxDbPassword, &CmndInfluxDbPassword,
   &CmndInfluxDbDatabase, &CmndInfluxDbDatabase,
-  &CmndInfluxDbPeriod, &CmndInfluxDbSensor, &CmndInfluxDbRP };
+  &CmndInfluxDbPeriod, &CmndInfluxDbSensor, &CmndInfluxDbRP,
+  &CmndInfluxDbBatch };
 
 void InfluxDbReinit(void) {
   IFDB.init = false;
@@ -508,12 +889,18 @@ void CmndInfluxDbState(void) {
   Response_P(PSTR("{\"" D_PRFX_INFLUXDB "\":{\"State\":\"%s\",\"" D_CMND_INFLUXDBHOST "\":\"%s\",\"" D_CMND_INFLUXDBPORT "\":%d,\"Version\":%d"),
     GetStateText(Settings->sbflag1.influxdb_state), SettingsText(SET_INFLUXDB_HOST), Settings->influxdb_port, Settings->influxdb_version);
   if (1 == Settings->influxdb_version) {
-    ResponseAppend_P(PSTR(",\"" D_CMND_INFLUXDBDATABASE "\":\"%s\",\"" D_CMND_INFLUXDBUSER "\":\"%s\"}}"),
+    ResponseAppend_P(PSTR(",\"" D_CMND_INFLUXDBDATABASE "\":\"%s\",\"" D_CMND_INFLUXDBUSER "\":\"%s\""),
       SettingsText(SET_INFLUXDB_BUCKET), SettingsText(SET_INFLUXDB_ORG));
   } else {
-    ResponseAppend_P(PSTR(",\"" D_CMND_INFLUXDBBUCKET "\":\"%s\",\"" D_CMND_INFLUXDBORG "\":\"%s\"}}"),
+    ResponseAppend_P(PSTR(",\"" D_CMND_INFLUXDBBUCKET "\":\"%s\",\"" D_CMND_INFLUXDBORG "\":\"%s\""),
       SettingsText(SET_INFLUXDB_BUCKET), SettingsText(SET_INFLUXDB_ORG));
   }
+  uint32_t spooled = 0;
+#ifdef USE_UFILESYS
+  spooled = InfluxDbSpoolSize();
+#endif  // USE_UFILESYS
+  ResponseAppend_P(PSTR(",\"" D_CMND_INFLUXDBBATCH "\":%d,\"Spooled\":%d,\"Dropped\":%d}}"),
+    IFDB.batch.length(), spooled, IFDB.dropped);
 }
 
 void CmndInfluxDbSensor(void) {
@@ -599,6 +986,13 @@ void CmndInfluxDbPeriod(void) {
   ResponseCmndNumber(Settings->influxdb_period);
 }
 
+void CmndInfluxDbBatch(void) {
+  if ((XdrvMailbox.payload >= 0) && (XdrvMailbox.payload < 3601)) {
+    Settings->influxdb_batch = XdrvMailbox.payload;
+  }
+  ResponseCmndNumber(Settings->influxdb_batch);
+}
+
 /*********************************************************************************************\
  * Interface
 \*********************************************************************************************/
@@ -619,10 +1013,17 @@ bool Xdrv59(uint32_t function) {
       SettingsUpdateText(SET_INFLUXDB_RP, PSTR(INFLUXDB_RP));
       Settings->sbflag1.influxdb_default = 1;
     }
+    if (!Settings->sbflag1.influxdb_batch_default) {
+      Settings->influxdb_batch = INFLUXDB_BATCH_TIME;
+      Settings->sbflag1.influxdb_batch_default = 1;
+    }
   } else if (FUNC_COMMAND == function) {
     result = DecodeCommand(kInfluxDbCommands, InfluxCommand);
   } else if (Settings->sbflag1.influxdb_state) {
     switch (function) {
+      case FUNC_EVERY_250_MSECOND:
+        InfluxDbFlush();
+        break;
       case FUNC_EVERY_SECOND:
         InfluxDbLoop();
         break;
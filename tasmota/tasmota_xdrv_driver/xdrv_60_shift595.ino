@@ -20,6 +20,7 @@
 #ifdef USE_SHIFT595
 
 #define XDRV_60           60
+#define XDRV_60_FUNC      XFUNC_NONE
 
 const char kShift595Commands[] PROGMEM = "|" D_CMND_SHIFT595_DEVICE_COUNT ;
 void (* const Shift595Command[])(void) PROGMEM = { &CmndShift595Devices };
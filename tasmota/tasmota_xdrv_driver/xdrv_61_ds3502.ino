@@ -15,6 +15,7 @@
 \*********************************************************************************************/
 
 #define XDRV_61                  61
+#define XDRV_61_FUNC             XFUNC_NONE
 #define XI2C_67                  67  // See I2CDEVICES.md
 
 #define USE_DS3502_ADDR          0x28
@@ -14,6 +14,7 @@
 \*********************************************************************************************/
 
 #define XDRV_62                  62
+#define XDRV_62_FUNC             (XFUNC_EVERY_SECOND)
 
 #define IMPROV_WIFI_TIMEOUT      30             // Max seconds wait for wifi connection after reconfig
 
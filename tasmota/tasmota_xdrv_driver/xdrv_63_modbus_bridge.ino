@@ -46,6 +46,7 @@
 \*********************************************************************************************/
 
 #define XDRV_63 63
+#define XDRV_63_FUNC (XFUNC_LOOP)
 
 #define MBR_MAX_VALUE_LENGTH 30
 #define MBR_BAUDRATE TM_MODBUS_BAUDRATE
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XDRV_64                     64
+#define XDRV_64_FUNC                (XFUNC_EVERY_SECOND)
 #define XI2C_75                     75  // See I2CDEVICES.md
 
 #define PCA9632_REG_MODE1           0x00
@@ -25,6 +25,7 @@
 \*********************************************************************************************/
 
 #define XDRV_66               66
+#define XDRV_66_FUNC          (XFUNC_EVERY_50_MSECOND)
 
 #ifdef TM1638_USE_AS_BUTTON
 #define TM1638_USE_BUTTONS         // Use keys as buttons
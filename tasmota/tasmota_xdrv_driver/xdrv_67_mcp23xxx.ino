@@ -73,6 +73,7 @@
 \*********************************************************************************************/
 
 #define XDRV_67                  67
+#define XDRV_67_FUNC             (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_100_MSECOND)
 #define XI2C_77                  77       // See I2CDEVICES.md
 
 #define MCP23XXX_ADDR_START      0x20     // 32
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XDRV_68             68
+#define XDRV_68_FUNC        (XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 static const uint8_t TRIGGER_PERIOD = 75;
 
@@ -58,6 +58,7 @@
 \*********************************************************************************************/
 
 #define XDRV_69                  69
+#define XDRV_69_FUNC             (XFUNC_EVERY_100_MSECOND)
 #define XI2C_81                  81       // See I2CDEVICES.md
 
 #define PCA9557_ADDR_START       0x18     // 24
@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XDRV_70             70
+#define XDRV_70_FUNC        (XFUNC_LOOP | XFUNC_SLEEP_LOOP)
 
 const char kHDMICommands[] PROGMEM = D_PRFX_HDMI "|"
   D_CMND_HDMI_SEND_RAW "|" D_CMND_HDMI_SEND "|"
@@ -20,6 +20,7 @@
 #ifdef USE_MAGIC_SWITCH
 
 #define XDRV_71           71
+#define XDRV_71_FUNC      (XFUNC_EVERY_50_MSECOND)
 
 /********************************************************************************************************
  * Check defines
@@ -20,6 +20,7 @@
 #ifdef USE_PIPSOLAR
 
 #define XDRV_72 72
+#define XDRV_72_FUNC (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 
 #define PIPSOLAR_RECEIVEBUFFER_SIZE TM_SERIAL_BUFFER_SIZE * 2 // 128
 #define PIPSOLAR_SENDBUFFER_SIZE TM_SERIAL_BUFFER_SIZE        // 64
@@ -13,6 +13,7 @@
 \*********************************************************************************************/
 
 #define XDRV_73                 73
+#define XDRV_73_FUNC            (XFUNC_LOOP | XFUNC_SLEEP_LOOP)
 
 /*********************************************************************************************/
 
@@ -139,6 +139,7 @@ i.e. the Bluetooth of the ESP can be shared without conflict.
 //#define BLE_ESP32_DEBUG
 
 #define XDRV_79                    79
+#define XDRV_79_FUNC               (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <vector>
 #include <deque>
@@ -115,6 +115,7 @@
 /*********************************************************************************************/
 
 #define XDRV_81           81
+#define XDRV_81_FUNC      (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 #include "cam_hal.h"
 #include "esp_camera.h"
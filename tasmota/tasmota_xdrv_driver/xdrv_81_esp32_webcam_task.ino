@@ -273,6 +273,7 @@ These will save or append a picture to a file.  The picture must have been first
 
 
 #define XDRV_99           99
+#define XDRV_99_FUNC      (XFUNC_LOOP | XFUNC_EVERY_SECOND)
 
 #include "cam_hal.h"
 #include "esp_camera.h"
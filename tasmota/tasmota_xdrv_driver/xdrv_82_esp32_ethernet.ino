@@ -65,6 +65,7 @@
 \*********************************************************************************************/
 
 #define XDRV_82           82
+#define XDRV_82_FUNC      (XFUNC_EVERY_SECOND)
 
 /*
 // Olimex ESP32-PoE
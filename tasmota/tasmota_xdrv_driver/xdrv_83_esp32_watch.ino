@@ -25,6 +25,7 @@
 #include <bma.h>
 
 #define XDRV_83           83
+#define XDRV_83_FUNC      (XFUNC_LOOP)
 
 #define AXP202_INT        35
 
@@ -134,6 +134,7 @@ print("".join(pin))
 #ifdef USE_BLE_ESP32
 
 #define XDRV_85                    85
+#define XDRV_85_FUNC               (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 #define D_CMND_EQ3 "trv"
 
 // uncomment for more debug messages
@@ -120,6 +120,7 @@
 \*********************************************************************************************/
 
 #define XDRV_86                      86
+#define XDRV_86_FUNC                 (XFUNC_LOOP | XFUNC_EVERY_100_MSECOND)
 
 #define SSPM_MAX_MODULES             8       // Currently supports up to 8 SPM-4RELAY units for a total of 32 relays restricted by 32-bit power_t size
 #define SSPM_SERIAL_BUFFER_SIZE      548     // Needs to accomodate firmware upload data blocks (546 bytes)
@@ -37,6 +37,7 @@
 \*********************************************************************************************/
 
 #define XDRV_87              87
+#define XDRV_87_FUNC         (XFUNC_EVERY_SECOND)
 
 #define TM1621_ROTATE        5     // Seconds display rotation speed
 #define TM1621_MAX_VALUES    8     // Default 8 x two different lines
@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XDRV_88           88
+#define XDRV_88_FUNC      (XFUNC_EVERY_SECOND)
 
 struct SPro {
   uint32_t last_update;
@@ -35,6 +35,7 @@
 \*********************************************************************************************/
 
 #define XDRV_88                        88
+#define XDRV_88_FUNC                   (XFUNC_EVERY_SECOND)
 
 #define SHELLY_PRO_PIN_LAN8720_RESET   5
 #define SHELLY_PRO_4_PIN_SPI_CS        16
@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XDRV_89              89
+#define XDRV_89_FUNC         XFUNC_NONE
 
 #ifndef DALI_TIMER
     #define DALI_TIMER 0    // Default timer
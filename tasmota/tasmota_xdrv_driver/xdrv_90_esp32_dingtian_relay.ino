@@ -21,6 +21,7 @@
 #ifdef USE_DINGTIAN_RELAY
 
 #define XDRV_90           90
+#define XDRV_90_FUNC      (XFUNC_EVERY_50_MSECOND)
 
 /********************************************************************************************************
  * Check defines
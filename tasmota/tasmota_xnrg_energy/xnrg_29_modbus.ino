@@ -30,6 +30,12 @@
  *
  * See files configurations.md and value_pair_description.md in folder energy_modbus_configs
  *
+ * - Registers are read in as few requests as possible by combining them per device in blocks
+ *   of up to "Block" registers (default 125) allowing up to "Gap" unused registers (default 10).
+ *   On illegal address or value responses gaps, then block size and finally to one value per request
+ *   are reduced automatically.
+ * - The time needed to read all registers is reported as ModbusCycle in ms.
+ *
  * Restrictions:
  * - Supports Modbus single and double integer registers in addition to floating point registers
  * - Max number of user defined registers is defined by one rule buffer (511 characters uncompressed, around 800 characters compressed)
@@ -70,6 +76,8 @@
 
 #define ENERGY_MODBUS_TICKER                           // Enable for ESP8266 when using softwareserial solving most modbus serial retries
 #define ENERGY_MODBUS_TICKER_POLL 200                  // Modbus poll time in ms between read register requests
+#define ENERGY_MODBUS_BLOCK       125                  // Max number of registers read with one request (Modbus limit is 125)
+#define ENERGY_MODBUS_GAP         10                   // Max number of unused registers read to combine requests
 
 //#define ENERGY_MODBUS_DEBUG
 //#define ENERGY_MODBUS_DEBUG_SHOW
@@ -131,17 +139,23 @@ Ticker ticker_energy_modbus;
 #endif  // ENERGY_MODBUS_TICKER
 
 struct NRGMBSPARAM {
+  uint8_t *buffer;
   uint32_t serial_bps;
   uint32_t serial_config;
+  uint32_t timeout;                                    // Time in ms the response to the last request should have been received
+  uint32_t cycle_start;                                // Time in ms the current read cycle started
+  uint32_t cycle_time;                                 // Time in ms needed to read all registers
   uint16_t ticker_poll;
   uint8_t device_address[ENERGY_MODBUS_MAX_DEVICES];
   uint8_t devices;
   uint8_t function;
   uint8_t total_regs;
   uint8_t user_adds;
-  uint8_t state;
+  uint16_t blocks;                                     // Number of requests needed to read all registers
+  uint16_t state;                                      // Current request
+  uint8_t block_regs;                                  // Max number of registers per request
+  uint8_t gap;                                         // Max number of unused registers within a request
   uint8_t retry;
-  int8_t phase;
   bool mutex;
 } NrgMbsParam;
 
@@ -161,8 +175,210 @@ typedef struct NRGMBSUSER {
 } NrgMbsUser_t;
 NrgMbsUser_t *NrgMbsUser = nullptr;
 
+typedef struct NRGMBSITEM {
+  uint8_t reg;                                         // Index in NrgMbsReg
+  uint8_t phase;
+} NrgMbsItem_t;
+NrgMbsItem_t *NrgMbsItem = nullptr;                    // Used register and phase combinations sorted on device and address
+
+typedef struct NRGMBSBLOCK {
+  uint16_t start;                                      // First register address
+  uint8_t count;                                       // Number of registers
+  uint8_t device;                                      // Index in device_address
+  uint16_t first;                                      // Index of first item in NrgMbsItem
+  uint16_t items;                                      // Number of items decoded from the response
+} NrgMbsBlock_t;
+NrgMbsBlock_t *NrgMbsBlock = nullptr;
+
 /*********************************************************************************************/
 
+float EnergyModbusValue(uint8_t *data, uint32_t reg_index) {
+  /* Register data as found in Modbus response at offset 3 (first register):
+  * Fh = First or High word MSB
+  * Fl = First or High word LSB
+  * Sh = Second or Low word MSB
+  * Sl = Second or Low word LSB
+  */
+  float value = 0;
+  switch (NrgMbsReg[reg_index].datatype) {
+    case NRG_DT_FLOAT: {  // 0
+      //  0  1  2  3
+      // Fh Fl Sh Sl
+      // 43 66 33 34 = 230.2 Volt
+      ((uint8_t*)&value)[3] = data[0];   // Get float values
+      ((uint8_t*)&value)[2] = data[1];
+      ((uint8_t*)&value)[1] = data[2];
+      ((uint8_t*)&value)[0] = data[3];
+      break;
+    }
+    case NRG_DT_S16: {  // 1
+      //  0  1
+      // Fh Fl
+      int16_t value_buff = ((int16_t)data[0])<<8 | data[1];
+      value = (float)value_buff;
+      break;
+    }
+    case NRG_DT_U16: {  // 3
+      //  0  1
+      // Fh Fl
+      uint16_t value_buff = ((uint16_t)data[0])<<8 | data[1];
+      value = (float)value_buff;
+      break;
+    }
+    case NRG_DT_S32: {  // 2
+      //  0  1  2  3
+      // Fh Fl Sh Sl
+      int32_t value_buff = ((int32_t)data[0])<<24 | ((uint32_t)data[1])<<16 | ((uint32_t)data[2])<<8 | data[3];
+      value = (float)value_buff;
+      break;
+    }
+    case NRG_DT_S32_SW: {  // 6
+      //  0  1  2  3
+      // Sh Sl Fh Fl
+      int32_t value_buff = ((int32_t)data[2])<<24 | ((uint32_t)data[3])<<16 | ((uint32_t)data[0])<<8 | data[1];
+      value = (float)value_buff;
+      break;
+    }
+    case NRG_DT_U32: {  // 4
+      //  0  1  2  3
+      // Fh Fl Sh Sl
+      uint32_t value_buff = ((uint32_t)data[0])<<24 | ((uint32_t)data[1])<<16 | ((uint32_t)data[2])<<8 | data[3];
+      value = (float)value_buff;
+      break;
+    }
+    case NRG_DT_U32_SW: {  // 8
+      //  0  1  2  3
+      // Sh Sl Fh Fl
+      // EB EC 00 0E = 977.9000 (Solax protocol X1&X3)
+      uint32_t value_buff = ((uint32_t)data[2])<<24 | ((uint32_t)data[3])<<16 | ((uint32_t)data[0])<<8 | data[1];
+      value = (float)value_buff;
+      break;
+    }
+  }
+  uint32_t factor = 1;
+  // 1 = 10, 2 = 100, 3 = 1000, 4 = 10000
+  uint32_t scaler = abs(NrgMbsReg[reg_index].factor);
+  while (scaler) {
+    factor *= 10;
+    scaler--;
+  }
+  if (NrgMbsReg[reg_index].factor < 0) {
+    value /= factor;
+  } else {
+    value *= factor;
+  }
+  return value;
+}
+
+void EnergyModbusStore(uint32_t reg_index, uint32_t phase, float value) {
+  switch (reg_index) {
+    case NRG_MBS_VOLTAGE:
+      Energy->voltage[phase] = value;          // 230.2 V
+      break;
+    case NRG_MBS_CURRENT:
+      Energy->current[phase]  = value;         // 1.260 A
+      break;
+    case NRG_MBS_ACTIVE_POWER:
+      Energy->active_power[phase] = value;     // -196.3 W
+      break;
+    case NRG_MBS_APPARENT_POWER:
+      Energy->apparent_power[phase] = value;   // 223.4 VA
+      break;
+    case NRG_MBS_REACTIVE_POWER:
+      Energy->reactive_power[phase] = value;   // 92.2
+      break;
+    case NRG_MBS_POWER_FACTOR:
+      Energy->power_factor[phase] = value;     // -0.91
+      break;
+    case NRG_MBS_FREQUENCY:
+      Energy->frequency[phase] = value;        // 50.0 Hz
+      break;
+    case NRG_MBS_TOTAL_ENERGY:
+      Energy->import_active[phase] = value;    // 6.216 kWh => used in EnergyUpdateTotal()
+      break;
+    case NRG_MBS_EXPORT_ACTIVE_ENERGY:
+      Energy->export_active[phase] = value;    // 478.492 kWh
+      break;
+    default:
+      if (NrgMbsUser) {
+        NrgMbsUser[reg_index - NRG_MBS_MAX_REGS].data[phase] = value;
+      }
+  }
+}
+
+uint32_t EnergyModbusItemAddress(uint32_t item) {
+  uint32_t phase = (NrgMbsParam.devices == 1) ? NrgMbsItem[item].phase : 0;
+  return NrgMbsReg[NrgMbsItem[item].reg].address[phase];
+}
+
+uint32_t EnergyModbusItemDevice(uint32_t item) {
+  return (NrgMbsParam.devices == 1) ? 0 : NrgMbsItem[item].phase;
+}
+
+uint32_t EnergyModbusItemKey(uint32_t item) {
+  return EnergyModbusItemDevice(item) << 16 | EnergyModbusItemAddress(item);
+}
+
+void EnergyModbusPlanBlocks(void) {
+  // Group all used register and phase combinations in blocks of contiguous registers per device
+  // read with one request, allowing gaps of up to NrgMbsParam.gap unused registers
+  uint32_t items = 0;
+  for (uint32_t reg_index = 0; reg_index < NrgMbsParam.total_regs; reg_index++) {
+    for (uint32_t phase = 0; phase < Energy->phase_count; phase++) {
+      NrgMbsItem[items].reg = reg_index;
+      NrgMbsItem[items].phase = phase;
+      if (EnergyModbusItemAddress(items) != nrg_mbs_reg_not_used) {
+        items++;
+      }
+    }
+  }
+  // Sort on device and register address (insertion sort as there are only a few)
+  for (uint32_t i = 1; i < items; i++) {
+    uint32_t key = EnergyModbusItemKey(i);
+    uint32_t j = i;
+    while (j && (EnergyModbusItemKey(j -1) > key)) {
+      NrgMbsItem_t item = NrgMbsItem[j];
+      NrgMbsItem[j] = NrgMbsItem[j -1];
+      NrgMbsItem[j -1] = item;
+      j--;
+    }
+  }
+
+  NrgMbsParam.blocks = 0;
+  uint32_t block_end = 0;
+  for (uint32_t i = 0; i < items; i++) {
+    uint32_t address = EnergyModbusItemAddress(i);
+    uint32_t device = EnergyModbusItemDevice(i);
+    // Even data type is single register, Odd data type is double registers
+    uint32_t item_end = address + 2 - (NrgMbsReg[NrgMbsItem[i].reg].datatype & 1);
+    NrgMbsBlock_t *block = (NrgMbsParam.blocks) ? &NrgMbsBlock[NrgMbsParam.blocks -1] : nullptr;
+    if (block &&
+        (block->device == device) &&
+        (address <= block_end + NrgMbsParam.gap) &&
+        (tmax(item_end, block_end) - block->start <= NrgMbsParam.block_regs)) {
+      block_end = tmax(item_end, block_end);
+      block->count = block_end - block->start;
+      block->items++;
+    } else {
+      block = &NrgMbsBlock[NrgMbsParam.blocks++];
+      block->start = address;
+      block->count = item_end - address;
+      block->device = device;
+      block->first = i;
+      block->items = 1;
+      block_end = item_end;
+    }
+  }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Modbus %d values in %d requests"), items, NrgMbsParam.blocks);
+#ifdef ENERGY_MODBUS_DEBUG
+  for (uint32_t i = 0; i < NrgMbsParam.blocks; i++) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Block %d, Device %d, Register %04X, Size %d, Values %d"),
+      i, NrgMbsParam.device_address[NrgMbsBlock[i].device], NrgMbsBlock[i].start, NrgMbsBlock[i].count, NrgMbsBlock[i].items);
+  }
+#endif
+}
+
 void EnergyModbusLoop(void) {
 #ifdef ENERGY_MODBUS_TICKER
   if (NrgMbsParam.mutex || TasmotaGlobal.ota_state_flag) { return; }
@@ -171,16 +387,20 @@ void EnergyModbusLoop(void) {
 #endif  // ENERGY_MODBUS_TICKER
   NrgMbsParam.mutex = 1;
 
-  uint32_t register_count;
-
+  NrgMbsBlock_t *block = &NrgMbsBlock[(NrgMbsParam.state < NrgMbsParam.blocks) ? NrgMbsParam.state : 0];
+  uint32_t frame_size = 5 + (block->count * 2);  // SA FC BC Data.. Cl Ch
+  bool timeout = TimeReached(NrgMbsParam.timeout);
   bool data_ready = EnergyModbus->ReceiveReady();
 
-  if (data_ready) {
-    uint8_t buffer[15];  // At least 5 + (2 * 2) = 9
+  if (data_ready && (EnergyModbus->available() < frame_size) && !timeout) {
+    // Wait for the complete block
+    NrgMbsParam.mutex = 0;
+    return;
+  }
 
-    // Even data type is single register, Odd data type is double registers
-    register_count = 2 - (NrgMbsReg[NrgMbsParam.state].datatype & 1);
-    uint32_t error = EnergyModbus->ReceiveBuffer(buffer, register_count);
+  if (data_ready) {
+    uint8_t *buffer = NrgMbsParam.buffer;
+    uint32_t error = EnergyModbus->ReceiveBuffer(buffer, block->count);
     if (error) {
       /* Return codes from TasmotaModbus.h:
       * 0 = No error
@@ -200,129 +420,47 @@ void EnergyModbusLoop(void) {
       * 14 = To many registers
       */
 #ifdef ENERGY_MODBUS_DEBUG
-      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus register %d, phase %d, rcvd %*_H"),
-        NrgMbsParam.state, NrgMbsParam.phase, EnergyModbus->ReceiveCount(), buffer);
+      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus block %d, rcvd %*_H"),
+        NrgMbsParam.state, EnergyModbus->ReceiveCount(), buffer);
 #endif
       AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Modbus error %d"), error);
+      if (((2 == error) || (3 == error)) && (block->items > 1) && (NrgMbsParam.block_regs > 1)) {
+        // Device does not allow reading unused or that many registers at once so fall back to smaller requests
+        if (NrgMbsParam.gap) {
+          NrgMbsParam.gap = 0;
+        }
+        else if (NrgMbsParam.block_regs > 2) {
+          NrgMbsParam.block_regs = 2;
+        } else {
+          NrgMbsParam.block_regs = 1;            // One value per request, a double register value still reads both
+        }
+        AddLog(LOG_LEVEL_INFO, PSTR("NRG: Modbus block reads reduced to Gap %d, Block %d"), NrgMbsParam.gap, NrgMbsParam.block_regs);
+        EnergyModbusPlanBlocks();
+        NrgMbsParam.state = NrgMbsParam.blocks;  // Restart cycle
+        NrgMbsParam.cycle_start = 0;
+      }
     } else {
       /* Modbus protocol format:
       * SA = Device Address
       * FC = Function Code
       * BC = Byte count
-      * Fh = First or High word MSB
-      * Fl = First or High word LSB
-      * Sh = Second or Low word MSB
-      * Sl = Second or Low word LSB
+      * Data = block->count registers
       * Cl = CRC lsb
       * Ch = CRC msb
       */
-      Energy->data_valid[NrgMbsParam.phase] = 0;
-
-      float value;
-      switch (NrgMbsReg[NrgMbsParam.state].datatype) {
-        case NRG_DT_FLOAT: {  // 0
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          // 01 04 04 43 66 33 34 1B 38 = 230.2 Volt
-          ((uint8_t*)&value)[3] = buffer[3];   // Get float values
-          ((uint8_t*)&value)[2] = buffer[4];
-          ((uint8_t*)&value)[1] = buffer[5];
-          ((uint8_t*)&value)[0] = buffer[6];
-          break;
-        }
-        case NRG_DT_S16: {  // 1
-          //  0  1  2  3  4  5  6
-          // SA FC BC Fh Fl Cl Ch
-          int16_t value_buff = ((int16_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_U16: {  // 3
-          //  0  1  2  3  4  5  6
-          // SA FC BC Fh Fl Cl Ch
-          uint16_t value_buff = ((uint16_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_S32: {  // 2
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          int32_t value_buff = ((int32_t)buffer[3])<<24 | ((uint32_t)buffer[4])<<16 | ((uint32_t)buffer[5])<<8 | buffer[6];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_S32_SW: {  // 6
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Sh Sl Fh Fl Cl Ch
-          int32_t value_buff = ((int32_t)buffer[5])<<24 | ((uint32_t)buffer[6])<<16 | ((uint32_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_U32: {  // 4
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Fh Fl Sh Sl Cl Ch
-          uint32_t value_buff = ((uint32_t)buffer[3])<<24 | ((uint32_t)buffer[4])<<16 | ((uint32_t)buffer[5])<<8 | buffer[6];
-          value = (float)value_buff;
-          break;
-        }
-        case NRG_DT_U32_SW: {  // 8
-          //  0  1  2  3  4  5  6  7  8
-          // SA FC BC Sh Sl Fh Fl Cl Ch
-          // 01 04 04 EB EC 00 0E 8E 51 = 977.9000 (Solax protocol X1&X3)
-          uint32_t value_buff = ((uint32_t)buffer[5])<<24 | ((uint32_t)buffer[6])<<16 | ((uint32_t)buffer[3])<<8 | buffer[4];
-          value = (float)value_buff;
-          break;
-        }
-      }
-      uint32_t factor = 1;
-      // 1 = 10, 2 = 100, 3 = 1000, 4 = 10000
-      uint32_t scaler = abs(NrgMbsReg[NrgMbsParam.state].factor);
-      while (scaler) {
-        factor *= 10;
-        scaler--;
-      }
-      if (NrgMbsReg[NrgMbsParam.state].factor < 0) {
-        value /= factor;
-      } else {
-        value *= factor;
-      }
+      for (uint32_t i = block->first; i < block->first + block->items; i++) {
+        uint32_t reg_index = NrgMbsItem[i].reg;
+        uint32_t phase = NrgMbsItem[i].phase;
+        uint8_t *data = &buffer[3 + ((EnergyModbusItemAddress(i) - block->start) * 2)];
+        float value = EnergyModbusValue(data, reg_index);
 
-      AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus register %d, phase %d, rcvd %*_H, T %d, F %d, value %4_f"),
-        NrgMbsParam.state, NrgMbsParam.phase, EnergyModbus->ReceiveCount(), buffer,
-        NrgMbsReg[NrgMbsParam.state].datatype, NrgMbsReg[NrgMbsParam.state].factor, &value);
+        Energy->data_valid[phase] = 0;
 
-      switch (NrgMbsParam.state) {
-        case NRG_MBS_VOLTAGE:
-          Energy->voltage[NrgMbsParam.phase] = value;          // 230.2 V
-          break;
-        case NRG_MBS_CURRENT:
-          Energy->current[NrgMbsParam.phase]  = value;         // 1.260 A
-          break;
-        case NRG_MBS_ACTIVE_POWER:
-          Energy->active_power[NrgMbsParam.phase] = value;     // -196.3 W
-          break;
-        case NRG_MBS_APPARENT_POWER:
-          Energy->apparent_power[NrgMbsParam.phase] = value;   // 223.4 VA
-          break;
-        case NRG_MBS_REACTIVE_POWER:
-          Energy->reactive_power[NrgMbsParam.phase] = value;   // 92.2
-          break;
-        case NRG_MBS_POWER_FACTOR:
-          Energy->power_factor[NrgMbsParam.phase] = value;     // -0.91
-          break;
-        case NRG_MBS_FREQUENCY:
-          Energy->frequency[NrgMbsParam.phase] = value;        // 50.0 Hz
-          break;
-        case NRG_MBS_TOTAL_ENERGY:
-          Energy->import_active[NrgMbsParam.phase] = value;    // 6.216 kWh => used in EnergyUpdateTotal()
-          break;
-        case NRG_MBS_EXPORT_ACTIVE_ENERGY:
-          Energy->export_active[NrgMbsParam.phase] = value;    // 478.492 kWh
-          break;
-        default:
-          if (NrgMbsUser) {
-            NrgMbsUser[NrgMbsParam.state - NRG_MBS_MAX_REGS].data[NrgMbsParam.phase] = value;
-          }
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus register %d, phase %d, rcvd %*_H, T %d, F %d, value %4_f"),
+          reg_index, phase, (2 - (NrgMbsReg[reg_index].datatype & 1)) * 2, data,
+          NrgMbsReg[reg_index].datatype, NrgMbsReg[reg_index].factor, &value);
+
+        EnergyModbusStore(reg_index, phase, value);
       }
     }
   } // end data ready
@@ -330,47 +468,32 @@ void EnergyModbusLoop(void) {
   if (0 == NrgMbsParam.retry || data_ready) {
     NrgMbsParam.retry = 1;
 
-    uint32_t address = 0;
-    uint32_t phase = 0;
-    do {
-      NrgMbsParam.phase++;
-      if (NrgMbsParam.phase >= Energy->phase_count) {
-        NrgMbsParam.phase = 0;
-        NrgMbsParam.state++;
-        if (NrgMbsParam.state >= NrgMbsParam.total_regs) {
-          NrgMbsParam.state = 0;
-          NrgMbsParam.phase = 0;
-          EnergyUpdateTotal();                 // update every cycle after all registers have been read
-        }
-      }
-      delay(0);
-      if (NrgMbsParam.devices == 1) {
-        phase = NrgMbsParam.phase;
-      } else {
-        address = NrgMbsParam.phase;
+    NrgMbsParam.state++;
+    if (NrgMbsParam.state >= NrgMbsParam.blocks) {
+      NrgMbsParam.state = 0;
+      if (NrgMbsParam.cycle_start) {
+        NrgMbsParam.cycle_time = TimePassedSince(NrgMbsParam.cycle_start);
+        AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus cycle of %d requests in %d ms"), NrgMbsParam.blocks, NrgMbsParam.cycle_time);
+        EnergyUpdateTotal();                   // update every cycle after all registers have been read
       }
-    } while (NrgMbsReg[NrgMbsParam.state].address[phase] == nrg_mbs_reg_not_used);
-
-    // Even data type is single register, Odd data type is double registers
-    register_count = 2 - (NrgMbsReg[NrgMbsParam.state].datatype & 1);
+      NrgMbsParam.cycle_start = millis() | 1;  // Never zero
+    }
+    block = &NrgMbsBlock[NrgMbsParam.state];
 
 #ifdef ENERGY_MODBUS_DEBUG
-    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus send Device %d, Function %d, Register %04X (%d/%d), Size %d"),
-      NrgMbsParam.device_address[address], NrgMbsParam.function,
-      NrgMbsReg[NrgMbsParam.state].address[phase], NrgMbsParam.state, phase,
-      register_count);
+    AddLog(LOG_LEVEL_DEBUG_MORE, PSTR("NRG: Modbus send Device %d, Function %d, Register %04X (%d), Size %d"),
+      NrgMbsParam.device_address[block->device], NrgMbsParam.function,
+      block->start, NrgMbsParam.state, block->count);
 #endif
 
-    EnergyModbus->Send(NrgMbsParam.device_address[address], NrgMbsParam.function, NrgMbsReg[NrgMbsParam.state].address[phase], register_count);
-  } else {
+    EnergyModbus->Send(NrgMbsParam.device_address[block->device], NrgMbsParam.function, block->start, block->count);
+    // Request of 8 bytes and response of 5 + 2 * count bytes at 11 bits per byte plus device response time
+    NrgMbsParam.timeout = millis() + (((13 + (block->count * 2)) * 11000) / NrgMbsParam.serial_bps) + 50;
+  } else if (timeout) {
     NrgMbsParam.retry--;
 
 #ifdef ENERGY_MODBUS_DEBUG
-    if (NrgMbsParam.devices > 1) {
-      AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Modbus retry device %d state %d"), NrgMbsParam.device_address[NrgMbsParam.phase], NrgMbsParam.state);
-    } else {
-      AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Modbus retry state %d phase %d"), NrgMbsParam.state, NrgMbsParam.phase);
-    }
+    AddLog(LOG_LEVEL_DEBUG, PSTR("NRG: Modbus retry device %d block %d"), NrgMbsParam.device_address[block->device], NrgMbsParam.state);
 #endif
 
   }
@@ -521,6 +644,8 @@ bool EnergyModbusReadRegisters(void) {
   NrgMbsParam.device_address[0] = ENERGY_MODBUS_ADDR;
   NrgMbsParam.devices = 1;
   NrgMbsParam.function = ENERGY_MODBUS_FUNC;
+  NrgMbsParam.block_regs = ENERGY_MODBUS_BLOCK;
+  NrgMbsParam.gap = ENERGY_MODBUS_GAP;
   NrgMbsParam.user_adds = 0;
 
   // Detect buffer allocation
@@ -600,6 +725,17 @@ bool EnergyModbusReadRegisters(void) {
   if (val) {
     NrgMbsParam.function = val.getUInt();        // 4
   }
+  val = root[PSTR("Block")];
+  if (val) {
+    NrgMbsParam.block_regs = val.getUInt();      // 125
+    if ((NrgMbsParam.block_regs < 2) || (NrgMbsParam.block_regs > ENERGY_MODBUS_BLOCK)) {
+      NrgMbsParam.block_regs = ENERGY_MODBUS_BLOCK;
+    }
+  }
+  val = root[PSTR("Gap")];
+  if (val) {
+    NrgMbsParam.gap = val.getUInt();             // 10
+  }
 
   // Get default energy registers
   char register_name[32];
@@ -721,8 +857,15 @@ bool EnergyModbusReadRegisters(void) {
     NrgMbsParam.user_adds * sizeof(NrgMbsUser_t));
 #endif
 
-//  NrgMbsParam.state = 0;    // Set by calloc()
-  NrgMbsParam.phase = -1;
+  // Combine registers in as few requests as possible
+  uint32_t max_items = NrgMbsParam.total_regs * Energy->phase_count;
+  NrgMbsItem = (NrgMbsItem_t*)calloc(max_items, sizeof(NrgMbsItem_t));
+  NrgMbsBlock = (NrgMbsBlock_t*)calloc(max_items, sizeof(NrgMbsBlock_t));
+  NrgMbsParam.buffer = (uint8_t*)malloc(5 + (NrgMbsParam.block_regs * 2));  // SA FC BC Data.. Cl Ch
+  if (!NrgMbsItem || !NrgMbsBlock || !NrgMbsParam.buffer) { return false; }  // Unable to allocate variables on heap
+  EnergyModbusPlanBlocks();
+  if (!NrgMbsParam.blocks) { return false; }    // No registers to read
+  NrgMbsParam.state = NrgMbsParam.blocks -1;     // Start with first block
 
   return true;
 }
@@ -741,6 +884,10 @@ void EnergyModbusSnsInit(void) {
     uint8_t result = EnergyModbus->Begin(NrgMbsParam.serial_bps, NrgMbsParam.serial_config);
     if (result) {
       if (2 == result) { ClaimSerial(); }
+      uint32_t frame_size = 5 + (NrgMbsParam.block_regs * 2);
+      if (EnergyModbus->getRxBufferSize() < frame_size) {
+        EnergyModbus->setRxBufferSize(frame_size);  // Receive complete blocks on software serial
+      }
 
 #ifdef ENERGY_MODBUS_TICKER
       ticker_energy_modbus.attach_ms(NrgMbsParam.ticker_poll, EnergyModbusLoop);
@@ -799,6 +946,10 @@ uint32_t EnergyModbusResolution(uint32_t resolution) {
 }
 
 void EnergyModbusShow(bool json) {
+  if (json && NrgMbsParam.cycle_time) {
+    ResponseAppend_P(PSTR(",\"ModbusCycle\":%d"), NrgMbsParam.cycle_time);  // Time in ms to read all registers
+  }
+
   float values[ENERGY_MAX_PHASES];
   for (uint32_t i = 0; i < NrgMbsParam.user_adds; i++) {
     uint32_t reg_index = NRG_MBS_MAX_REGS + i;
@@ -25,6 +25,7 @@
 \*********************************************************************************************/
 
 #define XSNS_02                       2
+#define XSNS_02_FUNC                  (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #ifdef ESP32
   #if ESP_IDF_VERSION_MAJOR >= 5
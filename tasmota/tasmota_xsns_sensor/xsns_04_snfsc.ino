@@ -55,6 +55,7 @@
 \*********************************************************************************************/
 
 #define XSNS_04             4
+#define XSNS_04_FUNC        XFUNC_NONE
 
 uint16_t sc_value[5] = { 0 };
 
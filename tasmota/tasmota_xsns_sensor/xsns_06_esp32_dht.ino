@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XSNS_06          6
+#define XSNS_06_FUNC     (XFUNC_EVERY_SECOND)
 
 #ifndef DHT_MAX_SENSORS
 #define DHT_MAX_SENSORS  4
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_09              9
+#define XSNS_09_FUNC         (XFUNC_EVERY_SECOND)
 #define XI2C_10              10  // See I2CDEVICES.md
 
 #ifdef USE_BME680
@@ -54,6 +54,7 @@
 \*********************************************************************************************/
 
 #define XSNS_100                                100
+#define XSNS_100_FUNC                           (XFUNC_EVERY_250_MSECOND)
 #define XI2C_72                                 72        // See I2CDEVICES.md
 
 // setup of INA3221 config
@@ -28,6 +28,7 @@
 
 // Define driver ID
 #define XSNS_101                        101
+#define XSNS_101_FUNC                   (XFUNC_EVERY_SECOND)
 #define XI2C_73                         73  // See I2CDEVICES.md
 
 /* The default I2C address of this chip */
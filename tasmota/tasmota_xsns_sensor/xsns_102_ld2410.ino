@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_102                         102
+#define XSNS_102_FUNC                    (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 #define LD2410_BUFFER_SIZE               TM_SERIAL_BUFFER_SIZE  // 64
 #define LD2410_MAX_GATES                 8       // 0 to 8 (= 9) - DO NOT CHANGE
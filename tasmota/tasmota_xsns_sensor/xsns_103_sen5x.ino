@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_103 103
+#define XSNS_103_FUNC (XFUNC_EVERY_SECOND)
 #define XI2C_76 76 // See I2CDEVICES.md
 
 #define SEN5X_ADDRESS 0x69
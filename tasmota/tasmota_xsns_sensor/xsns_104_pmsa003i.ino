@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_104            104
+#define XSNS_104_FUNC       (XFUNC_EVERY_SECOND)
 #define XI2C_78             78  // See I2CDEVICES.md
 
 #define PMSA003I_ADDRESS    0x12
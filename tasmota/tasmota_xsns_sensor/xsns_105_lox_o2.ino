@@ -34,6 +34,7 @@
 \*********************************************************************************************/
 
 #define XSNS_105           105
+#define XSNS_105_FUNC      (XFUNC_EVERY_SECOND)
 
 #define LOX_O2_BAUDRATE    9600
 
@@ -33,6 +33,7 @@
 \*********************************************************************************************/
 
 #define XSNS_106                    106
+#define XSNS_106_FUNC               (XFUNC_EVERY_SECOND)
 
 #define XI2C_79                     79  // See I2CDEVICES.md
 
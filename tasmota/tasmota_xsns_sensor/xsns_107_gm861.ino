@@ -35,6 +35,7 @@
 \*********************************************************************************************/
 
 #define XSNS_107               107
+#define XSNS_107_FUNC          (XFUNC_LOOP | XFUNC_SLEEP_LOOP | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 //#define GM861_DECODE_AIM            // Decode AIM-id (+0k3 code)
 //#define GM861_HEARTBEAT             // Enable heartbeat
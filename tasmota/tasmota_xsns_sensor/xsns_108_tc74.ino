@@ -45,6 +45,7 @@
  \*********************************************************************************************/
 
 #define XSNS_108                108
+#define XSNS_108_FUNC           (XFUNC_EVERY_SECOND)
 #define XI2C_80                 80
 
 //#define TC74_MAX_SENSORS 8            // Support non-default/multiple I2C addresses
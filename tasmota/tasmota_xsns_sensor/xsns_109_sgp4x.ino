@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_109            109
+#define XSNS_109_FUNC       (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 #define XI2C_82             82  // See I2CDEVICES.md
 
 #define SGP4X_ADDRESS       0x59
@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_10                          10
+#define XSNS_10_FUNC                     (XFUNC_EVERY_SECOND)
 #define XI2C_11                          11    // See I2CDEVICES.md
 
 #define BH1750_ADDR1                     0x23
@@ -42,6 +42,7 @@
 \*********************************************************************************************/
 
 #define XSNS_110           110
+#define XSNS_110_FUNC      XFUNC_NONE
 #define XI2C_83            83      // See I2CDEVICES.md
 
 #define MAX17043_NAME      "MAX17043"
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_111             111
+#define XSNS_111_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_84             84  // See I2CDEVICES.md
 
 #define ENS16x_EVERYNSECONDS	5
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_112             112
+#define XSNS_112_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_85             85  // See I2CDEVICES.md
 
 #define ENS210_EVERYNSECONDS 	5
@@ -25,6 +25,7 @@
  */
 
 #define XSNS_113                      113
+#define XSNS_113_FUNC                 (XFUNC_EVERY_SECOND)
 
 
 /*********************************************************************************************\
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_114               114
+#define XSNS_114_FUNC          (XFUNC_EVERY_SECOND)
 #define XI2C_86                86  // See I2CDEVICES.md
 
 #ifndef AMSX915_ADDR
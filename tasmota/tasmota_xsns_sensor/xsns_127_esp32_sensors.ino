@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XSNS_127                 127
+#define XSNS_127_FUNC            XFUNC_NONE
 
 #if CONFIG_IDF_TARGET_ESP32 && (ESP_IDF_VERSION_MAJOR < 5)         // Hall sensor is no more supported in esp-idf 5
 
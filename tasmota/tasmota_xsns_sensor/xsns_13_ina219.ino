@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_13                                 13
+#define XSNS_13_FUNC                            (XFUNC_EVERY_SECOND)
 #define XI2C_14                                 14        // See I2CDEVICES.md
 
 #ifndef INA219_MAX_COUNT
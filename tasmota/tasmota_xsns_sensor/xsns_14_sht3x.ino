@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_14             14
+#define XSNS_14_FUNC        XFUNC_NONE
 #define XI2C_15             15         // See I2CDEVICES.md
 
 #define SHT3X_TYPES         3          // SHT3X, SHTCX and SHT4X
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_16             16
+#define XSNS_16_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_16             16  // See I2CDEVICES.md
 
 #include <Tsl2561Util.h>
@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XSNS_18             18
+#define XSNS_18_FUNC        (XFUNC_EVERY_SECOND)
 
 #include <TasmotaSerial.h>
 
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_21             21
+#define XSNS_21_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_18             18  // See I2CDEVICES.md
 
 #define SGP30_ADDRESS       0x58
@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XSNS_22                   22
+#define XSNS_22_FUNC              (XFUNC_EVERY_SECOND)
 
 #ifndef SR04_MAX_SENSOR_DISTANCE
 #define SR04_MAX_SENSOR_DISTANCE  500
@@ -35,6 +35,7 @@
 /* Defines */
 /*********************************************************************************************/
 #define XSNS_23                            23
+#define XSNS_23_FUNC                       (XFUNC_EVERY_SECOND)
 
 #define ME007_VERSION                      "1.0.0"                                              /**< Driver version X.Y.Z: X:Major, Y: Minor, Z: Patch */
 
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_24                             24
+#define XSNS_24_FUNC                        (XFUNC_EVERY_SECOND)
 #define XI2C_19                             19  // See I2CDEVICES.md
 
 #define SI114X_ADDR                         0X60
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_25             25
+#define XSNS_25_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_87             87  // See I2CDEVICES.md
 
 #include "SPL06-007.h"
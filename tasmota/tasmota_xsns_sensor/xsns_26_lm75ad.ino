@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_26                 26
+#define XSNS_26_FUNC            XFUNC_NONE
 #define XI2C_20                 20  // See I2CDEVICES.md
 
 #define LM75AD_ADDRESS1					0x48
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_29                   29
+#define XSNS_29_FUNC              (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 #define XI2C_22                   22  // See I2CDEVICES.md
 
 /*
@@ -215,6 +215,7 @@
 
 // Define driver ID
 #define XSNS_33                         33
+#define XSNS_33_FUNC                    (XFUNC_EVERY_SECOND)
 #define XI2C_71                         71  // See I2CDEVICES.md
 
 /* The default I2C address of this chip */
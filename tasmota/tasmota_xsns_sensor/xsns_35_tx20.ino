@@ -49,6 +49,7 @@
 \*********************************************************************************************/
 
 #define XSNS_35                  35
+#define XSNS_35_FUNC             (XFUNC_EVERY_SECOND)
 
 #if defined(USE_TX20_WIND_SENSOR) && defined(USE_TX23_WIND_SENSOR)
 #undef USE_TX20_WIND_SENSOR
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XSNS_40                                     40
+#define XSNS_40_FUNC                                (XFUNC_EVERY_250_MSECOND)
 
 #include <TasmotaSerial.h>
 
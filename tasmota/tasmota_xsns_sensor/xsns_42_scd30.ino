@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XSNS_42                       42
+#define XSNS_42_FUNC                  (XFUNC_EVERY_SECOND)
 #define XI2C_29                       29  // See I2CDEVICES.md
 
 //#define SCD30_DEBUG
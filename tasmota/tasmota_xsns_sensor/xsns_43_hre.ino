@@ -47,6 +47,7 @@
 \*********************************************************************************************/
 
 #define XSNS_43             43
+#define XSNS_43_FUNC        (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 
 enum hre_states {
    hre_idle,    // Initial state,
@@ -23,6 +23,7 @@
 \*********************************************************************************************/
 
 #define XSNS_47              47
+#define XSNS_47_FUNC         (XFUNC_EVERY_SECOND)
 
 #include "Adafruit_MAX31865.h"
 
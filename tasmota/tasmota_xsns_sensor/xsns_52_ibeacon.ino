@@ -24,6 +24,7 @@
 #ifdef USE_IBEACON
 
 #define XSNS_52                       52
+#define XSNS_52_FUNC                  (XFUNC_LOOP | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 // keyfob expires after N seconds
 #define IB_TIMEOUT_INTERVAL 30
@@ -24,6 +24,7 @@
 #ifdef USE_SML_M
 
 #define XSNS_53 53
+#define XSNS_53_FUNC (XFUNC_LOOP | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 // this driver depends on use USE_SCRIPT !!!
 
@@ -462,6 +463,24 @@ typedef union {
 #define SML_PREFIX_SIZE 8
 #endif
 
+// incremental sml parser, emits each list entry (0x77) as soon as it is complete
+#define SML_TLV_DEPTH 12
+struct SML_TLV {
+  uint8_t left[SML_TLV_DEPTH];  // elements left in each open list
+  uint8_t depth;
+  uint8_t entry;                // depth of list entry being recorded, 0 if none
+  uint8_t state;
+  uint8_t type;                 // type of current tl field
+  uint16_t len;                 // length of current tl field
+  uint8_t tlbytes;              // size of current tl field
+  uint16_t skip;                // data bytes left in current element
+  uint8_t esc;                  // escape sequence bytes seen
+  bool active;                  // use incremental parser instead of shift and scan
+  bool calc;                    // sml file complete, evaluate calculated lines
+};
+
+enum SML_TLV_STATES { SML_TLV_WAIT, SML_TLV_TL, SML_TLV_TLMORE, SML_TLV_DATA, SML_TLV_ESC };
+
 struct METER_DESC {
   int8_t srcpin;
   uint8_t type;
@@ -477,6 +496,7 @@ struct METER_DESC {
   uint8_t sopt;
   TRX_EN_TYPE trx_en;
   bool shift_mode;
+  struct SML_TLV tlv;
   uint16_t sbsiz;
   uint8_t *sbuff;
   uint16_t spos;
@@ -586,6 +606,17 @@ int8_t index;
 };
 
 
+// compiled decoder line, see SML_CompileDesc()
+#define SML_PATTERN_SIZE 12
+struct SML_DESC_LINE {
+  const char *mp;               // descriptor after meter number
+  const char *at;               // '@' after compiled pattern
+  uint16_t vindex;
+  uint8_t dindex;
+  uint8_t plen;                 // length of compiled sml pattern, 0 if interpreted
+  uint8_t pattern[SML_PATTERN_SIZE];
+};
+
 struct SML_GLOBS {
   uint8_t sml_send_blocks;
   uint8_t sml_100ms_cnt;
@@ -593,6 +624,9 @@ struct SML_GLOBS {
   uint8_t meters_used;
   uint8_t maxvars;
   uint8_t *meter_p;
+  struct SML_DESC_LINE *desc;
+  uint16_t desc_first[MAX_METERS];
+  uint16_t desc_count[MAX_METERS];
   double *meter_vars;
   uint8_t *dvalid;
   double dvalues[MAX_DVARS];
@@ -1409,6 +1443,144 @@ void sml_empty_receiver(uint32_t meters) {
   }
 }
 
+// sml entry complete, decode it from start of sbuff
+void sml_tlv_entry(uint32_t meters) {
+  struct METER_DESC *mp = &meter_desc[meters];
+  mp->tlv.entry = 0;
+  if (mp->spos < mp->sbsiz) {
+    memset(&mp->sbuff[mp->spos], 0, mp->sbsiz - mp->spos);
+  }
+  SML_Decode(meters);
+  mp->sbuff[0] = 0;   // no match on later calls
+  mp->spos = 0;
+}
+
+// element complete, close finished lists
+void sml_tlv_element(uint32_t meters) {
+  struct SML_TLV *tp = &meter_desc[meters].tlv;
+  tp->state = SML_TLV_TL;
+  while (tp->depth) {
+    if (--tp->left[tp->depth - 1]) {
+      return;
+    }
+    tp->depth--;
+    if (tp->entry == tp->depth + 1) {
+      sml_tlv_entry(meters);
+    }
+  }
+}
+
+// feed one byte to the incremental sml parser
+void sml_tlv_byte(uint32_t meters, uint8_t iob) {
+  struct METER_DESC *mp = &meter_desc[meters];
+  struct SML_TLV *tp = &mp->tlv;
+
+  if (tp->entry && mp->spos < mp->sbsiz) {
+    mp->sbuff[mp->spos++] = iob;
+  }
+
+  switch (tp->state) {
+    case SML_TLV_WAIT:
+      // wait for 1b1b1b1b
+      if (iob == 0x1b) {
+        tp->esc++;
+        if (tp->esc >= 4) {
+          tp->esc = 0;
+          tp->state = SML_TLV_ESC;
+        }
+      } else {
+        tp->esc = 0;
+      }
+      return;
+    case SML_TLV_ESC:
+      // 01010101 starts a file, anything else (1a = end) waits for next start
+      tp->esc++;
+      if (iob != 0x01) {
+        tp->esc = 0;
+        tp->state = SML_TLV_WAIT;
+      } else if (tp->esc >= 4) {
+        tp->esc = 0;
+        tp->depth = 0;
+        tp->entry = 0;
+        tp->state = SML_TLV_TL;
+      }
+      return;
+    case SML_TLV_DATA:
+      if (!--tp->skip) {
+        sml_tlv_element(meters);
+      }
+      return;
+    case SML_TLV_TL:
+      if (!tp->depth) {
+        if (iob == 0x1b) {
+          // escape sequence at end of file, all entries are decoded
+          tp->esc = 1;
+          tp->state = SML_TLV_WAIT;
+          tp->calc = true;
+          SML_Decode(meters);
+          tp->calc = false;
+          return;
+        }
+        if (iob == 0x00) {
+          // fill bytes between messages
+          return;
+        }
+      }
+      tp->type = iob & 0x70;
+      tp->len = iob & 0x0f;
+      tp->tlbytes = 1;
+      if (iob & 0x80) {
+        tp->state = SML_TLV_TLMORE;
+        return;
+      }
+      break;
+    case SML_TLV_TLMORE:
+      tp->len = (tp->len << 4) | (iob & 0x0f);
+      tp->tlbytes++;
+      if ((iob & 0x80) && (tp->tlbytes < 4)) {
+        return;
+      }
+      break;
+  }
+
+  // tl field complete
+  if (tp->type == 0x70) {
+    // list
+    if (tp->depth >= SML_TLV_DEPTH) {
+      tp->state = SML_TLV_WAIT;
+      tp->entry = 0;
+      return;
+    }
+    if (tp->len == 7 && tp->tlbytes == 1) {
+      // list entry, innermost one is recorded
+      tp->entry = tp->depth + 1;
+      mp->sbuff[0] = iob;
+      mp->spos = 1;
+    }
+    tp->left[tp->depth++] = tp->len;
+    if (tp->len) {
+      tp->state = SML_TLV_TL;
+    } else {
+      tp->depth--;
+      sml_tlv_element(meters);
+    }
+    return;
+  }
+  if (tp->type != 0x00 && tp->type < 0x40) {
+    // unknown type, resync
+    tp->state = SML_TLV_WAIT;
+    tp->entry = 0;
+    return;
+  }
+  // 0x00 end of message and 0x01 not set have no data
+  tp->skip = (tp->len > tp->tlbytes) ? tp->len - tp->tlbytes : 0;
+  if (tp->skip) {
+    tp->state = SML_TLV_DATA;
+  } else {
+    sml_tlv_element(meters);
+  }
+}
+
 void sml_shift_in(uint32_t meters, uint32_t shard) {
   uint32_t count;
 
@@ -1479,7 +1651,11 @@ void sml_shift_in(uint32_t meters, uint32_t shard) {
       break;
     case 's':
       // binary obis = sml
-      mp->sbuff[mp->sbsiz - 1] = iob;
+      if (mp->tlv.active) {
+        sml_tlv_byte(meters, iob);
+      } else {
+        mp->sbuff[mp->sbsiz - 1] = iob;
+      }
       break;
     case 'r':
       // raw with shift
@@ -1626,6 +1802,7 @@ void sml_shift_in(uint32_t meters, uint32_t shard) {
   sb_counter++;
 
   if (mp->shift_mode) {
+    // incremental sml parser decodes entries and calculated lines itself
     SML_Decode(meters);
   }
 }
@@ -1758,45 +1935,26 @@ double sml_get_obis_value(uint8_t *data) {
 
 
 void SML_Decode(uint8_t index) {
-  const char *mp = (const char*)sml_globs.meter_p;
+  const char *mp;
   int8_t mindex;
   uint8_t *cp;
-  uint8_t dindex = 0, vindex = 0;
+  uint8_t dindex, vindex;
   delay(0);
 
-  if (!sml_globs.ready) {
+  if (!sml_globs.ready || !sml_globs.desc || index >= MAX_METERS) {
     return;
   }
 
-  while (mp != NULL) {
-    // check list of defines
-    if (*mp == 0) break;
-
-    // new section
-    mindex = ((*mp) & 7) - 1;
-
-    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
-    mp += 2;
-    if (*mp == '=' && *(mp+1) == 'h') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
-    }
-
-    if (*mp == '=' && *(mp+1) == 's') {
-      mp = strchr(mp, '|');
-      if (mp) mp++;
-      continue;
-    }
+  // only the lines of this meter, see SML_CompileDesc()
+  struct SML_DESC_LINE *dl = &sml_globs.desc[sml_globs.desc_first[index]];
+  for (uint32_t line = 0; line < sml_globs.desc_count[index]; line++, dl++) {
+    mp = dl->mp;
+    vindex = dl->vindex;
+    dindex = dl->dindex;
+    mindex = index;
 
-    // =d must handle dindex
-    if (*mp == '=' && *(mp + 1) == 'd') {
-      if (index != mindex) {
-        dindex++;
-      }
-    }
-
-    if (index != mindex) goto nextsect;
+    // incremental sml parser is recording an entry, only calculated lines
+    if (meter_desc[mindex].tlv.entry && *mp != '=') continue;
 
     // start of serial source buffer
     cp = meter_desc[mindex].sbuff;
@@ -1806,8 +1964,8 @@ void SML_Decode(uint8_t index) {
       // calculated entry, check syntax
       mp++;
       // do math m 1+2+3
-      if (*mp == 'm' && !sb_counter) {
-        // only every 256 th byte
+      if (*mp == 'm' && (meter_desc[mindex].tlv.active ? meter_desc[mindex].tlv.calc : !sb_counter)) {
+        // only every 256 th byte, or once per file with the incremental sml parser
         // else it would be calculated every single serial byte
         mp++;
         while (*mp == ' ') mp++;
@@ -1910,24 +2068,19 @@ void SML_Decode(uint8_t index) {
             }
           }
           //sml_globs.dvalid[vindex] = 1;
-          dindex++;
         }
-      } else if (*mp == 'h') {
-        // skip html tag line
-        mp = strchr(mp, '|');
-        if (mp) mp++;
-        continue;
-      } else if (*mp == 's') {
-        // skip spec option tag line
-        mp = strchr(mp, '|');
-        if (mp) mp++;
-        continue;
       }
     } else {
       // compare value
       uint8_t found = 1;
       double ebus_dval = 99;
       double mbus_dval = 99;
+      if (dl->plen) {
+        // compiled sml pattern
+        if (memcmp(cp, dl->pattern, dl->plen)) continue;
+        cp += dl->plen;
+        mp = dl->at;
+      }
       while (*mp != '@') {
         if (found == 0) {
           // skip rest of decoder part
@@ -2463,13 +2616,7 @@ void SML_Decode(uint8_t index) {
       }
       //AddLog(LOG_LEVEL_INFO, PSTR("set valid in line %d"), vindex);
     }
-nextsect:
-    // next section
-    if (vindex < sml_globs.maxvars - 1) {
-      vindex++;
-    }
-    mp = strchr(mp, '|');
-    if (mp) mp++;
+nextsect:;
   }
 }
 
@@ -3040,6 +3187,110 @@ void reset_sml_vars(uint16_t maxmeters) {
 }
 
 
+/*********************************************************************************************\
+ * Compile decoder lines once
+ *
+ * Meter number, value index and delta index of each line are resolved and the lines are grouped
+ * by meter, so SML_Decode() only walks the lines of the meter that received data.
+ * Plain hex patterns of sml meters are converted to binary for memcmp(). If all patterns
+ * of an sml meter start a list entry (77...), the meter uses the incremental sml parser
+ * instead of shifting every byte through sbuff.
+\*********************************************************************************************/
+
+void SML_CompileDesc(void) {
+  if (sml_globs.desc) {
+    free(sml_globs.desc);
+    sml_globs.desc = 0;
+  }
+  memset(sml_globs.desc_count, 0, sizeof(sml_globs.desc_count));
+
+  // count lines per meter
+  uint16_t lines = 0;
+  for (const char *mp = (const char*)sml_globs.meter_p; mp && *mp; ) {
+    int8_t mindex = ((*mp) & 7) - 1;
+    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
+    if (!(mp[2] == '=' && (mp[3] == 'h' || mp[3] == 's'))) {
+      sml_globs.desc_count[mindex]++;
+      lines++;
+    }
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+  }
+  if (!lines) return;
+
+  sml_globs.desc = (struct SML_DESC_LINE*)calloc(lines, sizeof(struct SML_DESC_LINE));
+  if (!sml_globs.desc) {
+    AddLog(LOG_LEVEL_INFO, PSTR("sml memory error!"));
+    return;
+  }
+
+  uint16_t fill[MAX_METERS];
+  uint16_t first = 0;
+  for (uint32_t meters = 0; meters < MAX_METERS; meters++) {
+    sml_globs.desc_first[meters] = first;
+    fill[meters] = first;
+    first += sml_globs.desc_count[meters];
+  }
+
+  bool tlv[MAX_METERS];
+  for (uint32_t meters = 0; meters < MAX_METERS; meters++) {
+    tlv[meters] = (meters < sml_globs.meters_used) && (meter_desc[meters].type == 's');
+  }
+
+  uint16_t vindex = 0;
+  uint8_t dindex = 0;
+  for (const char *mp = (const char*)sml_globs.meter_p; mp && *mp; ) {
+    int8_t mindex = ((*mp) & 7) - 1;
+    if (mindex < 0 || mindex >= sml_globs.meters_used) mindex = 0;
+    const char *lp = mp + 2;
+    mp = strchr(mp, '|');
+    if (mp) mp++;
+    if (*lp == '=' && (*(lp + 1) == 'h' || *(lp + 1) == 's')) continue;
+
+    struct SML_DESC_LINE *dl = &sml_globs.desc[fill[mindex]++];
+    dl->mp = lp;
+    dl->vindex = vindex;
+    if (vindex < sml_globs.maxvars - 1) {
+      vindex++;
+    }
+    if (*lp == '=') {
+      if (*(lp + 1) == 'd') {
+        dl->dindex = dindex++;
+      }
+      continue;
+    }
+    if (meter_desc[mindex].type == 's') {
+      // hex pattern up to '@'
+      const char *at = lp;
+      while (isxdigit(*at)) at++;
+      uint32_t plen = (at - lp) / 2;
+      if (*at == '@' && !((at - lp) & 1) && plen && plen <= SML_PATTERN_SIZE) {
+        for (uint32_t cnt = 0; cnt < plen; cnt++) {
+          dl->pattern[cnt] = (hexnibble(lp[cnt * 2]) << 4) | hexnibble(lp[cnt * 2 + 1]);
+        }
+        dl->plen = plen;
+        dl->at = at;
+      }
+      if (dl->plen < 2 || dl->pattern[0] != 0x77) {
+        tlv[mindex] = false;
+      }
+    }
+  }
+
+  for (uint32_t meters = 0; meters < sml_globs.meters_used; meters++) {
+    struct METER_DESC *mp = &meter_desc[meters];
+    memset(&mp->tlv, 0, sizeof(mp->tlv));
+#ifdef USE_SML_DECRYPT
+    if (mp->use_crypt) continue;
+#endif
+    if (tlv[meters] && mp->shift_mode && mp->sbuff) {
+      mp->tlv.active = true;
+      mp->shift_mode = false;
+      mp->spos = 0;
+    }
+  }
+}
+
 void SML_Init(void) {
 
   sml_globs.ready = false;
@@ -3665,6 +3916,8 @@ next_line:
 #endif
   }
 
+  SML_CompileDesc();
+
   sml_globs.ready = true;
 }
 
@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_56             56
+#define XSNS_56_FUNC        (XFUNC_EVERY_SECOND)
 
 #include <hpma115S0.h>
 #include <TasmotaSerial.h>
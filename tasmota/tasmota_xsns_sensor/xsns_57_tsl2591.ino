@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XSNS_57             57
+#define XSNS_57_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_40             40    // See I2CDEVICES.md
 
 #define TSL2591_ADDRESS     0x29  // Used library only supports this address only
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_58              58
+#define XSNS_58_FUNC         (XFUNC_EVERY_SECOND)
 #define XI2C_41              41  // See I2CDEVICES.md
 
 #define DHT12_ADDR           0x5C
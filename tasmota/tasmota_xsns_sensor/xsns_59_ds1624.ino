@@ -27,6 +27,7 @@
 \*********************************************************************************************/
 
 #define XSNS_59                 59
+#define XSNS_59_FUNC            (XFUNC_EVERY_SECOND)
 #define XI2C_42                 42  // See I2CDEVICES.md
 
 #define DS1624_MEM_REGISTER    0x17  //only for ds1624, don't exists on 1621
@@ -71,6 +71,7 @@
 \*********************************************************************************************/
 
 #define XSNS_61             61
+#define XSNS_61_FUNC        (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <vector>
 #ifdef USE_MI_DECRYPTION
@@ -48,6 +48,7 @@
 #ifdef USE_HM10
 
 #define XSNS_62                    62
+#define XSNS_62_FUNC               (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <TasmotaSerial.h>
 #include <vector>
@@ -59,6 +59,7 @@
 #endif
 
 #define XSNS_62                    62
+#define XSNS_62_FUNC               (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <vector>
 #include "freertos/ringbuf.h"
@@ -83,6 +83,7 @@
 #ifdef USE_MI_ESP32
 
 #define XSNS_62                    62
+#define XSNS_62_FUNC               (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 #define USE_MI_DECRYPTION
 
 #include <vector>
@@ -47,6 +47,7 @@
 \*********************************************************************************************/
 
 #define XSNS_63              63
+#define XSNS_63_FUNC         (XFUNC_EVERY_SECOND)
 #define XI2C_43              43  // See I2CDEVICES.md
 
 #define AHT1X_ADDR1          0x38
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_64                  64
+#define XSNS_64_FUNC             (XFUNC_EVERY_SECOND)
 
 #define HRXL_READ_TIMEOUT        400 // us; enough for 6 bytes@9600bps
 
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_65             65
+#define XSNS_65_FUNC        (XFUNC_EVERY_50_MSECOND | XFUNC_EVERY_SECOND)
 #define XI2C_45             45      // See I2CDEVICES.md
 
 #define HDC1080_ADDR        0x40
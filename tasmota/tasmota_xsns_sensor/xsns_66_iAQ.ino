@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_66            66
+#define XSNS_66_FUNC       XFUNC_NONE
 #define XI2C_46            46      // See I2CDEVICES.md
 
 #define I2_ADR_IAQ         0x5a    // collides with MLX90614 and maybe others
@@ -24,6 +24,7 @@
 \*********************************************************************************************/
 
 #define XSNS_68             68
+#define XSNS_68_FUNC        (XFUNC_EVERY_SECOND)
 
 #define D_WINDMETER_NAME "WindMeter"
 
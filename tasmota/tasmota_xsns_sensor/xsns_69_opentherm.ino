@@ -20,6 +20,7 @@
 #ifdef USE_OPENTHERM
 
 #define XSNS_69 69
+#define XSNS_69_FUNC (XFUNC_LOOP | XFUNC_EVERY_100_MSECOND | XFUNC_EVERY_SECOND)
 
 #include <OpenTherm.h>
 
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_70             70
+#define XSNS_70_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_49             49  // See I2CDEVICES.md
 
 
@@ -26,6 +26,7 @@
 \*********************************************************************************************/
 
 #define XSNS_71             71
+#define XSNS_71_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_50             50  // See I2CDEVICES.md
 
 #include "Adafruit_VEML7700.h"
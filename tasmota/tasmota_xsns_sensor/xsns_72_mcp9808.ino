@@ -28,6 +28,7 @@
 \*********************************************************************************************/
 
 #define XSNS_72              72
+#define XSNS_72_FUNC         (XFUNC_EVERY_SECOND)
 #define XI2C_51              51  // See I2CDEVICES.md
 
 #include "Adafruit_MCP9808.h"
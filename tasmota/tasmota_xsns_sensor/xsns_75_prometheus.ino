@@ -30,9 +30,35 @@
  * [2]
  * https://github.com/prometheus/docs/blob/master/content/docs/practices/naming.md
  *
+ * Metrics are kept in a registry of pre-formatted families which is refreshed
+ * from the teleperiod sensor data or, when older than PROMETHEUS_MAX_AGE
+ * seconds, by a scrape. Scrapes stream the registry as is, in the OpenMetrics
+ * format [3] if requested by the Accept header, and answer 304 Not Modified
+ * to an If-None-Match header matching the ETag of the current registry.
+ *
+ * [3]
+ * https://github.com/OpenObservability/OpenMetrics/blob/main/specification/OpenMetrics.md
+ *
 \*********************************************************************************************/
 
 #define XSNS_75                    75
+#define XSNS_75_FUNC               XFUNC_NONE
+
+#ifndef PROMETHEUS_MAX_AGE
+#define PROMETHEUS_MAX_AGE         10    // Max number of seconds a scrape reuses the registry before pulling sensor data
+#endif
+
+typedef struct PromFamily_t {
+  String name;                           // Metric name without prefix, e.g. "sensors_temperature_celsius"
+  String samples;                        // Pre-formatted sample lines
+  uint8_t flags;                         // kPromMetricGauge or kPromMetricCounter
+} PromFamily_t;
+
+struct {
+  LList<PromFamily_t> families;
+  uint32_t update_time = 0;              // Time in ms of the last registry update
+  uint32_t generation = 0;               // Changes on every update, used as ETag. 0 if never scraped
+} Prom;
 
 // Find appropriate unit for measurement type.
 const char *UnitfromType(const char *type)
@@ -82,33 +108,33 @@ const uint8_t
   kPromMetricCounter = _BV(1),
   kPromMetricTypeMask = kPromMetricGauge | kPromMetricCounter;
 
-// Format and send a Prometheus metric to the client. Use flags to configure
+// Find the samples of the registry family of a metric, adding it if needed.
+// Samples of a family are grouped so the type is only written once.
+String &PromFamilySamples(const char *name, uint8_t flags) {
+  for (auto &family : Prom.families) {
+    if (!strcmp_P(family.name.c_str(), name)) {
+      return family.samples;
+    }
+  }
+  PromFamily_t &family = Prom.families.addToLast();
+  family.name = (const __FlashStringHelper *)name;
+  family.flags = flags;
+  return family.samples;
+}
+
+// Format and add a Prometheus metric to the registry. Use flags to configure
 // the type. Labels must be supplied in tuples of two character array pointers
 // and terminated by nullptr.
 void WritePromMetric(const char *name, uint8_t flags, const char *value, va_list labels) {
-  PGM_P const prefix = PSTR("tasmota_");
   PGM_P tmp;
   String lval;
 
-  switch (flags & kPromMetricTypeMask) {
-  case kPromMetricGauge:
-    tmp = PSTR("gauge");
-    break;
-  case kPromMetricCounter:
-    tmp = PSTR("counter");
-    break;
-  default:
-    tmp = nullptr;
-    break;
-  }
-
-  if (tmp != nullptr) {
-    WSContentSend_P(PSTR("# TYPE %s%s %s\n"), prefix, name, tmp);
-  }
-
-  WSContentSend_P(PSTR("%s%s{"), prefix, name);
+  String &sample = PromFamilySamples(name, flags);
+  sample += F("tasmota_");
+  sample += (const __FlashStringHelper *)name;
+  sample += '{';
 
-  for (const char *sep = PSTR(""); ; sep = PSTR(",")) {
+  for (bool first = true; ; first = false) {
     if ((tmp = va_arg(labels, PGM_P)) == nullptr) {
       break;
     }
@@ -127,10 +153,18 @@ void WritePromMetric(const char *name, uint8_t flags, const char *value, va_list
     lval.replace("\"", "\\\"");
     lval.replace("\n", "\\n");
 
-    WSContentSend_P(PSTR("%s%s=\"%s\""), sep, tmp, lval.c_str());
+    if (!first) {
+      sample += ',';
+    }
+    sample += (const __FlashStringHelper *)tmp;
+    sample += F("=\"");
+    sample += lval;
+    sample += '"';
   }
 
-  WSContentSend_P(PSTR("} %s\n"), value);
+  sample += F("} ");
+  sample += value;
+  sample += '\n';
 }
 
 void WritePromMetricInt32(const char *name, uint8_t flags, const int32_t value, ...) {
@@ -185,12 +219,12 @@ void WritePromMemoryMetrics(const char *type, uint32_t size, uint32_t avail, uin
   }
 }
 
-void HandleMetrics(void) {
-  if (!HttpCheckPriviledgedAccess()) { return; }
-
-  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Prometheus"));
-
-  WSContentBegin(200, CT_PLAIN);
+// Rebuild the registry from current device state and the sensor JSON.
+void PromRegistryUpdate(const char *sensor_json) {
+  // Keep families and their buffers to limit heap fragmentation
+  for (auto &family : Prom.families) {
+    family.samples = "";
+  }
 
   char namebuf[64];
 
@@ -282,9 +316,7 @@ void HandleMetrics(void) {
       (TasmotaGlobal.power & mask), nullptr);
   }
 
-  ResponseClear();
-  MqttShowSensor(true); //Pull sensor data
-  String jsonStr = ResponseData();
+  String jsonStr = sensor_json;          // JsonParser destroys its input
   JsonParser parser((char *)jsonStr.c_str());
   JsonParserObject root = parser.getRootObject();
   if (root) { // did JSON parsing succeed?
@@ -345,6 +377,78 @@ void HandleMetrics(void) {
     }
   }
 
+  Prom.update_time = millis();
+  Prom.generation++;
+}
+
+// Called with full sensor data in ResponseData. Keeps the registry of a scraped
+// device up to date without pulling sensors again on the next scrape.
+void PrometheusProcess(void) {
+  if (!Prom.generation) { return; }    // Never scraped, do not spend memory
+  PromRegistryUpdate(ResponseData());
+}
+
+void HandleMetrics(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Prometheus"));
+
+  if (!Prom.generation || (TimePassedSince(Prom.update_time) >= PROMETHEUS_MAX_AGE * 1000)) {
+    if (!Prom.generation) {
+      Prom.generation = HwRandom();      // Avoid ETag matches across restarts
+    }
+    ResponseClear();
+    MqttShowSensor(true);                // Pull sensor data
+    PromRegistryUpdate(ResponseData());
+  }
+
+  bool openmetrics = (Webserver->header(F("Accept")).indexOf(F("application/openmetrics-text")) >= 0);
+  char etag[16];
+  snprintf_P(etag, sizeof(etag), PSTR("\"%08X%s\""), Prom.generation, (openmetrics) ? "o" : "");
+
+  Webserver->client().flush();
+  WSHeaderSend();
+  Webserver->sendHeader(F("ETag"), etag);
+  if (Webserver->header(F("If-None-Match")).equals(etag)) {
+    WSSend(304, CT_PLAIN, "");
+    return;
+  }
+
+  char ct[56];
+  strcpy_P(ct, (openmetrics) ? PSTR("application/openmetrics-text; version=1.0.0; charset=utf-8")
+                             : PSTR("text/plain; version=0.0.4; charset=utf-8"));
+  Webserver->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  Webserver->send(200, ct, "");          // Signal start of chunked content
+  _WSContentInit();
+
+  for (auto &family : Prom.families) {
+    if (!family.samples.length()) { continue; }  // Metric no longer reported
+    uint32_t name_len = family.name.length();
+    PGM_P type = nullptr;
+    switch (family.flags & kPromMetricTypeMask) {
+    case kPromMetricGauge:
+      type = PSTR("gauge");
+      break;
+    case kPromMetricCounter:
+      type = PSTR("counter");
+      if (openmetrics) {
+        // OpenMetrics counter samples need the _total suffix which is not part of the family name
+        if (family.name.endsWith(F("_total"))) {
+          name_len -= 6;
+        } else {
+          type = PSTR("unknown");
+        }
+      }
+      break;
+    }
+    if (type != nullptr) {
+      WSContentSend_P(PSTR("# TYPE tasmota_%.*s %s\n"), name_len, family.name.c_str(), type);
+    }
+    WSContentSend(family.samples.c_str(), family.samples.length());
+  }
+  if (openmetrics) {
+    WSContentSend_P(PSTR("# EOF\n"));
+  }
   WSContentEnd();
 }
 
@@ -30,6 +30,7 @@
 \*********************************************************************************************/
 
 #define XSNS_76     76
+#define XSNS_76_FUNC (XFUNC_EVERY_SECOND)
 
 #include <TasmotaSerial.h>
 TasmotaSerial *DYPSerial = nullptr;
@@ -44,6 +44,7 @@
 \*********************************************************************************************/
 
 #define XSNS_77     77
+#define XSNS_77_FUNC (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 #define XI2C_54     54  // See I2CDEVICES.md
 
 #include "VL53L1X.h"
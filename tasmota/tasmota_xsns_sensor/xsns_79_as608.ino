@@ -32,6 +32,7 @@
 \*********************************************************************************************/
 
 #define XSNS_79               79
+#define XSNS_79_FUNC          (XFUNC_EVERY_250_MSECOND)
 
 //#define USE_AS608_MESSAGES
 
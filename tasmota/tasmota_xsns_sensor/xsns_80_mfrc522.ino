@@ -36,6 +36,7 @@
 \*********************************************************************************************/
 
 #define XSNS_80        80
+#define XSNS_80_FUNC   (XFUNC_EVERY_250_MSECOND)
 
 //#define USE_RC522_DATA_FUNCTION              // Add support for reading data block content (+0k4 code)
 //#define USE_RC522_TYPE_INFORMATION           // Add support for showing card type (+0k4 code)
@@ -51,6 +51,7 @@
 \*********************************************************************************************/
 
 #define XSNS_83                      83
+#define XSNS_83_FUNC                 (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 
 #ifndef NEOPOOL_MODBUS_SPEED
 #define NEOPOOL_MODBUS_SPEED         19200
@@ -34,6 +34,7 @@
 \*********************************************************************************************/
 
 #define XSNS_84                     84
+#define XSNS_84_FUNC                (XFUNC_EVERY_250_MSECOND | XFUNC_EVERY_SECOND)
 #define XI2C_57                     57  // See I2CDEVICES.md
 
 #define TOF10120_ADDRESS            0x52
@@ -62,6 +62,7 @@
 \*****************************************************************************/
 
 #define XSNS_86 86
+#define XSNS_86_FUNC (XFUNC_EVERY_SECOND)
 
 // Default baudrate
 #define TFMP_SPEED 9600
@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XSNS_87              87
+#define XSNS_87_FUNC         (XFUNC_EVERY_50_MSECOND)
 
 #ifndef MCP2515_BITRATE
   #define MCP2515_BITRATE  CAN_100KBPS
@@ -39,6 +39,7 @@
 \*********************************************************************************************/
 
 #define XSNS_87              87
+#define XSNS_87_FUNC         (XFUNC_EVERY_50_MSECOND)
 
 // set defaults if not defined
 #ifndef MCP2515_BITRATE
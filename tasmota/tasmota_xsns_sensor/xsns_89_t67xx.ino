@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_89 89
+#define XSNS_89_FUNC (XFUNC_EVERY_SECOND)
 #define XI2C_61 61 // See I2CDEVICES.md
 
 #define T67XX_I2C_ADDR 0x15
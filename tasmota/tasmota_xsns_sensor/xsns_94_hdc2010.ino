@@ -31,6 +31,7 @@
 \*********************************************************************************************/
 
 #define XSNS_94             94
+#define XSNS_94_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_64             64      // See I2CDEVICES.md
 
 #define HDC2010_ADDR        0x40
@@ -34,6 +34,7 @@
 \*********************************************************************************************/
 
 #define XSNS_95                      95
+#define XSNS_95_FUNC                 (XFUNC_EVERY_SECOND)
 
 enum CM11FilterOptions {CM1107_FILTER_OFF, CM1107_FILTER_FAST, CM1107_FILTER_MEDIUM, CM1107_FILTER_MEDIUM2, CM1107_FILTER_SLOW};
 
@@ -23,6 +23,7 @@
 #ifdef USE_FLOWRATEMETER
 
 #define XSNS_96                       96
+#define XSNS_96_FUNC                  (XFUNC_EVERY_250_MSECOND)
 
 
 #define FLOWRATEMETER_WEIGHT_AVG_SAMPLE   20  // number of samples for smooth weigted average
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_97              97
+#define XSNS_97_FUNC         (XFUNC_EVERY_SECOND)
 #define XI2C_68              68  // See I2CDEVICES.md
 
 #define HYT_ADDR           0x28  // I2C address of HYT 221, 271, 371 etc.
@@ -29,6 +29,7 @@
 \*********************************************************************************************/
 
 #define XSNS_98             98
+#define XSNS_98_FUNC        (XFUNC_EVERY_SECOND)
 #define XI2C_69             69  // See I2CDEVICES.md
 
 #define SGP40_ADDRESS       0x59
@@ -1061,6 +1061,1041 @@ const uint8_t kXdrvList[] = {
 #endif
 };
 
+/*********************************************************************************************\
+ * Xdrv frequent function list as declared by XDRV_xx_FUNC
+\*********************************************************************************************/
+
+#ifdef XFUNC_PTR_IN_ROM
+const uint8_t kXdrvFunc[] PROGMEM = {
+#else
+const uint8_t kXdrvFunc[] = {
+#endif
+
+#ifdef XDRV_01
+#ifdef XDRV_01_FUNC
+  XDRV_01_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_02
+#ifdef XDRV_02_FUNC
+  XDRV_02_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_03
+#ifdef XDRV_03_FUNC
+  XDRV_03_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_04
+#ifdef XDRV_04_FUNC
+  XDRV_04_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_05
+#ifdef XDRV_05_FUNC
+  XDRV_05_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_06
+#ifdef XDRV_06_FUNC
+  XDRV_06_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_07
+#ifdef XDRV_07_FUNC
+  XDRV_07_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_08
+#ifdef XDRV_08_FUNC
+  XDRV_08_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_09
+#ifdef XDRV_09_FUNC
+  XDRV_09_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_10
+#ifdef XDRV_10_FUNC
+  XDRV_10_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_11
+#ifdef XDRV_11_FUNC
+  XDRV_11_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_12
+#ifdef XDRV_12_FUNC
+  XDRV_12_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_13
+#ifdef XDRV_13_FUNC
+  XDRV_13_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_14
+#ifdef XDRV_14_FUNC
+  XDRV_14_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_15
+#ifdef XDRV_15_FUNC
+  XDRV_15_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_16
+#ifdef XDRV_16_FUNC
+  XDRV_16_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_17
+#ifdef XDRV_17_FUNC
+  XDRV_17_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_18
+#ifdef XDRV_18_FUNC
+  XDRV_18_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_19
+#ifdef XDRV_19_FUNC
+  XDRV_19_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_20
+#ifdef XDRV_20_FUNC
+  XDRV_20_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_21
+#ifdef XDRV_21_FUNC
+  XDRV_21_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_22
+#ifdef XDRV_22_FUNC
+  XDRV_22_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_23
+#ifdef XDRV_23_FUNC
+  XDRV_23_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_24
+#ifdef XDRV_24_FUNC
+  XDRV_24_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_25
+#ifdef XDRV_25_FUNC
+  XDRV_25_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_26
+#ifdef XDRV_26_FUNC
+  XDRV_26_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_27
+#ifdef XDRV_27_FUNC
+  XDRV_27_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_28
+#ifdef XDRV_28_FUNC
+  XDRV_28_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_29
+#ifdef XDRV_29_FUNC
+  XDRV_29_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_30
+#ifdef XDRV_30_FUNC
+  XDRV_30_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_31
+#ifdef XDRV_31_FUNC
+  XDRV_31_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_32
+#ifdef XDRV_32_FUNC
+  XDRV_32_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_33
+#ifdef XDRV_33_FUNC
+  XDRV_33_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_34
+#ifdef XDRV_34_FUNC
+  XDRV_34_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_35
+#ifdef XDRV_35_FUNC
+  XDRV_35_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_36
+#ifdef XDRV_36_FUNC
+  XDRV_36_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_37
+#ifdef XDRV_37_FUNC
+  XDRV_37_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_38
+#ifdef XDRV_38_FUNC
+  XDRV_38_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_39
+#ifdef XDRV_39_FUNC
+  XDRV_39_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_40
+#ifdef XDRV_40_FUNC
+  XDRV_40_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_41
+#ifdef XDRV_41_FUNC
+  XDRV_41_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_42
+#ifdef XDRV_42_FUNC
+  XDRV_42_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_43
+#ifdef XDRV_43_FUNC
+  XDRV_43_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_44
+#ifdef XDRV_44_FUNC
+  XDRV_44_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_45
+#ifdef XDRV_45_FUNC
+  XDRV_45_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_46
+#ifdef XDRV_46_FUNC
+  XDRV_46_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_47
+#ifdef XDRV_47_FUNC
+  XDRV_47_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_48
+#ifdef XDRV_48_FUNC
+  XDRV_48_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_49
+#ifdef XDRV_49_FUNC
+  XDRV_49_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_50
+#ifdef XDRV_50_FUNC
+  XDRV_50_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_51
+#ifdef XDRV_51_FUNC
+  XDRV_51_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_52
+#ifdef XDRV_52_FUNC
+  XDRV_52_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_53
+#ifdef XDRV_53_FUNC
+  XDRV_53_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_54
+#ifdef XDRV_54_FUNC
+  XDRV_54_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_55
+#ifdef XDRV_55_FUNC
+  XDRV_55_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_56
+#ifdef XDRV_56_FUNC
+  XDRV_56_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_57
+#ifdef XDRV_57_FUNC
+  XDRV_57_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_58
+#ifdef XDRV_58_FUNC
+  XDRV_58_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_59
+#ifdef XDRV_59_FUNC
+  XDRV_59_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_60
+#ifdef XDRV_60_FUNC
+  XDRV_60_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_61
+#ifdef XDRV_61_FUNC
+  XDRV_61_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_62
+#ifdef XDRV_62_FUNC
+  XDRV_62_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_63
+#ifdef XDRV_63_FUNC
+  XDRV_63_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_64
+#ifdef XDRV_64_FUNC
+  XDRV_64_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_65
+#ifdef XDRV_65_FUNC
+  XDRV_65_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_66
+#ifdef XDRV_66_FUNC
+  XDRV_66_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_67
+#ifdef XDRV_67_FUNC
+  XDRV_67_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_68
+#ifdef XDRV_68_FUNC
+  XDRV_68_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_69
+#ifdef XDRV_69_FUNC
+  XDRV_69_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_70
+#ifdef XDRV_70_FUNC
+  XDRV_70_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_71
+#ifdef XDRV_71_FUNC
+  XDRV_71_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_72
+#ifdef XDRV_72_FUNC
+  XDRV_72_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_73
+#ifdef XDRV_73_FUNC
+  XDRV_73_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_74
+#ifdef XDRV_74_FUNC
+  XDRV_74_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_75
+#ifdef XDRV_75_FUNC
+  XDRV_75_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_76
+#ifdef XDRV_76_FUNC
+  XDRV_76_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_77
+#ifdef XDRV_77_FUNC
+  XDRV_77_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_78
+#ifdef XDRV_78_FUNC
+  XDRV_78_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_79
+#ifdef XDRV_79_FUNC
+  XDRV_79_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_80
+#ifdef XDRV_80_FUNC
+  XDRV_80_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_81
+#ifdef XDRV_81_FUNC
+  XDRV_81_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_82
+#ifdef XDRV_82_FUNC
+  XDRV_82_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_83
+#ifdef XDRV_83_FUNC
+  XDRV_83_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_84
+#ifdef XDRV_84_FUNC
+  XDRV_84_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_85
+#ifdef XDRV_85_FUNC
+  XDRV_85_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_86
+#ifdef XDRV_86_FUNC
+  XDRV_86_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_87
+#ifdef XDRV_87_FUNC
+  XDRV_87_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_88
+#ifdef XDRV_88_FUNC
+  XDRV_88_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_89
+#ifdef XDRV_89_FUNC
+  XDRV_89_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_90
+#ifdef XDRV_90_FUNC
+  XDRV_90_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_91
+#ifdef XDRV_91_FUNC
+  XDRV_91_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_92
+#ifdef XDRV_92_FUNC
+  XDRV_92_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_93
+#ifdef XDRV_93_FUNC
+  XDRV_93_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_94
+#ifdef XDRV_94_FUNC
+  XDRV_94_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_95
+#ifdef XDRV_95_FUNC
+  XDRV_95_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_96
+#ifdef XDRV_96_FUNC
+  XDRV_96_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_97
+#ifdef XDRV_97_FUNC
+  XDRV_97_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_98
+#ifdef XDRV_98_FUNC
+  XDRV_98_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_99
+#ifdef XDRV_99_FUNC
+  XDRV_99_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_100
+#ifdef XDRV_100_FUNC
+  XDRV_100_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_101
+#ifdef XDRV_101_FUNC
+  XDRV_101_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_102
+#ifdef XDRV_102_FUNC
+  XDRV_102_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_103
+#ifdef XDRV_103_FUNC
+  XDRV_103_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_104
+#ifdef XDRV_104_FUNC
+  XDRV_104_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_105
+#ifdef XDRV_105_FUNC
+  XDRV_105_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_106
+#ifdef XDRV_106_FUNC
+  XDRV_106_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_107
+#ifdef XDRV_107_FUNC
+  XDRV_107_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_108
+#ifdef XDRV_108_FUNC
+  XDRV_108_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_109
+#ifdef XDRV_109_FUNC
+  XDRV_109_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_110
+#ifdef XDRV_110_FUNC
+  XDRV_110_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_111
+#ifdef XDRV_111_FUNC
+  XDRV_111_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_112
+#ifdef XDRV_112_FUNC
+  XDRV_112_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_113
+#ifdef XDRV_113_FUNC
+  XDRV_113_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_114
+#ifdef XDRV_114_FUNC
+  XDRV_114_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_115
+#ifdef XDRV_115_FUNC
+  XDRV_115_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_116
+#ifdef XDRV_116_FUNC
+  XDRV_116_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_117
+#ifdef XDRV_117_FUNC
+  XDRV_117_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_118
+#ifdef XDRV_118_FUNC
+  XDRV_118_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_119
+#ifdef XDRV_119_FUNC
+  XDRV_119_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_120
+#ifdef XDRV_120_FUNC
+  XDRV_120_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_121
+#ifdef XDRV_121_FUNC
+  XDRV_121_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_122
+#ifdef XDRV_122_FUNC
+  XDRV_122_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_123
+#ifdef XDRV_123_FUNC
+  XDRV_123_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_124
+#ifdef XDRV_124_FUNC
+  XDRV_124_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_125
+#ifdef XDRV_125_FUNC
+  XDRV_125_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_126
+#ifdef XDRV_126_FUNC
+  XDRV_126_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_127
+#ifdef XDRV_127_FUNC
+  XDRV_127_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XDRV_128
+#ifdef XDRV_128_FUNC
+  XDRV_128_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+};
+
 /*********************************************************************************************/
 
 uint32_t Xdrv_active[4] = { 0 };
@@ -1126,6 +2161,62 @@ bool XdrvCallDriver(uint32_t driver, uint32_t function) {
   return false;
 }
 
+/*********************************************************************************************\
+ * Per function dispatch lists
+ *
+ * Frequent functions (FUNC_LOOP up to FUNC_EVERY_SECOND) are only sent to the drivers
+ * declaring them in their XDRV_xx_FUNC or XSNS_xx_FUNC mask. The lists hold driver
+ * indexes grouped by function and are built once as the masks are constant.
+\*********************************************************************************************/
+
+uint8_t* XFuncBuildList(const uint8_t* masks, uint32_t present, uint16_t* start) {
+  // start needs XFUNC_FAST_COUNT +1 entries
+  uint32_t total = 0;
+  for (uint32_t bit = 0; bit < XFUNC_FAST_COUNT; bit++) {
+    start[bit] = total;
+    for (uint32_t x = 0; x < present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+      uint32_t mask = pgm_read_byte(masks + x);
+#else
+      uint32_t mask = masks[x];
+#endif
+      if (bitRead(mask, bit)) { total++; }
+    }
+  }
+  start[XFUNC_FAST_COUNT] = total;
+
+  uint8_t* list = (uint8_t*)malloc(total +1);
+  if (list) {
+    uint32_t i = 0;
+    for (uint32_t bit = 0; bit < XFUNC_FAST_COUNT; bit++) {
+      for (uint32_t x = 0; x < present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+        uint32_t mask = pgm_read_byte(masks + x);
+#else
+        uint32_t mask = masks[x];
+#endif
+        if (bitRead(mask, bit)) { list[i++] = x; }
+      }
+    }
+  }
+  return list;
+}
+
+uint8_t* xdrv_func_list = nullptr;
+uint16_t xdrv_func_start[XFUNC_FAST_COUNT +1];
+
+const uint8_t* XdrvFuncList(uint32_t function, uint32_t &count) {
+  // Returns nullptr if function needs to be sent to all drivers
+  if ((function < XFUNC_FAST_FIRST) || (function >= XFUNC_FAST_FIRST + XFUNC_FAST_COUNT)) { return nullptr; }
+  if (!xdrv_func_list) {
+    xdrv_func_list = XFuncBuildList(kXdrvFunc, xdrv_present, xdrv_func_start);
+    if (!xdrv_func_list) { return nullptr; }
+  }
+  uint32_t bit = function - XFUNC_FAST_FIRST;
+  count = xdrv_func_start[bit +1] - xdrv_func_start[bit];
+  return xdrv_func_list + xdrv_func_start[bit];
+}
+
 /*********************************************************************************************\
  * Function call to all xdrv
 \*********************************************************************************************/
@@ -1139,14 +2230,20 @@ bool XdrvCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
-  for (uint32_t x = 0; x < xdrv_present; x++) {
+  uint32_t count = xdrv_present;
+  const uint8_t* list = XdrvFuncList(function, count);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t x = (list) ? list[i] : i;
 
 #ifdef USE_PROFILE_FUNCTION
     uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
+    PROFILE_STATS_START(profile_stats_start);
 
     result = xdrv_func_ptr[x](function);
 
+    PROFILE_STATS(PRF_DRV, x, function, profile_stats_start);
+
 #ifdef USE_WEBSERVER
     if (FUNC_WEB_SENSOR == function) { 
 #ifdef XFUNC_PTR_IN_ROM
@@ -187,7 +187,9 @@ bool XdspCall(uint32_t function) {
   DEBUG_TRACE_LOG(PSTR("DSP: %d"), function);
 
   for (uint32_t x = 0; x < xdsp_present; x++) {
+    PROFILE_STATS_START(profile_stats_start);
     result = xdsp_func_ptr[x](function);
+    PROFILE_STATS(PRF_DSP, x, function, profile_stats_start);
 
     if (result && (FUNC_DISPLAY_MODEL == function)) {
       break;
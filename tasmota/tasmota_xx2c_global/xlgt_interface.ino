@@ -107,7 +107,10 @@ bool XlgtCall(uint32_t function) {
     }
   }
   else if (TasmotaGlobal.light_driver) {
-    return xlgt_func_ptr[xlgt_active](function);
+    PROFILE_STATS_START(profile_stats_start);
+    bool result = xlgt_func_ptr[xlgt_active](function);
+    PROFILE_STATS(PRF_LGT, xlgt_active, function, profile_stats_start);
+    return result;
   }
   return false;
 }
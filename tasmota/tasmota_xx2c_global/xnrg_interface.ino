@@ -171,7 +171,10 @@ bool XnrgCall(uint32_t function) {
     }
   }
   else if (TasmotaGlobal.energy_driver) {
-    return xnrg_func_ptr[xnrg_active](function);
+    PROFILE_STATS_START(profile_stats_start);
+    bool result = xnrg_func_ptr[xnrg_active](function);
+    PROFILE_STATS(PRF_NRG, xnrg_active, function, profile_stats_start);
+    return result;
   }
   return false;
 }
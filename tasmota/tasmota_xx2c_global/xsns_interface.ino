@@ -1053,6 +1053,1033 @@ const uint8_t kXsnsList[] = {
 #endif
 };
 
+/*********************************************************************************************\
+ * Xsns frequent function list as declared by XSNS_xx_FUNC
+\*********************************************************************************************/
+
+#ifdef XFUNC_PTR_IN_ROM
+const uint8_t kXsnsFunc[] PROGMEM = {
+#else
+const uint8_t kXsnsFunc[] = {
+#endif
+
+#ifdef XSNS_01
+#ifdef XSNS_01_FUNC
+  XSNS_01_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_02
+#ifdef XSNS_02_FUNC
+  XSNS_02_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_03
+#ifdef XSNS_03_FUNC
+  XSNS_03_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_04
+#ifdef XSNS_04_FUNC
+  XSNS_04_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_05
+#ifdef XSNS_05_FUNC
+  XSNS_05_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_06
+#ifdef XSNS_06_FUNC
+  XSNS_06_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_07
+#ifdef XSNS_07_FUNC
+  XSNS_07_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_08
+#ifdef XSNS_08_FUNC
+  XSNS_08_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_09
+#ifdef XSNS_09_FUNC
+  XSNS_09_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_10
+#ifdef XSNS_10_FUNC
+  XSNS_10_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_11
+#ifdef XSNS_11_FUNC
+  XSNS_11_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_12
+#ifdef XSNS_12_FUNC
+  XSNS_12_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_13
+#ifdef XSNS_13_FUNC
+  XSNS_13_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_14
+#ifdef XSNS_14_FUNC
+  XSNS_14_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_15
+#ifdef XSNS_15_FUNC
+  XSNS_15_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_16
+#ifdef XSNS_16_FUNC
+  XSNS_16_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_17
+#ifdef XSNS_17_FUNC
+  XSNS_17_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_18
+#ifdef XSNS_18_FUNC
+  XSNS_18_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_19
+#ifdef XSNS_19_FUNC
+  XSNS_19_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_20
+#ifdef XSNS_20_FUNC
+  XSNS_20_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_21
+#ifdef XSNS_21_FUNC
+  XSNS_21_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_22
+#ifdef XSNS_22_FUNC
+  XSNS_22_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_23
+#ifdef XSNS_23_FUNC
+  XSNS_23_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_24
+#ifdef XSNS_24_FUNC
+  XSNS_24_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_25
+#ifdef XSNS_25_FUNC
+  XSNS_25_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_26
+#ifdef XSNS_26_FUNC
+  XSNS_26_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_27
+#ifdef XSNS_27_FUNC
+  XSNS_27_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_28
+#ifdef XSNS_28_FUNC
+  XSNS_28_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_29
+#ifdef XSNS_29_FUNC
+  XSNS_29_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_30
+#ifdef XSNS_30_FUNC
+  XSNS_30_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_31
+#ifdef XSNS_31_FUNC
+  XSNS_31_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_32
+#ifdef XSNS_32_FUNC
+  XSNS_32_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_33
+#ifdef XSNS_33_FUNC
+  XSNS_33_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_34
+#ifdef XSNS_34_FUNC
+  XSNS_34_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_35
+#ifdef XSNS_35_FUNC
+  XSNS_35_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_36
+#ifdef XSNS_36_FUNC
+  XSNS_36_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_37
+#ifdef XSNS_37_FUNC
+  XSNS_37_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_38
+#ifdef XSNS_38_FUNC
+  XSNS_38_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_39
+#ifdef XSNS_39_FUNC
+  XSNS_39_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_40
+#ifdef XSNS_40_FUNC
+  XSNS_40_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_41
+#ifdef XSNS_41_FUNC
+  XSNS_41_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_42
+#ifdef XSNS_42_FUNC
+  XSNS_42_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_43
+#ifdef XSNS_43_FUNC
+  XSNS_43_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_44
+#ifdef XSNS_44_FUNC
+  XSNS_44_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_45
+#ifdef XSNS_45_FUNC
+  XSNS_45_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_46
+#ifdef XSNS_46_FUNC
+  XSNS_46_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_47
+#ifdef XSNS_47_FUNC
+  XSNS_47_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_48
+#ifdef XSNS_48_FUNC
+  XSNS_48_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_49
+#ifdef XSNS_49_FUNC
+  XSNS_49_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_50
+#ifdef XSNS_50_FUNC
+  XSNS_50_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_51
+#ifdef XSNS_51_FUNC
+  XSNS_51_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_52
+#ifdef XSNS_52_FUNC
+  XSNS_52_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_53
+#ifdef XSNS_53_FUNC
+  XSNS_53_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_54
+#ifdef XSNS_54_FUNC
+  XSNS_54_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_55
+#ifdef XSNS_55_FUNC
+  XSNS_55_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_56
+#ifdef XSNS_56_FUNC
+  XSNS_56_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_57
+#ifdef XSNS_57_FUNC
+  XSNS_57_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_58
+#ifdef XSNS_58_FUNC
+  XSNS_58_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_59
+#ifdef XSNS_59_FUNC
+  XSNS_59_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_60
+#ifdef XSNS_60_FUNC
+  XSNS_60_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_61
+#ifdef XSNS_61_FUNC
+  XSNS_61_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_62
+#ifdef XSNS_62_FUNC
+  XSNS_62_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_63
+#ifdef XSNS_63_FUNC
+  XSNS_63_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_64
+#ifdef XSNS_64_FUNC
+  XSNS_64_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_65
+#ifdef XSNS_65_FUNC
+  XSNS_65_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_66
+#ifdef XSNS_66_FUNC
+  XSNS_66_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_67
+#ifdef XSNS_67_FUNC
+  XSNS_67_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_68
+#ifdef XSNS_68_FUNC
+  XSNS_68_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_69
+#ifdef XSNS_69_FUNC
+  XSNS_69_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_70
+#ifdef XSNS_70_FUNC
+  XSNS_70_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_71
+#ifdef XSNS_71_FUNC
+  XSNS_71_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_72
+#ifdef XSNS_72_FUNC
+  XSNS_72_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_73
+#ifdef XSNS_73_FUNC
+  XSNS_73_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_74
+#ifdef XSNS_74_FUNC
+  XSNS_74_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_75
+#ifdef XSNS_75_FUNC
+  XSNS_75_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_76
+#ifdef XSNS_76_FUNC
+  XSNS_76_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_77
+#ifdef XSNS_77_FUNC
+  XSNS_77_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_78
+#ifdef XSNS_78_FUNC
+  XSNS_78_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_79
+#ifdef XSNS_79_FUNC
+  XSNS_79_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_80
+#ifdef XSNS_80_FUNC
+  XSNS_80_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_81
+#ifdef XSNS_81_FUNC
+  XSNS_81_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_82
+#ifdef XSNS_82_FUNC
+  XSNS_82_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_83
+#ifdef XSNS_83_FUNC
+  XSNS_83_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_84
+#ifdef XSNS_84_FUNC
+  XSNS_84_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_85
+#ifdef XSNS_85_FUNC
+  XSNS_85_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_86
+#ifdef XSNS_86_FUNC
+  XSNS_86_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_87
+#ifdef XSNS_87_FUNC
+  XSNS_87_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_88
+#ifdef XSNS_88_FUNC
+  XSNS_88_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_89
+#ifdef XSNS_89_FUNC
+  XSNS_89_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_90
+#ifdef XSNS_90_FUNC
+  XSNS_90_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_91
+#ifdef XSNS_91_FUNC
+  XSNS_91_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_92
+#ifdef XSNS_92_FUNC
+  XSNS_92_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_93
+#ifdef XSNS_93_FUNC
+  XSNS_93_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_94
+#ifdef XSNS_94_FUNC
+  XSNS_94_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_95
+#ifdef XSNS_95_FUNC
+  XSNS_95_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_96
+#ifdef XSNS_96_FUNC
+  XSNS_96_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_97
+#ifdef XSNS_97_FUNC
+  XSNS_97_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_98
+#ifdef XSNS_98_FUNC
+  XSNS_98_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_99
+#ifdef XSNS_99_FUNC
+  XSNS_99_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_100
+#ifdef XSNS_100_FUNC
+  XSNS_100_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_101
+#ifdef XSNS_101_FUNC
+  XSNS_101_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_102
+#ifdef XSNS_102_FUNC
+  XSNS_102_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_103
+#ifdef XSNS_103_FUNC
+  XSNS_103_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_104
+#ifdef XSNS_104_FUNC
+  XSNS_104_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_105
+#ifdef XSNS_105_FUNC
+  XSNS_105_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_106
+#ifdef XSNS_106_FUNC
+  XSNS_106_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_107
+#ifdef XSNS_107_FUNC
+  XSNS_107_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_108
+#ifdef XSNS_108_FUNC
+  XSNS_108_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_109
+#ifdef XSNS_109_FUNC
+  XSNS_109_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_110
+#ifdef XSNS_110_FUNC
+  XSNS_110_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_111
+#ifdef XSNS_111_FUNC
+  XSNS_111_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_112
+#ifdef XSNS_112_FUNC
+  XSNS_112_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_113
+#ifdef XSNS_113_FUNC
+  XSNS_113_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_114
+#ifdef XSNS_114_FUNC
+  XSNS_114_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_115
+#ifdef XSNS_115_FUNC
+  XSNS_115_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_116
+#ifdef XSNS_116_FUNC
+  XSNS_116_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_117
+#ifdef XSNS_117_FUNC
+  XSNS_117_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_118
+#ifdef XSNS_118_FUNC
+  XSNS_118_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_119
+#ifdef XSNS_119_FUNC
+  XSNS_119_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_120
+#ifdef XSNS_120_FUNC
+  XSNS_120_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_121
+#ifdef XSNS_121_FUNC
+  XSNS_121_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_122
+#ifdef XSNS_122_FUNC
+  XSNS_122_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_123
+#ifdef XSNS_123_FUNC
+  XSNS_123_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_124
+#ifdef XSNS_124_FUNC
+  XSNS_124_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_125
+#ifdef XSNS_125_FUNC
+  XSNS_125_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_126
+#ifdef XSNS_126_FUNC
+  XSNS_126_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+
+#ifdef XSNS_127
+#ifdef XSNS_127_FUNC
+  XSNS_127_FUNC,
+#else
+  XFUNC_ALL,
+#endif
+#endif
+};
+
 /*********************************************************************************************/
 
 bool XsnsEnabled(uint32_t sensor_list, uint32_t sns_index) {
@@ -1094,6 +2121,21 @@ void XsnsSensorState(uint32_t sensor_list) {
  * Function call to all xsns
 \*********************************************************************************************/
 
+uint8_t* xsns_func_list = nullptr;
+uint16_t xsns_func_start[XFUNC_FAST_COUNT +1];
+
+const uint8_t* XsnsFuncList(uint32_t function, uint32_t &count) {
+  // Returns nullptr if function needs to be sent to all sensors
+  if ((function < XFUNC_FAST_FIRST) || (function >= XFUNC_FAST_FIRST + XFUNC_FAST_COUNT)) { return nullptr; }
+  if (!xsns_func_list) {
+    xsns_func_list = XFuncBuildList(kXsnsFunc, xsns_present, xsns_func_start);
+    if (!xsns_func_list) { return nullptr; }
+  }
+  uint32_t bit = function - XFUNC_FAST_FIRST;
+  count = xsns_func_start[bit +1] - xsns_func_start[bit];
+  return xsns_func_list + xsns_func_start[bit];
+}
+
 bool XsnsNextCall(uint32_t function, uint8_t &xsns_index) {
   if (0 == xsns_present) {
     xsns_index = 0;
@@ -1120,16 +2162,22 @@ bool XsnsCall(uint32_t function) {
   uint32_t profile_driver_start = millis();
 #endif  // USE_PROFILE_FUNCTION
 
-  for (uint32_t x = 0; x < xsns_present; x++) {
+  uint32_t count = xsns_present;
+  const uint8_t* list = XsnsFuncList(function, count);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t x = (list) ? list[i] : i;
     if (XsnsEnabled(0, x)) {  // Skip disabled sensor
       if ((FUNC_WEB_SENSOR == function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
 
 #ifdef USE_PROFILE_FUNCTION
       uint32_t profile_function_start = millis();
 #endif  // USE_PROFILE_FUNCTION
+      PROFILE_STATS_START(profile_stats_start);
 
       result = xsns_func_ptr[x](function);
 
+      PROFILE_STATS(PRF_SNS, x, function, profile_stats_start);
+
 #ifdef USE_WEBSERVER
       if (FUNC_WEB_SENSOR == function) { WSContentSeparator(1); }  // Show separator if needed
 #endif // USE_WEBSERVER
@@ -0,0 +1,45 @@
+/*
+  TasmotaSerial.h - host shim, the Zigbee serial port is one end of a pseudo terminal
+*/
+
+#ifndef __TASMOTA_SERIAL_HOST_H__
+#define __TASMOTA_SERIAL_HOST_H__
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+
+class TasmotaSerial {
+public:
+  // same signature as the real class, the pseudo terminal is attached with `attach()`
+  TasmotaSerial(int receive_pin, int transmit_pin, int hardware_fallback = 0, int nwmode = 0, int buffer_size = 64) : _fd(-1) {}
+  void attach(int fd) { _fd = fd; }
+
+  size_t write(uint8_t byte) {
+    tx_count++;
+    return ::write(_fd, &byte, 1);
+  }
+  int available(void) {
+    int count = 0;
+    ioctl(_fd, FIONREAD, &count);
+    return count;
+  }
+  int read(void) {
+    uint8_t byte;
+    if (1 != ::read(_fd, &byte, 1)) { return -1; }
+    rx_count++;
+    return byte;
+  }
+  void flush(void) {}
+  bool hardwareSerial(void) { return false; }
+  int getUart(void) { return 0; }
+  void begin(uint32_t) {}
+
+  uint32_t tx_count = 0;      // bytes written and read, to wait until the pseudo terminal delivered them
+  uint32_t rx_count = 0;
+
+private:
+  int _fd;
+};
+
+#endif // __TASMOTA_SERIAL_HOST_H__
@@ -0,0 +1,140 @@
+/*
+  tasmota_host.h - minimal host shim to compile the Zigbee EZSP serial driver on a PC
+
+  Only what xdrv_23_zigbee_0_constants.ino and xdrv_23_zigbee_9_serial.ino need is provided,
+  time is virtual and advanced by the test
+*/
+
+#ifndef __TASMOTA_HOST_H__
+#define __TASMOTA_HOST_H__
+
+#include <string>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+#define USE_ZIGBEE
+#define USE_ZIGBEE_EZSP
+
+#define PROGMEM
+#define PSTR(x)                 (x)
+#define pgm_read_byte(x)        (*(const uint8_t*)(x))
+#define tmin(a,b)               ((a)<(b)?(a):(b))
+#define tmax(a,b)               ((a)>(b)?(a):(b))
+#define Z_B0(a)                 (uint8_t)( ((a)      ) & 0xFF )    // as in xdrv_23_zigbee_7_0_statemachine.ino
+#define Z_B1(a)                 (uint8_t)( ((a) >>  8) & 0xFF )
+
+class String : public std::string {
+public:
+  String(const char * s = "") : std::string(s ? s : "") {}
+};
+
+#include "../../lib/default/Ext-printf/src/SBuffer.hpp"
+#include "../../lib/default/TasmotaLList/src/LList.h"
+
+// time
+extern uint32_t host_millis;
+inline uint32_t millis(void) { return host_millis; }
+inline int32_t TimePassedSince(uint32_t timestamp) { return (int32_t)(host_millis - timestamp); }
+inline void yield(void) {}
+
+// logs and responses are dropped unless `host_verbose` is set
+enum LoggingLevels {LOG_LEVEL_NONE, LOG_LEVEL_ERROR, LOG_LEVEL_INFO, LOG_LEVEL_DEBUG, LOG_LEVEL_DEBUG_MORE};
+extern bool host_verbose;
+inline void AddLog(uint32_t loglevel, const char * formatP, ...) {
+  if (host_verbose && (loglevel <= LOG_LEVEL_DEBUG)) { printf("%s\n", formatP); }   // %_B and %_H are Tasmota extensions, print the format only
+}
+inline int Response_P(const char *, ...) { return 0; }
+inline char * ResponseData(void) { static char data[1] = ""; return data; }
+inline void ResponseCmndDone(void) {}
+inline char * GetTextIndexed(char * destination, size_t destination_size, uint32_t, const char *) {
+  if (destination_size) { *destination = 0; }
+  return destination;
+}
+inline char * RemoveSpace(char * p) { return p; }
+inline size_t strlcpy(char * dst, const char * src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = (len < size) ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = 0;
+  }
+  return len;
+}
+inline void MqttPublishPrefixTopicRulesProcess_P(uint32_t, const char *) {}
+#define TELE                    1
+#define RESULT_OR_TELE          1
+#define D_RSLT_SENSOR           "SENSOR"
+#define D_LOG_ZIGBEE            "ZIG: "
+#define D_JSON_ZIGBEE_STATE     "ZbState"
+#define D_JSON_ZIGBEE_EZSP_RECEIVED "EZSPReceived"
+#define D_JSON_ZIGBEE_EZSP_SENT "EZSPSent"
+#define D_JSON_ZIGBEE_EZSP_SENT_RAW "EZSPSentRaw"
+
+struct {
+  struct { uint32_t tuya_serial_mqtt_publish : 1; } flag3;
+} host_settings;
+#define Settings (&host_settings)
+
+struct {
+  uint32_t restart_flag;
+  uint32_t seriallog_level;
+} TasmotaGlobal;
+
+struct {
+  char * data;
+  uint32_t data_len;
+  uint32_t index;
+} XdrvMailbox;
+
+// gpio, the NCP is never reset by the driver in these tests
+enum { GPIO_ZIGBEE_RX, GPIO_ZIGBEE_TX, GPIO_ZIGBEE_RST };
+#define OUTPUT                  1
+inline bool PinUsed(uint32_t, uint32_t = 0) { return false; }
+inline int32_t Pin(uint32_t, uint32_t = 0) { return -1; }
+inline void pinMode(int32_t, uint32_t) {}
+inline void digitalWrite(int32_t, uint32_t) {}
+inline void ClaimSerial(void) {}
+inline void SetLedPowerIdx(uint32_t, uint32_t) {}
+const uint32_t ZIGBEE_POLLING = 100;
+
+// zigbee state, as in xdrv_23_zigbee_1_headers.ino
+struct {
+  bool active = true;
+  bool init_phase = false;
+  bool state_machine = false;
+  bool background = false;
+} zigbee;
+SBuffer *zigbee_buffer = nullptr;
+
+// upper layers, implemented by the test
+void ZigbeeProcessInput(SBuffer &buf);
+void EZ_RSTACK(uint8_t reset_code);
+void EZ_ERROR(uint8_t error_code);
+
+// only used by ZigbeeZCLSend_Raw(), never called by the tests
+class ZCLFrame {
+public:
+  uint16_t shortaddr, groupaddr, cluster, manuf;
+  uint8_t srcendpoint, dstendpoint, transactseq, cmd;
+  bool direct, needResponse, clusterSpecific, direction;
+  SBuffer payload;
+  bool validShortaddr(void) const { return shortaddr != 0xFFFE; }
+};
+
+// prototypes generated by the Arduino build for the .ino files
+bool Z_LedStatusSet(bool onoff);
+void ZigbeeEZSPSendRaw(const uint8_t *msg, size_t len, bool send_cancel);
+void ZigbeeEZSPSendCmd(const uint8_t *msg, size_t len);
+void ZigbeeEZSPSendDATA_frm(bool send_cancel, uint8_t to_frm, uint8_t from_ack);
+void ZigbeeEZSPSendDATA(const uint8_t *msg, size_t len);
+void ZigbeeProcessInputEZSP(SBuffer &buf);
+void EZSP_HandleAck(uint8_t new_ack);
+void ZigbeeProcessInputRaw(SBuffer &buf);
+void ZigbeeOutputLoop(void);
+
+#endif // __TASMOTA_HOST_H__
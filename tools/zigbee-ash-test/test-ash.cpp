@@ -0,0 +1,389 @@
+/*
+  test-ash.cpp - host test of the EZSP ASH layer of the Zigbee driver against a simulated NCP
+
+  The driver code is xdrv_23_zigbee_9_serial.ino compiled as is. It talks to a simulated NCP
+  over a pseudo terminal, the NCP drops or corrupts frames in both directions.
+  Checks that every EZSP frame is delivered exactly once and in order in both directions,
+  that the window is respected, and that a silent NCP is detected.
+
+  g++ -I. -o test-ash test-ash.cpp -lutil && ./test-ash
+*/
+
+#include "tasmota_host.h"
+#include "../../tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_0_constants.ino"
+#include "../../tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_9_serial.ino"
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <algorithm>
+#include <termios.h>
+#include <sys/wait.h>
+#ifdef __APPLE__
+#include <util.h>
+#else
+#include <pty.h>
+#endif
+
+uint32_t host_millis = 1000;
+bool host_verbose = false;
+
+/*********************************************************************************************\
+ * Host side, upper layers
+\*********************************************************************************************/
+
+std::vector<uint32_t> host_received;    // ids of EZSP frames delivered to ZigbeeProcessInput()
+int32_t host_error = -1;                // code of last EZ_ERROR()
+
+void ZigbeeProcessInput(SBuffer &buf) {
+  host_received.push_back(buf.get32(2));
+}
+void EZ_RSTACK(uint8_t reset_code) {}
+void EZ_ERROR(uint8_t error_code) { host_error = error_code; }
+
+/*********************************************************************************************\
+ * Simulated NCP, independent implementation of the NCP side of ASH
+\*********************************************************************************************/
+
+const uint8_t  NCP_WINDOW = 3;
+const uint32_t NCP_T_RX_ACK = 300;      // ms
+const uint32_t NCP_LATENCY = 8;         // ms, each way
+
+class NCP {
+public:
+  NCP(int fd, uint32_t loss_permille, uint32_t seed) : _fd(fd), _loss(loss_permille), _seed(seed) {}
+  void loop(void);
+
+  bool     silent = false;              // never answer, like a crashed NCP
+  uint32_t tx_count = 0;
+  uint32_t rx_count = 0;
+  uint32_t naks = 0;                    // NAK frames sent
+  uint32_t retx = 0;                    // retransmitted DATA frames received
+  std::vector<uint32_t> received;       // ids of EZSP frames received, in order
+
+private:
+  struct Frame { uint32_t due; std::vector<uint8_t> raw; bool corrupt; };
+
+  uint32_t random(void) { _seed = _seed * 1103515245 + 12345; return (_seed >> 16) & 0x7FFF; }
+  bool lost(void) { return (random() % 1000) < _loss; }
+  void readInput(void);
+  void receive(std::vector<uint8_t> &frame);
+  void handleAck(uint8_t ack);
+  void sendFrame(std::vector<uint8_t> frame);
+  void sendData(uint8_t frm, bool retransmit);
+  void writeByte(uint8_t b) { tx_count++; (void)::write(_fd, &b, 1); }
+
+  int      _fd;
+  uint32_t _loss;
+  uint32_t _seed;
+  std::vector<uint8_t> _rx_buf;
+  bool     _rx_escape = false;
+  std::deque<Frame> _in;                // frames received, processed after latency
+  std::deque<Frame> _out;               // frames to write, after latency
+  uint8_t  _expected = 0;               // next DATA frame number expected from the host
+  bool     _rejecting = false;
+  bool     _ack_pending = false;
+  uint8_t  _next = 0;                   // next DATA frame number to send
+  uint8_t  _acked = 0;                  // oldest DATA frame number not acked by the host
+  uint32_t _sent_time = 0;
+  std::map<uint8_t, std::vector<uint8_t>> _window;   // frame number -> EZSP frame
+  std::deque<std::vector<uint8_t>> _responses;       // EZSP frames waiting for room in the window
+};
+
+void NCP::readInput(void) {
+  uint8_t b;
+  while (1 == ::read(_fd, &b, 1)) {
+    rx_count++;
+    if (0x1A == b) { _rx_buf.clear(); _rx_escape = false; continue; }
+    if (0x11 == b || 0x13 == b) { continue; }
+    if (0x7D == b) { _rx_escape = true; continue; }
+    if (0x7E == b) {
+      if (_rx_buf.size() >= 3) {
+        uint16_t crc = 0xFFFF;
+        for (size_t i = 0; i < _rx_buf.size() - 2; i++) {
+          crc ^= (uint16_t)_rx_buf[i] << 8;
+          for (uint32_t k = 0; k < 8; k++) { crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1); }
+        }
+        uint16_t crc_received = (_rx_buf[_rx_buf.size() - 2] << 8) | _rx_buf.back();
+        if (crc != crc_received) {
+          printf("NCP: bad crc from host\n");
+          exit(1);
+        }
+        _rx_buf.resize(_rx_buf.size() - 2);
+        if (!(_rx_buf[0] & 0x80)) {
+          uint8_t rand = 0x42;
+          for (size_t i = 1; i < _rx_buf.size(); i++) {
+            _rx_buf[i] ^= rand;
+            rand = (rand & 1) ? ((rand >> 1) ^ 0xB8) : (rand >> 1);
+          }
+        }
+        if (!lost()) { _in.push_back({ host_millis + NCP_LATENCY, _rx_buf, false }); }
+      }
+      _rx_buf.clear();
+      continue;
+    }
+    if (_rx_escape) { b ^= 0x20; _rx_escape = false; }
+    _rx_buf.push_back(b);
+  }
+}
+
+void NCP::handleAck(uint8_t ack) {
+  while ((_acked != ack) && (((ack - _acked) & 7) <= ((_next - _acked) & 7))) {
+    _window.erase(_acked);
+    _acked = (_acked + 1) & 7;
+    _sent_time = host_millis;
+  }
+}
+
+void NCP::receive(std::vector<uint8_t> &frame) {
+  uint8_t control = frame[0];
+  if (control & 0x80) {
+    if (0x80 == (control & 0xE0)) {             // ACK
+      handleAck(control & 7);
+    } else if (0xA0 == (control & 0xE0)) {      // NAK, resend all frames in flight
+      handleAck(control & 7);
+      for (uint8_t i = _acked; i != _next; i = (i + 1) & 7) { sendData(i, true); }
+      _sent_time = host_millis;
+    }
+    return;
+  }
+  handleAck(control & 7);
+  uint8_t frm = (control >> 4) & 7;
+  if (control & 0x08) { retx++; }
+  if (frm != _expected) {
+    if (control & 0x08) {
+      _ack_pending = true;                      // duplicate, ack it again
+    } else if (!_rejecting) {
+      sendFrame({ (uint8_t)(0xA0 | _expected) });
+      naks++;
+      _rejecting = true;
+    }
+    return;
+  }
+  _rejecting = false;
+  _expected = (_expected + 1) & 7;
+  _ack_pending = true;
+  // EZSP frame: sequence, frame control (2 bytes), frame id (2 bytes), id (4 bytes)
+  uint32_t id = frame[6] | (frame[7] << 8) | (frame[8] << 16) | (frame[9] << 24);
+  received.push_back(id);
+  std::vector<uint8_t> response(frame.begin() + 1, frame.end());
+  response[1] = 0x80;                           // response
+  _responses.push_back(response);
+}
+
+void NCP::sendFrame(std::vector<uint8_t> frame) {
+  bool corrupt = false;
+  if (lost()) {
+    if (random() & 1) { return; }               // dropped
+    corrupt = true;                             // or sent with a bad crc, the host must drop it
+  }
+  _out.push_back({ host_millis + NCP_LATENCY, frame, corrupt });
+}
+
+void NCP::sendData(uint8_t frm, bool retransmit) {
+  std::vector<uint8_t> frame;
+  frame.push_back((frm << 4) | (retransmit ? 0x08 : 0) | _expected);
+  frame.insert(frame.end(), _window[frm].begin(), _window[frm].end());
+  sendFrame(frame);
+  _ack_pending = false;
+}
+
+void NCP::loop(void) {
+  readInput();
+  if (silent) {
+    _in.clear();
+    return;
+  }
+  while (!_in.empty() && ((int32_t)(host_millis - _in.front().due) >= 0)) {
+    receive(_in.front().raw);
+    _in.pop_front();
+  }
+  if ((_next != _acked) && (host_millis - _sent_time > NCP_T_RX_ACK)) {
+    for (uint8_t i = _acked; i != _next; i = (i + 1) & 7) { sendData(i, true); }
+    _sent_time = host_millis;
+  }
+  while ((((_next - _acked) & 7) < NCP_WINDOW) && !_responses.empty()) {
+    if (_next == _acked) { _sent_time = host_millis; }
+    _window[_next] = _responses.front();
+    _responses.pop_front();
+    sendData(_next, false);
+    _next = (_next + 1) & 7;
+  }
+  if (_ack_pending) {
+    sendFrame({ (uint8_t)(0x80 | _expected) });
+    _ack_pending = false;
+  }
+  // write frames due: randomize DATA, crc, stuffing
+  while (!_out.empty() && ((int32_t)(host_millis - _out.front().due) >= 0)) {
+    std::vector<uint8_t> frame = _out.front().raw;
+    bool corrupt = _out.front().corrupt;
+    _out.pop_front();
+    if (!(frame[0] & 0x80)) {
+      uint8_t rand = 0x42;
+      for (size_t i = 1; i < frame.size(); i++) {
+        frame[i] ^= rand;
+        rand = (rand & 1) ? ((rand >> 1) ^ 0xB8) : (rand >> 1);
+      }
+    }
+    uint16_t crc = 0xFFFF;
+    for (uint8_t b : frame) {
+      crc ^= (uint16_t)b << 8;
+      for (uint32_t k = 0; k < 8; k++) { crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1); }
+    }
+    if (corrupt) { crc ^= 0x0100; }
+    frame.push_back(crc >> 8);
+    frame.push_back(crc & 0xFF);
+    for (uint8_t b : frame) {
+      if ((0x7E == b) || (0x7D == b) || (0x11 == b) || (0x13 == b) || (0x18 == b) || (0x1A == b)) {
+        writeByte(0x7D);
+        writeByte(b ^ 0x20);
+      } else {
+        writeByte(b);
+      }
+    }
+    writeByte(0x7E);
+  }
+}
+
+/*********************************************************************************************\
+ * Test scenarios, each one runs in a child process to start from a clean driver state
+\*********************************************************************************************/
+
+static int host_fd, ncp_fd;
+
+// wait until the pseudo terminal delivered everything written on both sides
+static bool PtySync(NCP &ncp) {
+  for (uint32_t i = 0; i < 100000; i++) {
+    int host_avail = 0, ncp_avail = 0;
+    ioctl(host_fd, FIONREAD, &host_avail);
+    ioctl(ncp_fd, FIONREAD, &ncp_avail);
+    if ((host_avail >= (int)(ncp.tx_count - ZigbeeSerial->rx_count)) &&
+        (ncp_avail >= (int)(ZigbeeSerial->tx_count - ncp.rx_count))) {
+      return true;
+    }
+    usleep(10);
+  }
+  return false;
+}
+
+static void SetupPty(void) {
+  if (openpty(&host_fd, &ncp_fd, nullptr, nullptr, nullptr) < 0) {
+    perror("openpty");
+    exit(1);
+  }
+  struct termios tio;
+  tcgetattr(ncp_fd, &tio);
+  cfmakeraw(&tio);                      // no echo, no XON/XOFF, no CR/LF translation
+  tcsetattr(ncp_fd, TCSANOW, &tio);
+  fcntl(host_fd, F_SETFL, O_NONBLOCK);
+  fcntl(ncp_fd, F_SETFL, O_NONBLOCK);
+  ZigbeeSerial = new TasmotaSerial(-1, -1);
+  ZigbeeSerial->attach(host_fd);
+  zigbee_buffer = new SBuffer(ZIGBEE_BUFFER_SIZE);
+}
+
+// send `frames` EZSP frames, half of them as background traffic, and check both directions
+static int TestTransfer(uint32_t loss_permille, uint32_t seed, uint32_t frames) {
+  SetupPty();
+  NCP ncp(ncp_fd, loss_permille, seed);
+  srand(seed);
+  std::vector<uint32_t> sent_high, sent_low;
+  uint32_t next_id = 0;
+  uint32_t start = host_millis;
+  uint32_t max_in_flight = 0;
+
+  while (TimePassedSince(start) < 3600 * 1000) {
+    if ((next_id < frames) && (0 == rand() % 3)) {
+      zigbee.background = rand() & 1;
+      uint8_t cmd[6] = { Z_B0(EZSP_version), Z_B1(EZSP_version),
+                         (uint8_t)next_id, (uint8_t)(next_id >> 8), (uint8_t)(next_id >> 16), (uint8_t)(next_id >> 24) };
+      ZigbeeEZSPSendCmd(cmd, sizeof(cmd));
+      (zigbee.background ? sent_low : sent_high).push_back(next_id++);
+      zigbee.background = false;
+    }
+    ZigbeeInputLoop();
+    ZigbeeOutputLoop();
+    ncp.loop();
+    if (!PtySync(ncp)) { printf("pty stalled\n"); return 1; }
+    max_in_flight = tmax(max_in_flight, EZSP_Serial.inFlight());
+    if (!zigbee.active) { break; }
+    host_millis++;
+    if ((next_id == frames) && (host_received.size() == frames) && EZSP_Serial.idle() && (EZSP_Serial.to_ack == EZSP_Serial.to_end)) { break; }
+  }
+
+  bool ok = true;
+  // the NCP received each frame once, in order within each priority
+  std::vector<uint32_t> got_high, got_low;
+  for (uint32_t id : ncp.received) {
+    bool high = std::find(sent_high.begin(), sent_high.end(), id) != sent_high.end();
+    (high ? got_high : got_low).push_back(id);
+  }
+  if ((got_high != sent_high) || (got_low != sent_low)) {
+    printf("host to NCP: %zu/%zu high, %zu/%zu low frames in order\n", got_high.size(), sent_high.size(), got_low.size(), sent_low.size());
+    ok = false;
+  }
+  // the host received each response once, in NCP order
+  if (host_received != ncp.received) {
+    printf("NCP to host: %zu frames received for %zu sent\n", host_received.size(), ncp.received.size());
+    ok = false;
+  }
+  if (max_in_flight > EZSP_ASH_WINDOW) {
+    printf("window exceeded: %u frames in flight\n", max_in_flight);
+    ok = false;
+  }
+  if (!zigbee.active || TasmotaGlobal.restart_flag) {
+    printf("link declared failed\n");
+    ok = false;
+  }
+  if (loss_permille && !ncp.naks && !ncp.retx) {
+    printf("no NAK or retransmission exercised\n");
+    ok = false;
+  }
+  printf("loss %2u%% seed %u: %s, %u frames in %u ms, %u naks, %u retransmissions, t_rx_ack %u ms\n",
+    loss_permille / 10, seed, ok ? "ok" : "FAIL", frames, TimePassedSince(start), ncp.naks, ncp.retx, EZSP_Serial.t_rx_ack);
+  return ok ? 0 : 1;
+}
+
+// the NCP stops answering, the link must be declared failed after EZSP_ASH_ACK_TIMEOUTS timeouts
+static int TestSilentNcp(void) {
+  SetupPty();
+  NCP ncp(ncp_fd, 0, 1);
+  ncp.silent = true;
+  uint8_t cmd[6] = { Z_B0(EZSP_version), Z_B1(EZSP_version), 0, 0, 0, 0 };
+  ZigbeeEZSPSendCmd(cmd, sizeof(cmd));
+  uint32_t start = host_millis;
+  while (zigbee.active && (TimePassedSince(start) < 60 * 1000)) {
+    ZigbeeInputLoop();
+    ZigbeeOutputLoop();
+    ncp.loop();
+    if (!PtySync(ncp)) { printf("pty stalled\n"); return 1; }
+    host_millis++;
+  }
+  bool ok = !zigbee.active && (2 == TasmotaGlobal.restart_flag) && (0x51 == host_error) && EZSP_Serial.idle();
+  printf("silent NCP: %s, link failed after %u ms\n", ok ? "ok" : "FAIL", TimePassedSince(start));
+  return ok ? 0 : 1;
+}
+
+static int RunChild(int (*test)(uint32_t, uint32_t, uint32_t), uint32_t loss_permille, uint32_t seed, uint32_t frames) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (0 == pid) {
+    exit(test ? test(loss_permille, seed, frames) : TestSilentNcp());
+  }
+  int status;
+  waitpid(pid, &status, 0);
+  return (WIFEXITED(status) && (0 == WEXITSTATUS(status))) ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+  host_verbose = (argc > 1) && !strcmp(argv[1], "-v");
+  int failed = 0;
+  failed += RunChild(TestTransfer, 0, 1, 2000);
+  for (uint32_t seed = 1; seed <= 3; seed++) {
+    failed += RunChild(TestTransfer, 50, seed, 2000);
+    failed += RunChild(TestTransfer, 100, seed, 2000);
+  }
+  failed += RunChild(nullptr, 0, 0, 0);
+  printf("%s\n", failed ? "FAILED" : "ALL OK");
+  return failed ? 1 : 0;
+}